@@ -7,6 +7,7 @@ from ._jsbsim import (
     FGAircraft,
     FGAtmosphere,
     FGAuxiliary,
+    FGBatchRunner,
     FGEngine,
     FGFDMExec,
     FGGroundReactions,
@@ -19,6 +20,8 @@ from ._jsbsim import (
     FGPropertyManager,
     FGPropertyNode,
     FGPropulsion,
+    FGTable,
+    FGTrimSweep,
     GeographicError,
     TrimFailureError,
     LogLevel,
@@ -25,8 +25,9 @@
 
 from libcpp cimport bool
 from libcpp.string cimport string
-from libcpp.memory cimport shared_ptr
+from libcpp.memory cimport shared_ptr, unique_ptr
 from libcpp.vector cimport vector
+from libcpp.utility cimport pair
 from cpython.ref cimport PyObject
 
 cdef extern from "ExceptionManagement.h" namespace "JSBSim":
@@ -43,7 +44,7 @@ cdef extern from "initialization/FGInitialCondition.h" namespace "JSBSim":
 
 cdef extern from "initialization/FGLinearization.h" namespace "JSBSim":
     cdef cppclass c_FGLinearization "JSBSim::FGLinearization":
-        c_FGLinearization(c_FGFDMExec* fdme)
+        c_FGLinearization(c_FGFDMExec* fdme, unsigned int nthreads) except +convertJSBSimToPyExc
 
         void WriteScicoslab() const
         void WriteScicoslab(string& path) const
@@ -231,6 +232,7 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         bool SetAircraftPath(const c_SGPath& path)
         bool SetSystemsPath(const c_SGPath& path)
         bool SetOutputPath(const c_SGPath& path)
+        void SetProfileOutput(const c_SGPath& path)
         void SetRootDir(const c_SGPath& path)
         const c_SGPath& GetEnginePath()
         const c_SGPath& GetAircraftPath()
@@ -257,6 +259,9 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         void Resume()
         bool Holding()
         void ResetToInitialConditions(int mode)
+        string SaveSnapshot() except +convertJSBSimToPyExc
+        void RestoreSnapshot(const string& snapshot) except +convertJSBSimToPyExc
+        unique_ptr[c_FGFDMExec] Clone() except +convertJSBSimToPyExc
         void SetDebugLevel(int level)
         string QueryPropertyCatalog(string check)
         void PrintPropertyCatalog()
@@ -273,6 +278,8 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         void Setdt(double delta_t)
         double IncrTime()
         int GetDebugLevel()
+        void SetCompileFunctions(bool compile)
+        bool GetCompileFunctions()
         shared_ptr[c_FGPropulsion] GetPropulsion()
         shared_ptr[c_FGInitialCondition] GetIC()
         shared_ptr[c_FGPropagate] GetPropagate()
@@ -283,3 +290,111 @@ cdef extern from "FGFDMExec.h" namespace "JSBSim":
         shared_ptr[c_FGAircraft] GetAircraft()
         shared_ptr[c_FGAtmosphere] GetAtmosphere()
         shared_ptr[c_FGMassBalance] GetMassBalance()
+
+cdef extern from "FGBatchRunner.h" namespace "JSBSim":
+    cdef cppclass c_FGBatchCase "JSBSim::FGBatchCase":
+        c_FGBatchCase()
+        string model
+        c_SGPath script
+        c_SGPath initfile
+        vector[pair[string, double]] properties
+        int seed
+        double end_time
+        double dt
+
+    cdef cppclass c_FGBatchResult "JSBSim::FGBatchResult":
+        bool success
+        string error
+        double sim_time
+        unsigned int frames
+        vector[double] values
+
+    cdef cppclass c_FGBatchRunner "JSBSim::FGBatchRunner":
+        c_FGBatchRunner(const c_SGPath& root_dir, unsigned int nthreads)
+        void SetAircraftPath(const c_SGPath& path)
+        void SetEnginePath(const c_SGPath& path)
+        void SetSystemsPath(const c_SGPath& path)
+        void SetOutputProperties(const vector[string]& names)
+        void SetOutputEnabled(bool enabled)
+        size_t AddCase(const c_FGBatchCase& c)
+        void ClearCases()
+        size_t GetNumCases()
+        unsigned int GetNumThreads()
+        vector[c_FGBatchResult] Run() nogil except +convertJSBSimToPyExc
+
+cdef extern from "initialization/FGTrim.h" namespace "JSBSim":
+    ctypedef enum c_TrimMode "JSBSim::TrimMode":
+        pass
+
+cdef extern from "initialization/FGTrimSweep.h" namespace "JSBSim":
+    cdef cppclass c_FGTrimSweepResult "JSBSim::FGTrimSweepResult":
+        bool success
+        string error
+        bool warm_start
+        unsigned int iterations
+        unsigned int sub_iterations
+        vector[double] controls
+        vector[double] values
+        vector[vector[double]] A
+        vector[vector[double]] B
+        vector[vector[double]] C
+        vector[vector[double]] D
+
+    cdef cppclass c_FGTrimSweep "JSBSim::FGTrimSweep":
+        c_FGTrimSweep(const c_SGPath& root_dir, unsigned int nthreads)
+        void SetAircraftPath(const c_SGPath& path)
+        void SetEnginePath(const c_SGPath& path)
+        void SetSystemsPath(const c_SGPath& path)
+        void SetModel(const string& model)
+        void SetInitFile(const c_SGPath& initfile)
+        void SetTrimMode(c_TrimMode mode)
+        void SetWarmStart(bool enabled)
+        void SetLinearization(bool enabled)
+        void SetOutputProperties(const vector[string]& names)
+        void SetOutputFile(const c_SGPath& path)
+        size_t AddAxis(const string& property, const vector[double]& values) except +convertJSBSimToPyExc
+        void ClearAxes()
+        size_t GetNumPoints()
+        vector[double] GetPoint(size_t index) except +convertJSBSimToPyExc
+        unsigned int GetNumThreads()
+        vector[c_FGTrimSweepResult] Run() nogil except +convertJSBSimToPyExc
+        vector[string] GetControlNames()
+        vector[string] GetStateNames()
+        vector[string] GetInputNames()
+        vector[string] GetOutputNames()
+
+cdef extern from "<istream>" namespace "std":
+    cdef cppclass istream:
+        pass
+
+cdef extern from "<sstream>" namespace "std":
+    cdef cppclass istringstream(istream):
+        istringstream(const string& s)
+
+cdef extern from "simgear/xml/easyxml.hxx":
+    cdef cppclass c_XMLVisitor "XMLVisitor":
+        pass
+    cdef void readXML(istream& input, c_XMLVisitor& visitor,
+                      const string& path) except +convertJSBSimToPyExc
+
+cdef extern from "input_output/FGXMLElement.h" namespace "JSBSim":
+    cdef cppclass c_Element "JSBSim::Element":
+        const string& GetName() const
+        c_Element* FindElement(const string& el)
+        c_Element* FindNextElement(const string& el)
+        string GetDataLine(unsigned int i)
+
+cdef extern from "input_output/FGXMLParse.h" namespace "JSBSim":
+    cdef cppclass c_FGXMLParse "JSBSim::FGXMLParse" (c_XMLVisitor):
+        c_FGXMLParse()
+        c_Element* GetDocument()
+
+cdef extern from "math/FGTable.h" namespace "JSBSim":
+    cdef cppclass c_FGTable "JSBSim::FGTable":
+        c_FGTable(shared_ptr[c_FGPropertyManager] propMan,
+                  c_Element* el) except +convertJSBSimToPyExc
+        double GetValue(const vector[double]& keys) except +convertJSBSimToPyExc
+        void GetValues(size_t n, const vector[const double*]& keys,
+                       double* values) except +convertJSBSimToPyExc
+        unsigned int GetNumRows() const
+        string GetName() const
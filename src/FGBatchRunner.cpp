@@ -0,0 +1,214 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBatchRunner.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Runs batches of independent cases on a pool of threads.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc., 59
+ Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class runs a batch of cases (Monte Carlo runs, dispersions, etc.) on a
+pool of worker threads. Each case is executed by an independent FGFDMExec
+instance owned by the worker thread that runs it.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "FGBatchRunner.h"
+#include "FGFDMExec.h"
+#include "initialization/FGInitialCondition.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+// Queue of the indices of the cases assigned to a worker. The owner pops cases
+// from the back while thieves steal them from the front.
+struct WorkQueue {
+  std::mutex mutex;
+  std::deque<size_t> cases;
+
+  bool Pop(size_t& idx) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cases.empty()) return false;
+    idx = cases.back();
+    cases.pop_back();
+    return true;
+  }
+
+  bool Steal(size_t& idx) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cases.empty()) return false;
+    idx = cases.front();
+    cases.pop_front();
+    return true;
+  }
+};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchRunner::FGBatchRunner(const SGPath& rootDir, unsigned int nthreads)
+  : RootDir(rootDir), AircraftPath("aircraft"), EnginePath("engine"),
+    SystemsPath("systems"), NumThreads(nthreads), OutputEnabled(false)
+{
+  if (NumThreads == 0)
+    NumThreads = max(thread::hardware_concurrency(), 1u);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGBatchRunner::AddCase(const FGBatchCase& c)
+{
+  Cases.push_back(c);
+  return Cases.size() - 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGBatchResult FGBatchRunner::RunCase(const FGBatchCase& c, size_t index) const
+{
+  FGBatchResult result;
+
+  try {
+    FGFDMExec fdmex;
+
+    fdmex.SetRootDir(RootDir);
+    fdmex.SetAircraftPath(AircraftPath);
+    fdmex.SetEnginePath(EnginePath);
+    fdmex.SetSystemsPath(SystemsPath);
+
+    if (!c.script.isNull()) {
+      if (!fdmex.LoadScript(c.script, c.dt, c.initfile)) {
+        result.error = "Failed to load the script " + c.script.utf8Str();
+        return result;
+      }
+    } else {
+      if (c.end_time <= 0.0) {
+        result.error = "A case without a script must specify an end time.";
+        return result;
+      }
+      if (!fdmex.LoadModel(c.model)) {
+        result.error = "Failed to load the aircraft " + c.model;
+        return result;
+      }
+      if (!c.initfile.isNull() && !fdmex.GetIC()->Load(c.initfile)) {
+        result.error = "Failed to load the initialization file "
+                       + c.initfile.utf8Str();
+        return result;
+      }
+      if (c.dt > 0.0) fdmex.Setdt(c.dt);
+    }
+
+    if (!OutputEnabled) fdmex.DisableOutput();
+
+    fdmex.SetPropertyValue("simulation/randomseed", c.seed);
+
+    for (auto& [name, value]: c.properties)
+      fdmex.SetPropertyValue(name, value);
+
+    if (!fdmex.RunIC()) {
+      result.error = "Failed to initialize the simulation.";
+      return result;
+    }
+
+    if (CaseInitializer) CaseInitializer(fdmex, index);
+
+    unsigned int frame0 = fdmex.GetFrame();
+
+    while (fdmex.Run()) {
+      if (c.end_time > 0.0 && fdmex.GetSimTime() >= c.end_time) break;
+    }
+
+    result.sim_time = fdmex.GetSimTime();
+    result.frames = fdmex.GetFrame() - frame0;
+
+    result.values.reserve(OutputProperties.size());
+    for (auto& name: OutputProperties)
+      result.values.push_back(fdmex.GetPropertyValue(name));
+
+    result.success = true;
+  } catch (const exception& e) {
+    result.error = e.what();
+  } catch (const string& msg) {
+    result.error = msg;
+  }
+
+  return result;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<FGBatchResult> FGBatchRunner::Run(void)
+{
+  vector<FGBatchResult> results(Cases.size());
+  unsigned int nworkers = min<size_t>(NumThreads, Cases.size());
+
+  if (nworkers == 0) return results;
+
+  vector<WorkQueue> queues(nworkers);
+  for (size_t i=0; i < Cases.size(); ++i)
+    queues[i % nworkers].cases.push_front(i);
+
+  // Each result is written by exactly one worker so the results do not need
+  // to be protected by a lock.
+  auto worker = [&](unsigned int id) {
+    if (LoggerFactory) SetLogger(LoggerFactory());
+
+    size_t idx;
+    while (true) {
+      bool found = queues[id].Pop(idx);
+      for (unsigned int i=1; !found && i < nworkers; ++i)
+        found = queues[(id+i) % nworkers].Steal(idx);
+
+      // Cases are never added once the workers are started so when all the
+      // queues are empty, the work is done.
+      if (!found) break;
+
+      results[idx] = RunCase(Cases[idx], idx);
+    }
+  };
+
+  vector<thread> threads;
+  threads.reserve(nworkers);
+  for (unsigned int i=0; i < nworkers; ++i)
+    threads.emplace_back(worker, i);
+
+  for (auto& t: threads) t.join();
+
+  return results;
+}
+}
@@ -0,0 +1,214 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBatchRunner.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBATCHRUNNER_H
+#define FGBATCHRUNNER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "simgear/misc/sg_path.hxx"
+#include "input_output/FGLog.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/** Description of a case executed by FGBatchRunner.
+    A case is either defined by a script (which loads the aircraft and its
+    initial conditions) or by an aircraft model name and an initialization
+    file. */
+struct FGBatchCase {
+  /// Name of the aircraft model. Ignored when a script is supplied.
+  std::string model;
+  /// Script file name. Relative paths are taken from the root directory.
+  SGPath script;
+  /** Initialization file name. When a script is supplied, this file overrides
+      the initialization file specified in the script. Otherwise the file is
+      looked for in the aircraft directory. */
+  SGPath initfile;
+  /** Property values that are set after the initial conditions are loaded
+      and before the simulation is initialized with RunIC(). */
+  std::vector<std::pair<std::string, double>> properties;
+  /// Seed of the random number generator (property simulation/randomseed).
+  int seed = 0;
+  /** Simulation time in seconds at which the case is stopped. When set to 0.0
+      the case runs until its script terminates. */
+  double end_time = 0.0;
+  /// Integration time step in seconds. 0.0 keeps the model/script default.
+  double dt = 0.0;
+};
+
+/// Outcome of a case executed by FGBatchRunner.
+struct FGBatchResult {
+  /// true if the case has been loaded, initialized and run without error.
+  bool success = false;
+  /// Error message when the case failed.
+  std::string error;
+  /// Simulation time reached at the end of the case.
+  double sim_time = 0.0;
+  /// Number of frames executed.
+  unsigned int frames = 0;
+  /// Final values of the properties requested with SetOutputProperties().
+  std::vector<double> values;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Runs a batch of independent cases on a pool of threads.
+    Each case is executed by its own FGFDMExec instance which is created,
+    loaded and destroyed by the worker thread that runs the case. The instances
+    therefore share no mutable state: each of them owns its property tree, its
+    models and its random number generator, and the logger is thread local (see
+    SetLogger()).
+
+    Cases are distributed round robin between the workers at startup. A worker
+    that runs out of cases steals the oldest pending case of another worker so
+    that a batch of cases with uneven durations keeps all threads busy.
+
+    @code{.cpp}
+    FGBatchRunner runner("/path/to/jsbsim");
+    runner.SetOutputProperties({"position/h-sl-ft", "velocities/vc-kts"});
+
+    FGBatchCase c;
+    c.model = "c172x";
+    c.initfile = "reset01";
+    c.end_time = 30.0;
+    for (int i=0; i<1000; ++i) {
+      c.seed = i;
+      c.properties = {{"ic/h-sl-ft", 1000.0 + 10.0*i}};
+      runner.AddCase(c);
+    }
+
+    auto results = runner.Run(); // results[i] is the outcome of the i-th case
+    @endcode
+
+    The debug level (FGJSBBase::debug_lvl) is global to the process so it should
+    be set before calling Run().
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGBatchRunner
+{
+public:
+  /** Constructor
+      @param rootDir the root directory from which relative paths are resolved
+      @param nthreads the number of worker threads. If 0, the number of
+                      hardware threads is used. */
+  FGBatchRunner(const SGPath& rootDir, unsigned int nthreads = 0);
+
+  /// Set the path to the aircraft directory (relative to the root directory).
+  void SetAircraftPath(const SGPath& path) { AircraftPath = path; }
+  /// Set the path to the engine directory (relative to the root directory).
+  void SetEnginePath(const SGPath& path) { EnginePath = path; }
+  /// Set the path to the systems directory (relative to the root directory).
+  void SetSystemsPath(const SGPath& path) { SystemsPath = path; }
+
+  /** Set the properties which values are collected at the end of each case.
+      The values are returned in FGBatchResult::values in the same order. */
+  void SetOutputProperties(const std::vector<std::string>& names)
+  { OutputProperties = names; }
+
+  /** Enable or disable the outputs (the <output> elements) of the cases.
+      Outputs are disabled by default since the cases would otherwise write to
+      the same files concurrently. */
+  void SetOutputEnabled(bool enabled) { OutputEnabled = enabled; }
+
+  /** Set the factory of the loggers used by the worker threads. The factory is
+      called once by each worker thread when it starts. By default, the worker
+      threads log to the console. */
+  void SetLoggerFactory(std::function<FGLogger_ptr(void)> factory)
+  { LoggerFactory = factory; }
+
+  /** Set a function that is called by the worker thread once a case is
+      initialized, just before the first call to FGFDMExec::Run(). It can be
+      used to further configure the FGFDMExec instance. The function is called
+      concurrently by the worker threads. */
+  void SetCaseInitializer(std::function<void(FGFDMExec&, size_t)> init)
+  { CaseInitializer = init; }
+
+  /** Add a case to the batch.
+      @return the index of the case in the batch */
+  size_t AddCase(const FGBatchCase& c);
+
+  /// Remove all the cases from the batch.
+  void ClearCases(void) { Cases.clear(); }
+
+  /// Returns the number of cases in the batch.
+  size_t GetNumCases(void) const { return Cases.size(); }
+
+  /// Returns the number of worker threads.
+  unsigned int GetNumThreads(void) const { return NumThreads; }
+
+  /** Run all the cases of the batch. The call returns once all the cases have
+      been executed.
+      @return the results of the cases, in the order in which they were added */
+  std::vector<FGBatchResult> Run(void);
+
+  /** Run a single case in the calling thread.
+      @param c the case to run
+      @param index the index passed to the case initializer
+      @return the result of the case */
+  FGBatchResult RunCase(const FGBatchCase& c, size_t index = 0) const;
+
+private:
+  SGPath RootDir;
+  SGPath AircraftPath;
+  SGPath EnginePath;
+  SGPath SystemsPath;
+  unsigned int NumThreads;
+  bool OutputEnabled;
+  std::vector<std::string> OutputProperties;
+  std::vector<FGBatchCase> Cases;
+  std::function<FGLogger_ptr(void)> LoggerFactory;
+  std::function<void(FGFDMExec&, size_t)> CaseInitializer;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
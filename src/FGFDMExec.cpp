@@ -42,6 +42,7 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <iomanip>
 
 #include "FGFDMExec.h"
@@ -67,6 +68,7 @@ INCLUDES
 #include "input_output/string_utilities.h"
 #include "initialization/FGInitialCondition.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -76,12 +78,83 @@ namespace JSBSim {
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+namespace {
+  // Names of the standard models in the profiler statistics, in the order of
+  // FGFDMExec::eModels.
+  const char* ProfileModelNames[] = {
+    "propagate", "input", "inertial", "atmosphere", "winds", "systems",
+    "mass-balance", "auxiliary", "propulsion", "aerodynamics",
+    "ground-reactions", "external-reactions", "buoyant-forces", "aircraft",
+    "accelerations", "output" };
+
+  // Header of the snapshots.
+  const string SnapshotMagic = "JSBSim snapshot";
+  const unsigned int SnapshotVersion = 6;
+
+  // Saves or restores the values of the properties that are not tied to a
+  // C++ variable. These are the properties that are created by the XML
+  // definitions such as the outputs of the FCS components, the <property>
+  // declarations of the scripts and systems, etc.
+  void SerializeProperties(SGPropertyNode* root, FGSnapshot& snapshot)
+  {
+    if (snapshot.IsRestoring()) {
+      size_t count = 0;
+      snapshot(count);
+      for (size_t i=0; i < count; ++i) {
+        string path;
+        double value = 0.0;
+        snapshot(path, value);
+        SGPropertyNode* node = root->getNode(path, true);
+        if (!node->isTied() && node->getAttribute(SGPropertyNode::WRITE))
+          node->setDoubleValue(value);
+      }
+    }
+    else {
+      vector<pair<string, double>> values;
+      vector<pair<SGPropertyNode*, string>> stack {{root, ""}};
+
+      while (!stack.empty()) {
+        auto [node, path] = stack.back();
+        stack.pop_back();
+
+        for (int i=node->nChildren()-1; i >= 0; --i) {
+          SGPropertyNode* child = node->getChild(i);
+          string name = path + child->getNameString();
+          if (child->getIndex() > 0)
+            name += "[" + to_string(child->getIndex()) + "]";
+
+          switch (child->getType()) {
+          case simgear::props::NONE:
+            stack.emplace_back(child, name + "/");
+            break;
+          case simgear::props::BOOL:
+          case simgear::props::INT:
+          case simgear::props::LONG:
+          case simgear::props::FLOAT:
+          case simgear::props::DOUBLE:
+            if (!child->isTied())
+              values.emplace_back(name, child->getDoubleValue());
+            break;
+          default:
+            break;
+          }
+        }
+      }
+
+      size_t count = values.size();
+      snapshot(count);
+      for (auto& [path, value]: values)
+        snapshot(path, value);
+    }
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Constructor
 
 FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmctr)
   : RandomSeed(0), RandomGenerator(make_shared<RandomNumberGenerator>(RandomSeed)),
-    FDMctr(fdmctr)
+    CounterBasedRandom(false), FDMctr(fdmctr)
 {
   Frame           = 0;
   disperse        = 0;
@@ -93,6 +166,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   holding = false;
   Terminate = false;
   HoldDown = false;
+  CompileFunctions = true;
 
   IncrementThenHolding = false;  // increment then hold is off by default
   TimeStepsUntilHold = -1;
@@ -126,6 +200,7 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
 
   SGPropertyNode* instanceRoot = Root->getNode("fdm/jsbsim", IdFDM, true);
   instance = std::make_shared<FGPropertyManager>(instanceRoot);
+  Profiler = std::make_shared<FGProfiler>(instance);
 
   if (const char* num = getenv("JSBSIM_DISPERSE");
       num != nullptr && strtol(num, nullptr, 0) != 0)
@@ -153,6 +228,9 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
   instance->Tie<FGFDMExec, int>("simulation/reset", this, nullptr, &FGFDMExec::ResetToInitialConditions);
   instance->Tie("simulation/disperse", this, &FGFDMExec::GetDisperse);
   instance->Tie("simulation/randomseed", this, &FGFDMExec::SRand, &FGFDMExec::SRand);
+  instance->Tie("simulation/counter-based-random", this,
+                &FGFDMExec::GetCounterBasedRandom,
+                &FGFDMExec::SetCounterBasedRandom);
   instance->Tie("simulation/terminate", &Terminate);
   instance->Tie("simulation/pause", &holding);
   instance->Tie("simulation/sim-time-sec", this, &FGFDMExec::GetSimTime);
@@ -169,6 +247,11 @@ FGFDMExec::FGFDMExec(FGPropertyManager* root, std::shared_ptr<unsigned int> fdmc
 
 FGFDMExec::~FGFDMExec()
 {
+  if (!ProfileOutput.isNull() && !Profiler->WriteJSON(ProfileOutput)) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not write the profile to " << ProfileOutput << endl;
+  }
+
   try {
     Unbind();
     DeAllocate();
@@ -397,6 +480,7 @@ bool FGFDMExec::DeAllocate(void)
 {
 
   Models.clear();
+  Profiler->ClearOwners();
   modelLoaded = false;
   return modelLoaded;
 }
@@ -419,9 +503,21 @@ bool FGFDMExec::Run(void)
   // returns true if success, false if complete
   if (Script && !IntegrationSuspended()) success = Script->RunScript();
 
-  for (unsigned int i = 0; i < Models.size(); i++) {
-    LoadInputs(i);
-    Models[i]->Run(holding);
+  if (Profiler->IsEnabled()) {
+    for (unsigned int i = 0; i < Models.size(); i++) {
+      FGModel* model = Models[i].get();
+      FGProfiler::Scope scope(Profiler->GetTimer(model, [model, i]() {
+        return "models/" + (i < eNumStandardModels ? ProfileModelNames[i]
+                                                   : model->GetName());
+      }));
+      LoadInputs(i);
+      model->Run(holding);
+    }
+  } else {
+    for (unsigned int i = 0; i < Models.size(); i++) {
+      LoadInputs(i);
+      Models[i]->Run(holding);
+    }
   }
 
   if (Terminate) success = false;
@@ -559,9 +655,8 @@ void FGFDMExec::LoadInputs(unsigned int idx)
     MassBalance->in.GasInertia  = BuoyantForces->GetGasMassInertia();
     MassBalance->in.GasMass     = BuoyantForces->GetGasMass();
     MassBalance->in.GasMoment   = BuoyantForces->GetGasMassMoment();
-    MassBalance->in.TanksWeight = Propulsion->GetTanksWeight();
-    MassBalance->in.TanksMoment = Propulsion->GetTanksMoment();
-    MassBalance->in.TankInertia = Propulsion->CalculateTankInertias();
+    MassBalance->in.Tanks       = Propulsion->GetTanksMassProperties();
+    MassBalance->in.TanksRevision = Propulsion->GetTanksMassRevision();
     MassBalance->in.WOW         = GroundReactions->GetWOW();
     break;
   case eAircraft:
@@ -703,6 +798,117 @@ void FGFDMExec::ResetToInitialConditions(int mode)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+string FGFDMExec::SaveSnapshot(void)
+{
+  FGSnapshot snapshot;
+  string magic = SnapshotMagic;
+  unsigned int version = SnapshotVersion;
+
+  snapshot(magic, version);
+  SerializeState(snapshot);
+
+  return snapshot.GetData();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::RestoreSnapshot(const string& data)
+{
+  FGSnapshot snapshot(data);
+  string magic;
+  unsigned int version = 0;
+
+  snapshot(magic, version);
+  if (magic != SnapshotMagic || version != SnapshotVersion)
+    throw BaseException("The data is not a snapshot of a JSBSim simulation.");
+
+  SerializeState(snapshot);
+
+  if (!snapshot.AtEnd())
+    throw BaseException("The snapshot does not match the model: unexpected data at its end.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unique_ptr<FGFDMExec> FGFDMExec::Clone(void)
+{
+  if (!modelLoaded || modelName.empty())
+    throw BaseException("No model is loaded: the FDM cannot be cloned.");
+  if (IsChild)
+    throw BaseException("A child FDM cannot be cloned.");
+
+  string snapshot = SaveSnapshot();
+
+  auto clone = make_unique<FGFDMExec>();
+  clone->RootDir = RootDir;
+  clone->AircraftPath = AircraftPath;
+  clone->EnginePath = EnginePath;
+  clone->SystemsPath = SystemsPath;
+  clone->OutputPath = OutputPath;
+  clone->CompileFunctions = CompileFunctions;
+  clone->RandomSeed = RandomSeed;
+  clone->CounterBasedRandom = CounterBasedRandom;
+  clone->disperse = disperse;
+  clone->Profiler->SetEnabled(Profiler->IsEnabled());
+
+  bool result;
+  if (Script)
+    result = clone->LoadScript(ScriptFile, dT, ScriptInitFile);
+  else
+    result = clone->LoadModel(modelName, FullAircraftPath != AircraftPath);
+
+  if (!result)
+    throw BaseException("The model " + modelName + " could not be cloned.");
+
+  // Same as RunIC() except that the inputs and the outputs are left
+  // uninitialized.
+  clone->DisableOutput();
+  clone->SuspendIntegration();
+  clone->Initialize(clone->IC.get());
+  clone->Run();
+  clone->Propagate->InitializeDerivatives();
+  clone->ResumeIntegration();
+
+  clone->RestoreSnapshot(snapshot);
+
+  return clone;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFDMExec::SerializeState(FGSnapshot& snapshot)
+{
+  string name = modelName;
+  snapshot(name);
+  if (name != modelName)
+    throw BaseException("The snapshot of the model " + name
+                        + " cannot be restored in the model " + modelName + ".");
+
+  snapshot(sim_time, Frame, dT, saved_dT, holding, Terminate, HoldDown,
+           IncrementThenHolding, TimeStepsUntilHold, trim_status, ta_mode,
+           trim_completed);
+  snapshot(*RandomGenerator);
+
+  snapshot.Check(Models.size(), "the number of models");
+  for (auto& model: Models)
+    model->SerializeState(snapshot);
+
+  IC->SerializeState(snapshot);
+
+  snapshot.Check(Script ? 1 : 0, "the number of scripts");
+  if (Script) Script->SerializeState(snapshot);
+
+  SerializeProperties(instance->GetNode(), snapshot);
+
+  snapshot.Check(ChildFDMList.size(), "the number of child FDMs");
+  for (auto& child: ChildFDMList) {
+    snapshot(child->Loc, child->Orient, child->mated);
+    child->exec->SerializeState(snapshot);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFDMExec::SetHoldDown(bool hd)
 {
   HoldDown = hd;
@@ -733,6 +939,8 @@ bool FGFDMExec::LoadScript(const SGPath& script, double deltaT,
                            const SGPath& initfile)
 {
   Script = std::make_shared<FGScript>(this);
+  ScriptFile = script;
+  ScriptInitFile = initfile;
   return Script->LoadScript(GetFullPath(script), deltaT, initfile);
 }
 
@@ -804,6 +1012,7 @@ bool FGFDMExec::LoadPlanet(Element* element)
 
       if (newAtmosphere) {
         Models[eAtmosphere] = newAtmosphere;
+        Profiler->ClearOwners();
         Atmosphere = static_cast<FGAtmosphere*>(Models[eAtmosphere].get());
 
         // Model initialization sequence
@@ -1374,6 +1583,52 @@ void FGFDMExec::SRand(int sr)
 {
   RandomSeed = sr;
   RandomGenerator->seed(RandomSeed);
+
+  for (auto& stream: RandomStreams) {
+    if (auto generator = stream.lock())
+      generator->seed(RandomSeed);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The stream number is the FNV-1a hash of the stream name so that it does not
+// depend on the order in which the streams are created.
+
+unsigned int FGFDMExec::GetStreamNumber(const string& stream)
+{
+  uint32_t hash = 2166136261u;
+  for (unsigned char c: stream) {
+    hash ^= c;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<RandomNumberGeneratorBase> FGFDMExec::GetRandomGenerator(const string& stream)
+{
+  if (!CounterBasedRandom) return RandomGenerator;
+
+  auto generator = GetRandomGenerator(stream, RandomSeed);
+
+  RandomStreams.erase(remove_if(RandomStreams.begin(), RandomStreams.end(),
+                                [](const auto& s) { return s.expired(); }),
+                      RandomStreams.end());
+  RandomStreams.push_back(generator);
+  return generator;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<RandomNumberGeneratorBase> FGFDMExec::GetRandomGenerator(const string& stream,
+                                                                    unsigned int seed)
+{
+  if (!CounterBasedRandom) return make_shared<RandomNumberGenerator>(seed);
+
+  return make_shared<CounterRandomNumberGenerator>(seed,
+                                                   GetStreamNumber(stream),
+                                                   Frame);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
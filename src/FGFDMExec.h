@@ -47,6 +47,7 @@ INCLUDES
 #include "models/FGOutput.h"
 #include "models/FGInput.h"
 #include "math/FGTemplateFunc.h"
+#include "FGProfiler.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -55,6 +56,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGScript;
+class FGSnapshot;
 class FGTrim;
 class FGAerodynamics;
 class FGAircraft;
@@ -172,6 +174,11 @@ CLASS DOCUMENTATION
                                 tCustom (4), tTurn (5). Setting this to a legal value
                                 (such as by a script) causes a trim to be performed. This
                                 property actually maps toa function call of DoTrim().
+    @property simulation/counter-based-random (read/write) When set before the
+                                model is loaded, the turbulence, the sensor noise
+                                and the random functions draw their numbers from
+                                counter-based streams (see
+                                SetCounterBasedRandom()).
 
     @author Jon S. Berndt
     @version $Revision: 1.106 $
@@ -390,8 +397,16 @@ public:
   std::shared_ptr<FGInitialCondition>  GetIC(void) const {return IC;}
   /// Returns a pointer to the FGTrim object
   std::shared_ptr<FGTrim>              GetTrim(void);
+  /// Returns a pointer to the profiler.
+  std::shared_ptr<FGProfiler>          GetProfiler(void) const {return Profiler;}
   ///@}
 
+  /** Sets the name of the file in which the profiler statistics are written
+      in JSON format when this instance is destroyed. The statistics are not
+      written if the name is empty (the default).
+      @see FGProfiler */
+  void SetProfileOutput(const SGPath& path) { ProfileOutput = path; }
+
   /// Retrieves the engine path.
   const SGPath& GetEnginePath(void) { return EnginePath; }
   /// Retrieves the aircraft path.
@@ -407,13 +422,41 @@ public:
       @param property the name of the property
       @result the value of the specified property */
   double GetPropertyValue(const std::string& property)
-  { return instance->GetNode()->getDoubleValue(property.c_str()); }
+  {
+    SGPropertyNode* node = instance->GetNode(property);
+    return node ? node->getDoubleValue() : 0.0;
+  }
 
   /** Sets a property value.
       @param property the property to be set
       @param value the value to set the property to */
   void SetPropertyValue(const std::string& property, double value)
-  { instance->GetNode()->setDoubleValue(property.c_str(), value); }
+  {
+    SGPropertyNode* node = instance->GetNode(property, true);
+    if (node) node->setDoubleValue(value);
+  }
+
+  /** Interns the name of a property.
+      Accessing a property from its handle is faster than from its name.
+      @param property the name of the property
+      @param create true if the property must be created if it does not exist
+      @return the handle of the property
+      @throw BaseException if the property does not exist and create is false
+      @see FGPropertyManager::GetHandle */
+  size_t GetPropertyHandle(const std::string& property, bool create = false)
+  { return instance->GetHandle(property, create); }
+
+  /** Retrieves the value of a property from its handle.
+      @param handle the handle returned by GetPropertyHandle()
+      @result the value of the property */
+  double GetPropertyValue(size_t handle) const
+  { return instance->GetDoubleValue(handle); }
+
+  /** Sets the value of a property from its handle.
+      @param handle the handle returned by GetPropertyHandle()
+      @param value the value to set the property to */
+  void SetPropertyValue(size_t handle, double value)
+  { instance->SetDoubleValue(handle, value); }
 
   /// Returns the model name.
   const std::string& GetModelName(void) const { return modelName; }
@@ -510,6 +553,42 @@ public:
       surface deflections which would've been reset.
       @param mode Sets the reset mode.*/
   void ResetToInitialConditions(int mode);
+
+  /** Saves the complete state of the simulation in a binary snapshot.
+      The snapshot includes the state of all the models (integrator histories,
+      FCS components, engines, tanks, contact points, turbulence, random
+      number generators, ...), the initial conditions, the script events, the
+      values of the untied properties and the state of the child FDMs. It can be restored later on
+      with RestoreSnapshot() to resume the simulation from that point as if it
+      had never been interrupted.
+      @return the binary data of the snapshot.
+      @see FGSnapshot */
+  std::string SaveSnapshot(void);
+  /** Restores a snapshot saved with SaveSnapshot().
+      The state is restored in place: the models are neither reloaded nor
+      reallocated so the snapshot can only be restored in an instance which
+      has loaded the same model (and script) as the instance that saved it.
+      @param snapshot the binary data returned by SaveSnapshot().
+      @throw BaseException if the snapshot is corrupted or does not match the
+             model. In that case the state of the simulation is undefined. */
+  void RestoreSnapshot(const std::string& snapshot);
+  /** Creates an independent copy of this FDM.
+      The copy loads the same model (and script) from the XML documents
+      cached by FGXMLFileRead, so the files are not parsed again, and then
+      restores a snapshot of this FDM. The copy has its own property tree and
+      can be run in another thread than this FDM.
+      The initial conditions of the copy are those of the model or script
+      files and not the ones that may have been modified programmatically in
+      this FDM.
+      The inputs and outputs of the copy are not initialized and its outputs
+      are disabled so that the copy neither overwrites the files nor competes
+      for the sockets of this FDM. The outputs of the copy can be renamed with
+      SetOutputFileName(), opened with GetOutput()->InitModel() and then
+      enabled with EnableOutput().
+      @return the copy of this FDM.
+      @throw BaseException if no model is loaded, if this FDM is a child FDM
+             or if the model cannot be loaded again. */
+  std::unique_ptr<FGFDMExec> Clone(void);
   /// Sets the debug level.
   void SetDebugLevel(int level) {debug_lvl = level;}
 
@@ -620,6 +699,16 @@ public:
   */
   bool GetHoldDown(void) const {return HoldDown;}
 
+  /** Enables or disables the compilation of the functions (see FGFunction)
+      into flat programs. This setting is read when the functions are built so
+      it must be set before the model is loaded. The compilation is enabled by
+      default.
+      @param compile true to compile the functions */
+  void SetCompileFunctions(bool compile) { CompileFunctions = compile; }
+
+  /// Returns true if the functions are compiled when the model is loaded.
+  bool GetCompileFunctions(void) const { return CompileFunctions; }
+
   FGTemplateFunc_ptr GetTemplateFunc(const std::string& name) {
     return TemplateFunctions.count(name) ? TemplateFunctions[name] : nullptr;
   }
@@ -630,6 +719,39 @@ public:
 
   auto GetRandomGenerator(void) const { return RandomGenerator; }
 
+  /** Returns the random number generator of a component. By default, all the
+      components share the generator of the simulation. When counter-based
+      random numbers are enabled, each component gets its own stream of a
+      CounterRandomNumberGenerator keyed by the simulation seed, by the stream
+      name and by the frame counter: the numbers drawn by a component then
+      neither depend on the other components nor on the order in which they
+      are executed.
+      @param stream name of the stream. Components using the same name draw
+                    the same numbers.
+      @return the random number generator */
+  std::shared_ptr<RandomNumberGeneratorBase> GetRandomGenerator(const std::string& stream);
+
+  /** Returns a random number generator for a component that has its own seed.
+      @param stream name of the stream
+      @param seed seed specific to the component
+      @return a new random number generator */
+  std::shared_ptr<RandomNumberGeneratorBase> GetRandomGenerator(const std::string& stream,
+                                                                unsigned int seed);
+
+  /** Returns the number of a random stream. Components that generate their
+      own counter-based random numbers use it as the key of their stream.
+      @param stream name of the stream */
+  static unsigned int GetStreamNumber(const std::string& stream);
+
+  /** Enables or disables the counter-based random numbers. This setting is
+      read when the components request their random number generator so it
+      must be set before the model is loaded.
+      @param enabled true to use counter-based random numbers */
+  void SetCounterBasedRandom(bool enabled) { CounterBasedRandom = enabled; }
+
+  /// Returns true if the components use counter-based random numbers.
+  bool GetCounterBasedRandom(void) const { return CounterBasedRandom; }
+
   int  SRand(void) const { return RandomSeed; }
 
 private:
@@ -681,15 +803,23 @@ private:
 
   std::shared_ptr<FGInitialCondition> IC;
   std::shared_ptr<FGScript>           Script;
+  SGPath                              ScriptFile;
+  SGPath                              ScriptInitFile;
   std::shared_ptr<FGTrim>             Trim;
+  std::shared_ptr<FGProfiler>         Profiler;
+  SGPath                              ProfileOutput;
 
   SGPropertyNode_ptr Root;
   std::shared_ptr<FGPropertyManager> instance;
 
   bool HoldDown;
+  bool CompileFunctions;
 
   unsigned int RandomSeed;
   std::shared_ptr<RandomNumberGenerator> RandomGenerator;
+  bool CounterBasedRandom;
+  // Counter-based streams that follow the seed of the simulation.
+  std::vector<std::weak_ptr<RandomNumberGeneratorBase>> RandomStreams;
 
   // The FDM counter is used to give each child FDM an unique ID. The root FDM
   // has the ID 0
@@ -705,6 +835,7 @@ private:
   bool ReadPrologue(Element*);
   void SRand(int sr);
   void LoadInputs(unsigned int idx);
+  void SerializeState(FGSnapshot& snapshot);
   void LoadPlanetConstants(void);
   bool LoadPlanet(Element* el);
   void LoadModelConstants(void);
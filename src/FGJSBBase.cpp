@@ -35,6 +35,8 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <sstream>
+
 #include "FGJSBBase.h"
 #include "models/FGAtmosphere.h"
 
@@ -88,6 +90,92 @@ string FGJSBBase::CreateIndexedPropertyName(const string& Property, int index)
   buf << Property << '[' << index << ']';
   return buf.str();
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string RandomNumberGenerator::GetState(void) const
+{
+  ostringstream buf;
+  buf << generator << ' ' << uniform_random << ' ' << normal_random;
+  return buf.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void RandomNumberGenerator::SetState(const string& state)
+{
+  istringstream buf(state);
+  buf >> generator >> uniform_random >> normal_random;
+  if (buf.fail())
+    throw BaseException("Invalid state of the random number generator.");
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double CounterRandomNumberGenerator::GetUniformRandomNumber(unsigned int frame,
+                                                            unsigned int index) const
+{
+  Block r = Philox({frame, index, 0, 0}, Key);
+  return 2.0*ToUnitInterval(r[0], r[1]) - 1.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Only one of the two normal numbers of the Box-Muller transform is used so
+// that each draw remains independent of the previous ones.
+
+double CounterRandomNumberGenerator::GetNormalRandomNumber(unsigned int frame,
+                                                           unsigned int index) const
+{
+  double n0, n1;
+  BoxMuller(Philox({frame, index, 0, 0}, Key), n0, n1);
+  return n0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+unsigned int CounterRandomNumberGenerator::NextDraw(void)
+{
+  if (Frame != LastFrame) {
+    LastFrame = Frame;
+    Draw = 0;
+  }
+  return Draw++;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double CounterRandomNumberGenerator::GetUniformRandomNumber(void)
+{
+  unsigned int index = NextDraw();
+  return GetUniformRandomNumber(LastFrame, index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double CounterRandomNumberGenerator::GetNormalRandomNumber(void)
+{
+  unsigned int index = NextDraw();
+  return GetNormalRandomNumber(LastFrame, index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string CounterRandomNumberGenerator::GetState(void) const
+{
+  ostringstream buf;
+  buf << Key[0] << ' ' << Key[1] << ' ' << LastFrame << ' ' << Draw;
+  return buf.str();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void CounterRandomNumberGenerator::SetState(const string& state)
+{
+  istringstream buf(state);
+  buf >> Key[0] >> Key[1] >> LastFrame >> Draw;
+  if (buf.fail())
+    throw BaseException("Invalid state of the random number generator.");
+}
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 } // namespace JSBSim
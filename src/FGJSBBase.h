@@ -39,6 +39,8 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <float.h>
+#include <array>
+#include <cstdint>
 #include <queue>
 #include <string>
 #include <cmath>
@@ -63,6 +65,30 @@ class JSBSIM_API BaseException : public std::runtime_error {
     using std::runtime_error::runtime_error;
 };
 
+/**
+ * @brief Interface of the random number generators.
+ * The components that draw random numbers use this interface so that they can
+ * be given either a RandomNumberGenerator or a CounterRandomNumberGenerator.
+ */
+
+class JSBSIM_API RandomNumberGeneratorBase {
+  public:
+    virtual ~RandomNumberGeneratorBase() = default;
+    /// Specify a new seed and reinitialize the random generation process.
+    virtual void seed(unsigned int value) = 0;
+    /** Get a random number which probability of occurrence is uniformly
+     * distributed over the segment [-1;1( */
+    virtual double GetUniformRandomNumber(void) = 0;
+    /** Get a random number which probability of occurrence is following Gauss
+     * normal distribution with a mean of 0.0 and a standard deviation of 1.0 */
+    virtual double GetNormalRandomNumber(void) = 0;
+    /** Get the state of the generator. The state can later be restored with
+     * SetState() to replay the same random numbers. */
+    virtual std::string GetState(void) const = 0;
+    /// Restore a state previously obtained with GetState().
+    virtual void SetState(const std::string& state) = 0;
+};
+
 /**
  * @brief Random number generator.
  * This class encapsulates the C++11 random number generation classes for
@@ -71,7 +97,7 @@ class JSBSIM_API BaseException : public std::runtime_error {
  * and normal random number generators.
  */
 
-class JSBSIM_API RandomNumberGenerator {
+class JSBSIM_API RandomNumberGenerator : public RandomNumberGeneratorBase {
   public:
     /// Default constructor using a seed based on the system clock.
     RandomNumberGenerator(void) : uniform_random(-1.0, 1.0), normal_random(0.0, 1.0)
@@ -82,24 +108,101 @@ class JSBSIM_API RandomNumberGenerator {
     /// Constructor allowing to specify a seed.
     RandomNumberGenerator(unsigned int seed)
       : generator(seed), uniform_random(-1.0, 1.0), normal_random(0.0, 1.0) {}
-    /// Specify a new seed and reinitialize the random generation process.
-    void seed(unsigned int value) {
+    void seed(unsigned int value) override {
       generator.seed(value);
       uniform_random.reset();
       normal_random.reset();
     }
-    /** Get a random number which probability of occurrence is uniformly
-     * distributed over the segment [-1;1( */
-    double GetUniformRandomNumber(void) { return uniform_random(generator); }
-    /** Get a random number which probability of occurrence is following Gauss
-     * normal distribution with a mean of 0.0 and a standard deviation of 1.0 */
-    double GetNormalRandomNumber(void) { return normal_random(generator); }
+    double GetUniformRandomNumber(void) override { return uniform_random(generator); }
+    double GetNormalRandomNumber(void) override { return normal_random(generator); }
+    /** Get the state of the generator and of its distributions. */
+    std::string GetState(void) const override;
+    void SetState(const std::string& state) override;
   private:
     std::default_random_engine generator;
     std::uniform_real_distribution<double> uniform_random;
     std::normal_distribution<double> normal_random;
 };
 
+/**
+ * @brief Counter-based random number generator.
+ * The random numbers are computed by the Philox4x32-10 function (J. K. Salmon
+ * et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11) from a key
+ * made of the seed and of a stream number, and from a counter made of the
+ * simulation frame and of the index of the draw within that frame. Each
+ * stream therefore draws the same numbers whatever the other streams do, and
+ * the numbers of any frame can be obtained without drawing the numbers of the
+ * previous frames.
+ */
+
+class JSBSIM_API CounterRandomNumberGenerator : public RandomNumberGeneratorBase {
+  public:
+    using Block = std::array<uint32_t, 4>;
+
+    /** Constructor.
+     * @param seed the seed of the simulation run
+     * @param stream the number of the stream
+     * @param frame the frame counter of the simulation which must outlive
+     *              the generator. */
+    CounterRandomNumberGenerator(unsigned int seed, unsigned int stream,
+                                 const unsigned int& frame)
+      : Key{seed, stream}, Frame(frame) {}
+    /// Specify a new seed and restart the draws of the current frame.
+    void seed(unsigned int value) override { Key[0] = value; Draw = 0; }
+    double GetUniformRandomNumber(void) override;
+    double GetNormalRandomNumber(void) override;
+    /** Get the uniform random number of a given draw of a given frame. This
+     * does not modify the state of the generator. */
+    double GetUniformRandomNumber(unsigned int frame, unsigned int index) const;
+    /** Get the normal random number of a given draw of a given frame. This
+     * does not modify the state of the generator. */
+    double GetNormalRandomNumber(unsigned int frame, unsigned int index) const;
+    std::string GetState(void) const override;
+    void SetState(const std::string& state) override;
+    /** The Philox4x32-10 function. It is defined inline so that loops calling
+     * it can be vectorized. */
+    static Block Philox(Block counter, std::array<uint32_t, 2> key) {
+      constexpr uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+      constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+      for (unsigned int round=0; round<10; ++round) {
+        if (round > 0) {
+          key[0] += W0;
+          key[1] += W1;
+        }
+        uint64_t p0 = M0*counter[0];
+        uint64_t p1 = M1*counter[2];
+        counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                   static_cast<uint32_t>(p1),
+                   static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                   static_cast<uint32_t>(p0)};
+      }
+
+      return counter;
+    }
+    /// Converts two 32 bits words to a double in [0;1( with 53 significant bits.
+    static double ToUnitInterval(uint32_t high, uint32_t low) {
+      uint64_t bits = (static_cast<uint64_t>(high) << 32 | low) >> 11;
+      return bits * 0x1p-53;
+    }
+    /** Box-Muller transform of the two uniform numbers held by a Philox block
+     * into two independent normal numbers n0 and n1. */
+    static void BoxMuller(const Block& r, double& n0, double& n1) {
+      double u1 = 1.0 - ToUnitInterval(r[0], r[1]); // in ]0;1] for the logarithm
+      double u2 = 2.0*M_PI*ToUnitInterval(r[2], r[3]);
+      double radius = sqrt(-2.0*log(u1));
+      n0 = radius*cos(u2);
+      n1 = radius*sin(u2);
+    }
+  private:
+    std::array<uint32_t, 2> Key;
+    const unsigned int& Frame;
+    unsigned int LastFrame = 0;
+    unsigned int Draw = 0;
+
+    unsigned int NextDraw(void);
+};
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
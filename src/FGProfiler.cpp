@@ -0,0 +1,224 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGProfiler.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Measure the time spent in the models, FCS and functions.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+#include "FGProfiler.h"
+#include "input_output/FGPropertyManager.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+  // Turn a path into a valid property path: each level must start with a
+  // letter or an underscore and contain only alphanumeric characters, '_',
+  // '-' and '.'.
+  string MakeProfilePath(const string& path)
+  {
+    string result;
+    bool levelStart = true;
+
+    for (char c: path) {
+      if (c == '/') {
+        if (!levelStart) {
+          result += '/';
+          levelStart = true;
+        }
+        continue;
+      }
+
+      if (isspace(static_cast<unsigned char>(c)))
+        c = '-';
+      else if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-'
+               && c != '.')
+        c = '_';
+
+      if (levelStart && !isalpha(static_cast<unsigned char>(c)) && c != '_')
+        result += '_';
+
+      result += c;
+      levelStart = false;
+    }
+
+    if (!result.empty() && result.back() == '/') result.pop_back();
+
+    return result;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Timer::Add(double duration)
+{
+  if (Calls == 0 || duration < Min) Min = duration;
+  if (duration > Max) Max = duration;
+  Total += duration;
+  ++Calls;
+
+  double ns = duration*1E9;
+  int idx = 0;
+  if (ns > 1.0)
+    idx = min(static_cast<int>(log2(ns)*BucketsPerOctave), NumBuckets-1);
+  ++Histogram[idx];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Timer::Reset(void)
+{
+  Calls = 0;
+  Total = Min = Max = 0.0;
+  Histogram.fill(0);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGProfiler::Timer::GetMean(void) const
+{
+  return Calls ? Total*1E6/Calls : 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGProfiler::Timer::GetPercentile(int percent) const
+{
+  if (Calls == 0) return 0.0;
+
+  // Rank of the call duration in the sorted list of durations.
+  unsigned long long rank = static_cast<unsigned long long>(ceil(Calls*percent/100.0));
+  rank = max(rank, 1ULL);
+
+  unsigned long long count = 0;
+  int idx = 0;
+  for (; idx < NumBuckets-1; ++idx) {
+    count += Histogram[idx];
+    if (count >= rank) break;
+  }
+
+  // The duration is estimated by the geometric center of the bucket.
+  double duration = idx ? exp2((idx+0.5)/BucketsPerOctave)*1E-9 : Min;
+  return min(max(duration, Min), Max)*1E6;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGProfiler::FGProfiler(std::shared_ptr<FGPropertyManager> pm)
+  : PropertyManager(pm)
+{
+  PropertyManager->Tie("simulation/profile/enabled", this,
+                       &FGProfiler::IsEnabled, &FGProfiler::SetEnabled);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGProfiler::Timer* FGProfiler::AddTimer(const void* owner, const string& path)
+{
+  string name = MakeProfilePath(path);
+  auto [it, created] = Timers.try_emplace(name);
+  Timer* timer = &it->second;
+  Owners[owner] = timer;
+
+  if (created) {
+    string base = "simulation/profile/" + name + "/";
+    PropertyManager->Tie(base + "calls", timer, &Timer::GetCalls);
+    PropertyManager->Tie(base + "total-sec", timer, &Timer::GetTotal);
+    PropertyManager->Tie(base + "mean-us", timer, &Timer::GetMean);
+    PropertyManager->Tie(base + "min-us", timer, &Timer::GetMin);
+    PropertyManager->Tie(base + "max-us", timer, &Timer::GetMax);
+    PropertyManager->Tie(base + "p50-us", timer, 50, &Timer::GetPercentile);
+    PropertyManager->Tie(base + "p95-us", timer, 95, &Timer::GetPercentile);
+    PropertyManager->Tie(base + "p99-us", timer, 99, &Timer::GetPercentile);
+  }
+
+  return timer;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::Reset(void)
+{
+  for (auto& [name, timer]: Timers)
+    timer.Reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGProfiler::WriteJSON(ostream& out) const
+{
+  auto flags = out.flags();
+  auto precision = out.precision(9);
+
+  out << "{";
+  bool first = true;
+  for (const auto& [name, timer]: Timers) {
+    out << (first ? "\n" : ",\n");
+    first = false;
+    out << "  \"" << name << "\": {"
+        << "\"calls\": " << static_cast<unsigned long long>(timer.GetCalls())
+        << ", \"total-sec\": " << timer.GetTotal()
+        << ", \"mean-us\": " << timer.GetMean()
+        << ", \"min-us\": " << timer.GetMin()
+        << ", \"max-us\": " << timer.GetMax()
+        << ", \"p50-us\": " << timer.GetPercentile(50)
+        << ", \"p95-us\": " << timer.GetPercentile(95)
+        << ", \"p99-us\": " << timer.GetPercentile(99) << "}";
+  }
+  out << "\n}\n";
+
+  out.precision(precision);
+  out.flags(flags);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGProfiler::WriteJSON(const SGPath& path) const
+{
+  sg_ofstream out(path);
+  if (!out.is_open()) return false;
+
+  WriteJSON(out);
+  return out.good();
+}
+
+} // namespace JSBSim
@@ -0,0 +1,201 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGProfiler.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGPROFILER_H
+#define FGPROFILER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <array>
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "JSBSim_API.h"
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGPropertyManager;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Measures the wall-clock time spent in the models, the FCS channels, the FCS
+    components and the aerodynamic functions.
+
+    The profiler is owned by FGFDMExec and is disabled by default. It is
+    enabled with the property <tt>simulation/profile/enabled</tt> (or with
+    SetEnabled()) and, from then on, each profiled section accumulates its
+    number of calls, total, minimum and maximum durations and a log-scale
+    histogram of its durations from which percentiles are estimated with a
+    relative error lower than 5%.
+
+    The statistics of a section are exposed as properties under
+    <tt>simulation/profile/</tt>:
+    - <tt>models/<i>name</i>/</tt> for the models run by FGFDMExec,
+    - <tt>fcs/<i>channel</i>/</tt> for the FCS channels,
+    - <tt>fcs/<i>channel</i>/<i>component</i>/</tt> for the FCS components,
+    - <tt>aero/<i>function</i>/</tt> for the aerodynamic functions,
+
+    each of which holds the properties <tt>calls</tt>, <tt>total-sec</tt>,
+    <tt>mean-us</tt>, <tt>min-us</tt>, <tt>max-us</tt>, <tt>p50-us</tt>,
+    <tt>p95-us</tt> and <tt>p99-us</tt>. The statistics can also be written in
+    JSON format with WriteJSON(). FGFDMExec writes them when it is destroyed
+    if a file name has been supplied with FGFDMExec::SetProfileOutput().
+
+    When disabled, the profiler costs a single test per profiled loop.
+    @author The JSBSim team
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGProfiler
+{
+public:
+  /// Timing statistics of a profiled section.
+  class JSBSIM_API Timer {
+  public:
+    /// Records a call that lasted the specified duration in seconds.
+    void Add(double duration);
+    /// Clears the statistics.
+    void Reset(void);
+
+    double GetCalls(void) const { return static_cast<double>(Calls); }
+    /// Returns the total time spent in the section in seconds.
+    double GetTotal(void) const { return Total; }
+    /// Returns the mean duration of a call in microseconds.
+    double GetMean(void) const;
+    /// Returns the minimum duration of a call in microseconds.
+    double GetMin(void) const { return Calls ? Min*1E6 : 0.0; }
+    /// Returns the maximum duration of a call in microseconds.
+    double GetMax(void) const { return Max*1E6; }
+    /** Returns an estimate of a percentile of the call durations.
+        @param percent the percentile (from 0 to 100)
+        @return the duration in microseconds */
+    double GetPercentile(int percent) const;
+
+  private:
+    // The histogram buckets are 1/16th of an octave wide starting at 1ns.
+    static constexpr int BucketsPerOctave = 16;
+    static constexpr int NumBuckets = 40*BucketsPerOctave;
+
+    unsigned long long Calls = 0;
+    double Total = 0.0;
+    double Min = 0.0;
+    double Max = 0.0;
+    std::array<unsigned long long, NumBuckets> Histogram {};
+  };
+
+  /** Measures the time elapsed between its construction and its destruction.
+      A null timer is accepted and makes the scope a no-op. */
+  class Scope {
+  public:
+    explicit Scope(Timer* t) : timer(t) {
+      if (timer) start = std::chrono::steady_clock::now();
+    }
+    ~Scope() {
+      if (timer) {
+        std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+        timer->Add(dt.count());
+      }
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    Timer* timer;
+    std::chrono::steady_clock::time_point start;
+  };
+
+  /** Constructor.
+      @param pm the property manager in which the statistics are exposed. */
+  explicit FGProfiler(std::shared_ptr<FGPropertyManager> pm);
+
+  void SetEnabled(bool enabled) { Enabled = enabled; }
+  bool IsEnabled(void) const { return Enabled; }
+
+  /** Returns the timer of a section.
+      The timer is looked up from the address of the object which execution is
+      profiled so that its path is only built the first time the object is
+      profiled.
+      @param owner the address of the profiled object.
+      @param makePath a callable returning the path of the timer relative to
+                      simulation/profile. It is only called when the timer is
+                      created.
+      @return the timer */
+  template <typename F>
+  Timer* GetTimer(const void* owner, F&& makePath) {
+    auto it = Owners.find(owner);
+    if (it != Owners.end()) return it->second;
+    return AddTimer(owner, makePath());
+  }
+
+  /// Clears the statistics of all the timers.
+  void Reset(void);
+
+  /** Forgets the objects associated to the timers. This must be called when
+      the profiled objects are destroyed so that their addresses are not
+      mistaken for the objects that may be created later on at the same
+      addresses. The timers and their statistics are kept. */
+  void ClearOwners(void) { Owners.clear(); }
+
+  /// Writes the statistics of all the timers in JSON format.
+  void WriteJSON(std::ostream& out) const;
+  /** Writes the statistics of all the timers in a JSON file.
+      @return false if the file could not be opened. */
+  bool WriteJSON(const SGPath& path) const;
+
+private:
+  std::shared_ptr<FGPropertyManager> PropertyManager;
+  bool Enabled = false;
+  std::map<std::string, Timer> Timers;
+  std::unordered_map<const void*, Timer*> Owners;
+
+  Timer* AddTimer(const void* owner, const std::string& path);
+};
+} // namespace JSBSim
+
+#endif
@@ -91,6 +91,7 @@ SGPath ScriptName;
 string AircraftName;
 SGPath ResetName;
 SGPath PlanetName;
+SGPath ProfileName;
 vector <string> LogOutputName;
 vector <SGPath> LogDirectiveName;
 vector <string> CommandLineProperties;
@@ -365,6 +366,7 @@ int real_main(int argc, char* argv[])
   AircraftName = "";
   ResetName = "";
   PlanetName = "";
+  ProfileName = "";
   OutputPath = SGPath(".");
   LogOutputName.clear();
   LogDirectiveName.clear();
@@ -397,6 +399,10 @@ int real_main(int argc, char* argv[])
   FDMExec->SetEnginePath(SGPath("engine"));
   FDMExec->SetSystemsPath(SGPath("systems"));
   FDMExec->SetOutputPath(OutputPath);
+  if (!ProfileName.isNull()) {
+    FDMExec->GetProfiler()->SetEnabled(true);
+    FDMExec->SetProfileOutput(ProfileName);
+  }
   FDMExec->GetPropertyManager()->Tie("simulation/frame_start_time", &actual_elapsed_time);
   FDMExec->GetPropertyManager()->Tie("simulation/cycle_duration", &cycle_duration);
 
@@ -749,6 +755,13 @@ bool options(int count, char **arg)
         gripe;
         exit(1);
       }
+    } else if (keyword == "--profile") {
+      if (n != string::npos) {
+        ProfileName = SGPath::fromLocal8Bit(value.c_str());
+      } else {
+        gripe;
+        exit(1);
+      }
     } else if (keyword == "--property") {
       if (n != string::npos) {
         string propName = value.substr(0,value.find("="));
@@ -867,6 +880,8 @@ void PrintHelp(void)
     cout << "    --catalog specifies that all properties for this aircraft model should be printed" << endl;
     cout << "              (catalog=aircraftname is an optional format)" << endl;
     cout << "    --property=<name=value> e.g. --property=simulation/integrator/rate/rotational=1" << endl;
+    cout << "    --profile=<filename>  measures the time spent in the models, FCS and aero functions" << endl;
+    cout << "                          and writes the statistics to a JSON file at exit" << endl;
     cout << "    --simulation-rate=<rate (double)> specifies the sim dT time or frequency" << endl;
     cout << "                      If rate specified is less than 1, it is interpreted as" << endl;
     cout << "                      a time step size, otherwise it is assumed to be a rate in Hertz." << endl;
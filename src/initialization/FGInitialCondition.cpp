@@ -54,6 +54,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/string_utilities.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -1450,6 +1451,16 @@ bool FGInitialCondition::Load_v2(Element* document)
 
 //******************************************************************************
 
+void FGInitialCondition::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(vUVW_NED, vPQR_body, position, orientation, vt, targetNlfIC);
+  snapshot(Tw2b, Tb2w, alpha, beta, epa);
+  snapshot(lastSpeedSet, lastAltitudeSet, lastLatitudeSet, enginesRunning,
+           trimRequested);
+}
+
+//******************************************************************************
+
 void FGInitialCondition::bind(FGPropertyManager* PropertyManager)
 {
   PropertyManager->Tie("ic/vc-kts", this,
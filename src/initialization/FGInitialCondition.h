@@ -66,6 +66,7 @@ class FGAircraft;
 class FGAuxiliary;
 class FGPropertyManager;
 class Element;
+class FGSnapshot;
 
 typedef enum { setvt, setvc, setve, setmach, setuvw, setned, setvg } speedset;
 typedef enum { setasl, setagl } altitudeset;
@@ -687,6 +688,10 @@ public:
   /** Initialize the initial conditions to default values */
   void InitializeIC(void);
 
+  /** Saves or restores the initial conditions.
+      @see FGSnapshot */
+  void SerializeState(FGSnapshot& snapshot);
+
   void bind(FGPropertyManager* pm);
 
 private:
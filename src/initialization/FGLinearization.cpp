@@ -23,7 +23,7 @@
 
 namespace JSBSim {
 
-FGLinearization::FGLinearization(FGFDMExec * fdm)
+FGLinearization::FGLinearization(FGFDMExec * fdm, unsigned int nthreads)
     : aircraft_name(fdm->GetAircraft()->GetAircraftName())
 {
     FGStateSpace ss(fdm);
@@ -72,7 +72,7 @@ FGLinearization::FGLinearization(FGFDMExec * fdm)
     y0 = x0; // state feedback
 
     fdm->SuspendIntegration();
-    ss.linearize(x0, u0, y0, A, B, C, D);
+    ss.linearize(x0, u0, y0, A, B, C, D, nthreads);
     fdm->ResumeIntegration();
 
     x_names = ss.x.getName();
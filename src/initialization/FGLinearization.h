@@ -45,8 +45,13 @@ class JSBSIM_API FGLinearization
 public:
     /**
      * @param fdmPtr Already configured FGFDMExec instance used to create the new linear model.
+     * @param nthreads Number of threads used to compute the columns of the
+     *                 state space matrices. Each additional thread works on a
+     *                 clone of fdmPtr (see FGFDMExec::Clone()) so this only
+     *                 pays off when the model is large enough for the cost of
+     *                 the clones to be recovered.
      */
-    FGLinearization(FGFDMExec * fdmPtr);
+    FGLinearization(FGFDMExec * fdmPtr, unsigned int nthreads = 1);
 
     /**
      * Write Scicoslab source file with the state space model to a
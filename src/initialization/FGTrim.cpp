@@ -118,6 +118,33 @@ void FGTrim::TrimStats() {
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+unsigned int FGTrim::GetSubIterations(void) const {
+  double sum=0;
+  for (double its: sub_iterations)
+    sum += its;
+  return static_cast<unsigned int>(sum);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<double> FGTrim::GetControls(void) {
+  vector<double> controls;
+  for (auto& axis: TrimAxes)
+    controls.push_back(axis.GetControl());
+  return controls;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<string> FGTrim::GetControlNames(void) {
+  vector<string> names;
+  for (auto& axis: TrimAxes)
+    names.push_back(axis.GetControlName());
+  return names;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGTrim::Report(void) {
   FGLogging out(LogLevel::STDOUT);
   out << "  Trim Results:\n";
@@ -227,6 +254,14 @@ bool FGTrim::DoTrim(void) {
     TrimAxes[2].SetControlLimits(phi - 30.0 * degtorad, phi + 30.0 * degtorad);
   }
 
+  bool warm_start = !initial_controls.empty();
+  if (warm_start && initial_controls.size() != TrimAxes.size()) {
+    FGLogging log(LogLevel::WARN);
+    log << "  " << initial_controls.size() << " initial controls supplied for "
+        << TrimAxes.size() << " axes. Ignoring them.\n";
+    warm_start = false;
+  }
+
   //clear the sub iterations counts & zero out the controls
   for(unsigned int current_axis=0;current_axis<TrimAxes.size();current_axis++) {
     //FGLogging log(LogLevel::INFO);
@@ -234,12 +269,19 @@ bool FGTrim::DoTrim(void) {
     //<< "  " << TrimAxes[current_axis]->GetControlName()<< "\n";
     xlo=TrimAxes[current_axis].GetControlMin();
     xhi=TrimAxes[current_axis].GetControlMax();
-    TrimAxes[current_axis].SetControl((xlo+xhi)/2);
-    TrimAxes[current_axis].Run();
-    //TrimAxes[current_axis].AxisReport();
     sub_iterations[current_axis]=0;
     successful[current_axis]=0;
-    solution[current_axis]=false;
+    if (warm_start) {
+      // Start from the supplied values and bracket the solution around them
+      // rather than from the control limits.
+      TrimAxes[current_axis].SetControl(Constrain(xlo, initial_controls[current_axis], xhi));
+      solution[current_axis]=true;
+    } else {
+      TrimAxes[current_axis].SetControl((xlo+xhi)/2);
+      solution[current_axis]=false;
+    }
+    TrimAxes[current_axis].Run();
+    //TrimAxes[current_axis].AxisReport();
   }
 
   if(mode == tPullup ) {
@@ -260,6 +302,12 @@ bool FGTrim::DoTrim(void) {
       setDebug(TrimAxes[current_axis]);
       updateRates();
       Nsub=0;
+      // When warm started, the axes that are already trimmed are left alone
+      // instead of being bracketed again.
+      if (warm_start) {
+        TrimAxes[current_axis].Run();
+        if (TrimAxes[current_axis].InTolerance()) continue;
+      }
       if(!solution[current_axis]) {
         if(checkLimits(TrimAxes[current_axis])) {
           solution[current_axis]=true;
@@ -139,6 +139,7 @@ class JSBSIM_API FGTrim : public FGJSBBase
   double xlo,xhi,alo,ahi;
   double targetNlf;
   int debug_axis;
+  std::vector<double> initial_controls;
 
   double psidot;
 
@@ -288,6 +289,42 @@ public:
   inline void SetTargetNlf(double nlf) { targetNlf=nlf; }
   inline double GetTargetNlf(void) { return targetNlf; }
 
+  /** Set the values from which the controls are iterated (warm start).
+      By default, each control starts from the middle of its range and its
+      solution is bracketed from the control limits. When initial values are
+      supplied, typically the trimmed controls of a nearby flight condition,
+      the controls start from these values and the solution is bracketed by
+      searching around them. The axes that are within tolerance at the start
+      of an iteration are not solved again. This saves a large part of the
+      iterations when the guess is close to the solution.
+      @param controls one value per state-control pair, in the order in which
+                      the pairs are configured (see GetControls()). The values
+                      are constrained within the control limits. An empty
+                      vector restores the default behavior.
+  */
+  void SetInitialControls(const std::vector<double>& controls)
+  { initial_controls = controls; }
+
+  /** Get the values of the controls, in the order in which the state-control
+      pairs are configured. After a successful trim, these are the trimmed
+      values which can be supplied to SetInitialControls() to warm start the
+      trim of another flight condition.
+  */
+  std::vector<double> GetControls(void);
+
+  /** Get the names of the controls, in the order in which the state-control
+      pairs are configured.
+  */
+  std::vector<std::string> GetControlNames(void);
+
+  /// Get the number of top-level iterations executed by the last trim.
+  unsigned int GetIterations(void) const { return total_its; }
+
+  /** Get the number of per-axis iterations executed by the last trim,
+      summed over all the axes.
+  */
+  unsigned int GetSubIterations(void) const;
+
 };
 }
 
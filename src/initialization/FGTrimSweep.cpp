@@ -0,0 +1,407 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTrimSweep.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Trim and linearize an aircraft over a grid of flight conditions.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+The points of a grid of flight conditions are trimmed by a pool of worker
+threads, each of which owns an FGFDMExec instance. Each trim is warm started
+from the controls of a converged neighbour.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "FGTrimSweep.h"
+#include "FGFDMExec.h"
+#include "FGLinearization.h"
+#include "simgear/io/iostreams/sgstream.hxx"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace {
+void AppendMatrix(vector<string>& columns, const string& name,
+                  const vector<string>& rows, const vector<string>& cols)
+{
+  for (auto& r: rows)
+    for (auto& c: cols)
+      columns.push_back(name + "[" + r + "][" + c + "]");
+}
+
+// Streams the results to a CSV file. The columns of the controls and of the
+// matrices are only known once a point has been successfully trimmed so the
+// header is written along with the first successful point and the rows of the
+// points that fail before are held until then.
+class CSVWriter {
+public:
+  CSVWriter(const SGPath& path, const vector<string>& fixedColumns)
+    : out(path), columns(fixedColumns), headerWritten(false) {}
+
+  bool IsOpen(void) const { return out.is_open(); }
+
+  void Write(const string& row, size_t fields,
+             const vector<string>* extraColumns) {
+    if (!headerWritten) {
+      if (!extraColumns) {
+        pending.emplace_back(row, fields);
+        return;
+      }
+      WriteHeader(*extraColumns);
+    }
+    WriteRow(row, fields);
+  }
+
+  void Close(void) {
+    if (!headerWritten) WriteHeader({});
+    out.close();
+  }
+
+private:
+  sg_ofstream out;
+  vector<string> columns;
+  bool headerWritten;
+  vector<pair<string, size_t>> pending;
+
+  void WriteHeader(const vector<string>& extraColumns) {
+    columns.insert(columns.end(), extraColumns.begin(), extraColumns.end());
+
+    for (size_t i=0; i < columns.size(); ++i)
+      out << (i ? "," : "") << columns[i];
+    out << "\n";
+    headerWritten = true;
+
+    for (auto& [row, fields]: pending)
+      WriteRow(row, fields);
+    pending.clear();
+  }
+
+  void WriteRow(const string& row, size_t fields) {
+    out << row;
+    for (size_t i=fields; i < columns.size(); ++i)
+      out << ",";
+    out << "\n";
+    out.flush();
+  }
+};
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTrimSweep::FGTrimSweep(const SGPath& rootDir, unsigned int nthreads)
+  : RootDir(rootDir), AircraftPath("aircraft"), EnginePath("engine"),
+    SystemsPath("systems"), NumThreads(nthreads), Mode(tLongitudinal),
+    WarmStart(true), Linearize(false)
+{
+  if (NumThreads == 0)
+    NumThreads = max(thread::hardware_concurrency(), 1u);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTrimSweep::AddAxis(const string& property, const vector<double>& values)
+{
+  if (values.empty())
+    throw BaseException("The axis " + property + " has no values.");
+
+  Axes.emplace_back(property, values);
+  return Axes.size() - 1;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGTrimSweep::GetNumPoints(void) const
+{
+  size_t n = 1;
+  for (auto& axis: Axes)
+    n *= axis.second.size();
+  return n;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<size_t> FGTrimSweep::GetIndices(size_t index) const
+{
+  vector<size_t> indices(Axes.size());
+  for (size_t i=Axes.size(); i-- > 0;) {
+    size_t n = Axes[i].second.size();
+    indices[i] = index % n;
+    index /= n;
+  }
+  return indices;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<double> FGTrimSweep::GetPoint(size_t index) const
+{
+  if (index >= GetNumPoints())
+    throw BaseException("The grid has no point " + to_string(index) + ".");
+
+  vector<size_t> indices = GetIndices(index);
+  vector<double> point(Axes.size());
+  for (size_t i=0; i < Axes.size(); ++i)
+    point[i] = Axes[i].second[indices[i]];
+  return point;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTrimSweep::TrimPoint(FGFDMExec& fdmex, const FGInitialCondition& ic,
+                            size_t index, const vector<double>& guess,
+                            FGTrimSweepResult& result, Layout& layout) const
+{
+  try {
+    vector<double> point = GetPoint(index);
+
+    // A failed warm started trim is retried from the middle of the control
+    // ranges.
+    for (bool warm: {!guess.empty(), false}) {
+      *fdmex.GetIC() = ic;
+
+      for (size_t i=0; i < Axes.size(); ++i)
+        fdmex.SetPropertyValue(Axes[i].first, point[i]);
+
+      if (!fdmex.RunIC()) {
+        result.error = "Failed to initialize the simulation.";
+        return;
+      }
+
+      FGTrim trim(&fdmex, Mode);
+      if (warm) trim.SetInitialControls(guess);
+
+      result.success = trim.DoTrim();
+      result.warm_start = warm;
+      result.iterations += trim.GetIterations();
+      result.sub_iterations += trim.GetSubIterations();
+      result.controls = trim.GetControls();
+      layout.controls = trim.GetControlNames();
+
+      if (result.success || !warm) break;
+    }
+
+    if (!result.success) {
+      result.error = "Trim failed.";
+      return;
+    }
+
+    result.values.reserve(OutputProperties.size());
+    for (auto& name: OutputProperties)
+      result.values.push_back(fdmex.GetPropertyValue(name));
+
+    if (Linearize) {
+      FGLinearization lin(&fdmex);
+      result.A = lin.GetSystemMatrix();
+      result.B = lin.GetInputMatrix();
+      result.C = lin.GetOutputMatrix();
+      result.D = lin.GetFeedforwardMatrix();
+      layout.states = lin.GetStateNames();
+      layout.inputs = lin.GetInputNames();
+      layout.outputs = lin.GetOutputNames();
+    }
+  } catch (const exception& e) {
+    result.success = false;
+    result.error = e.what();
+  } catch (const string& msg) {
+    result.success = false;
+    result.error = msg;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+vector<FGTrimSweepResult> FGTrimSweep::Run(void)
+{
+  size_t npoints = GetNumPoints();
+  vector<FGTrimSweepResult> results(npoints);
+
+  // The points are dispatched by lines along the last axis.
+  size_t lineLength = Axes.empty() ? 1 : Axes.back().second.size();
+  size_t nlines = npoints / lineLength;
+  unsigned int nworkers = min<size_t>(NumThreads, nlines);
+
+  ControlNames.clear();
+  StateNames.clear();
+  InputNames.clear();
+  OutputNames.clear();
+
+  unique_ptr<CSVWriter> writer;
+  if (!OutputFile.isNull()) {
+    vector<string> columns {"point"};
+    for (auto& axis: Axes) columns.push_back(axis.first);
+    columns.insert(columns.end(), {"success", "warm-start", "iterations",
+                                   "sub-iterations"});
+    columns.insert(columns.end(), OutputProperties.begin(),
+                   OutputProperties.end());
+    writer = make_unique<CSVWriter>(OutputFile, columns);
+    if (!writer->IsOpen())
+      throw BaseException("Could not open the file " + OutputFile.utf8Str());
+  }
+
+  // The mutex protects the completion flags, the output file and the names of
+  // the columns. A result is written by the worker that trims the point before
+  // the point is flagged as completed, after which it is only read.
+  mutex lock;
+  vector<bool> completed(npoints, false);
+  atomic<size_t> nextLine(0);
+  bool layoutKnown = false;
+  vector<string> extraColumns;
+  vector<size_t> strides(Axes.size(), 1);
+  for (size_t i=Axes.size(); i-- > 1;)
+    strides[i-1] = strides[i]*Axes[i].second.size();
+
+  // Returns the controls of a converged neighbour of a point. The neighbours
+  // along the last axis are tried first since they are trimmed by the same
+  // thread.
+  auto findGuess = [&](size_t index) {
+    vector<double> guess;
+    if (!WarmStart) return guess;
+
+    vector<size_t> indices = GetIndices(index);
+    lock_guard<mutex> guard(lock);
+    for (size_t i=Axes.size(); i-- > 0;) {
+      if (indices[i] > 0) {
+        size_t j = index - strides[i];
+        if (completed[j] && results[j].success) return results[j].controls;
+      }
+      if (indices[i]+1 < Axes[i].second.size()) {
+        size_t j = index + strides[i];
+        if (completed[j] && results[j].success) return results[j].controls;
+      }
+    }
+    return guess;
+  };
+
+  auto complete = [&](size_t index, const Layout& layout) {
+    const FGTrimSweepResult& r = results[index];
+    lock_guard<mutex> guard(lock);
+    completed[index] = true;
+
+    if (r.success && !layoutKnown) {
+      ControlNames = layout.controls;
+      StateNames = layout.states;
+      InputNames = layout.inputs;
+      OutputNames = layout.outputs;
+      layoutKnown = true;
+
+      extraColumns = ControlNames;
+      AppendMatrix(extraColumns, "A", StateNames, StateNames);
+      AppendMatrix(extraColumns, "B", StateNames, InputNames);
+      AppendMatrix(extraColumns, "C", OutputNames, StateNames);
+      AppendMatrix(extraColumns, "D", OutputNames, InputNames);
+    }
+
+    if (!writer) return;
+
+    // The output values, controls and matrices are only written for the
+    // points that succeeded. The other rows are padded with empty fields.
+    ostringstream row;
+    row.precision(10);
+    row << index;
+    for (double v: GetPoint(index)) row << "," << v;
+    row << "," << r.success << "," << r.warm_start << "," << r.iterations
+        << "," << r.sub_iterations;
+    size_t fields = Axes.size() + 5;
+    if (r.success) {
+      for (double v: r.values) row << "," << v;
+      for (double v: r.controls) row << "," << v;
+      for (auto M: {&r.A, &r.B, &r.C, &r.D})
+        for (auto& line: *M)
+          for (double v: line) row << "," << v;
+      fields += OutputProperties.size() + extraColumns.size();
+    }
+    writer->Write(row.str(), fields, r.success ? &extraColumns : nullptr);
+  };
+
+  auto worker = [&]() {
+    if (LoggerFactory) SetLogger(LoggerFactory());
+
+    FGFDMExec fdmex;
+    unique_ptr<FGInitialCondition> ic;
+    string error;
+
+    try {
+      fdmex.SetRootDir(RootDir);
+      fdmex.SetAircraftPath(AircraftPath);
+      fdmex.SetEnginePath(EnginePath);
+      fdmex.SetSystemsPath(SystemsPath);
+      if (!fdmex.LoadModel(Model))
+        error = "Failed to load the aircraft " + Model;
+      else if (!InitFile.isNull() && !fdmex.GetIC()->Load(InitFile))
+        error = "Failed to load the initialization file " + InitFile.utf8Str();
+      fdmex.DisableOutput();
+      fdmex.DisableInput();
+
+      // The initial conditions are restored from a copy before each point
+      // rather than parsed again from the file.
+      ic = make_unique<FGInitialCondition>(*fdmex.GetIC());
+    } catch (const exception& e) {
+      error = e.what();
+    } catch (const string& msg) {
+      error = msg;
+    }
+
+    while (true) {
+      size_t line = nextLine++;
+      if (line >= nlines) break;
+
+      for (size_t index=line*lineLength; index < (line+1)*lineLength; ++index) {
+        Layout layout;
+        if (error.empty())
+          TrimPoint(fdmex, *ic, index, findGuess(index), results[index], layout);
+        else
+          results[index].error = error;
+        complete(index, layout);
+      }
+    }
+  };
+
+  vector<thread> threads;
+  threads.reserve(nworkers);
+  for (unsigned int i=0; i < nworkers; ++i)
+    threads.emplace_back(worker);
+
+  for (auto& t: threads) t.join();
+
+  if (writer) writer->Close();
+
+  return results;
+}
+}
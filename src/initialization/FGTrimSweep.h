@@ -0,0 +1,245 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTrimSweep.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTRIMSWEEP_H
+#define FGTRIMSWEEP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "FGTrim.h"
+#include "simgear/misc/sg_path.hxx"
+#include "input_output/FGLog.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGFDMExec;
+
+/// Outcome of the trim of a grid point by FGTrimSweep.
+struct FGTrimSweepResult {
+  /// true if the point has been trimmed (and linearized, if requested).
+  bool success = false;
+  /// Error message when the point failed.
+  std::string error;
+  /// true if the trim has been started from the controls of a neighbour.
+  bool warm_start = false;
+  /// Number of top-level trim iterations (see FGTrim::GetIterations()).
+  unsigned int iterations = 0;
+  /// Number of per-axis trim iterations (see FGTrim::GetSubIterations()).
+  unsigned int sub_iterations = 0;
+  /// Values of the trim controls (see FGTrim::GetControls()).
+  std::vector<double> controls;
+  /// Values of the properties requested with SetOutputProperties().
+  std::vector<double> values;
+  /** State space matrices of the linearized model (see FGLinearization).
+      They are empty unless the linearization is enabled. */
+  std::vector<std::vector<double>> A, B, C, D;
+};
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Trims and linearizes an aircraft over a grid of flight conditions.
+    The grid is the cartesian product of the axes added with AddAxis(). Each
+    axis is a property (an initial condition such as <tt>ic/h-sl-ft</tt> or
+    <tt>ic/vc-kts</tt>, a point mass weight or location, a flap command, etc.)
+    and the list of values that it takes in the sweep. The points are numbered
+    in row-major order: the last axis added varies the fastest.
+
+    For each point, the initialization file is loaded, the axes properties are
+    set, the simulation is initialized with FGFDMExec::RunIC() and FGTrim is
+    run. The trimmed state can then be linearized with FGLinearization.
+
+    The points are trimmed in parallel by a pool of threads. Each thread owns
+    an FGFDMExec instance in which the model is loaded once and which is then
+    reused for all the points that the thread trims. The threads process the
+    grid by lines along the last axis so that each point but the first of a
+    line follows its neighbour in the same thread.
+
+    Each trim is warm started (see FGTrim::SetInitialControls()) from the
+    controls of a converged neighbour (a point which indices differ by one along
+    a single axis) when one is available. A warm started trim that fails is
+    retried from scratch. Since neighbours are only available once they are
+    trimmed, the set of warm started points depends on the scheduling of the
+    threads.
+
+    The results are returned by Run() and, if a file name is supplied with
+    SetOutputFile(), streamed to a CSV file as soon as each point is
+    processed. The file has one column per axis, trim statistic, control,
+    output property and matrix coefficient, and one row per point. The rows
+    are written in the order in which the points complete so the first
+    column holds the index of the point in the grid.
+
+    @code{.cpp}
+    FGTrimSweep sweep(SGPath("/path/to/jsbsim"));
+    sweep.SetModel("737");
+    sweep.SetInitFile(SGPath("cruise_init"));
+    sweep.AddAxis("ic/h-sl-ft", {20000., 25000., 30000.});
+    sweep.AddAxis("ic/vt-fps", {650., 700., 750., 800.});
+    sweep.SetLinearization(true);
+    sweep.SetOutputFile(SGPath("sweep.csv"));
+
+    auto results = sweep.Run(); // results[i] is the outcome of the i-th point
+    @endcode
+
+    @author The JSBSim team
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTrimSweep
+{
+public:
+  /** Constructor
+      @param rootDir the root directory from which relative paths are resolved
+      @param nthreads the number of worker threads. If 0, the number of
+                      hardware threads is used. */
+  FGTrimSweep(const SGPath& rootDir, unsigned int nthreads = 0);
+
+  /// Set the path to the aircraft directory (relative to the root directory).
+  void SetAircraftPath(const SGPath& path) { AircraftPath = path; }
+  /// Set the path to the engine directory (relative to the root directory).
+  void SetEnginePath(const SGPath& path) { EnginePath = path; }
+  /// Set the path to the systems directory (relative to the root directory).
+  void SetSystemsPath(const SGPath& path) { SystemsPath = path; }
+
+  /// Set the name of the aircraft model.
+  void SetModel(const std::string& model) { Model = model; }
+  /** Set the initialization file loaded before each point is set up. Relative
+      paths are looked for in the aircraft directory. */
+  void SetInitFile(const SGPath& initfile) { InitFile = initfile; }
+
+  /// Set the trim mode (tLongitudinal by default).
+  void SetTrimMode(TrimMode mode) { Mode = mode; }
+  /// Enable or disable the warm start of the trims (enabled by default).
+  void SetWarmStart(bool enabled) { WarmStart = enabled; }
+  /// Enable or disable the linearization of the trimmed points.
+  void SetLinearization(bool enabled) { Linearize = enabled; }
+
+  /** Set the properties which values are collected after each trim. The
+      values are returned in FGTrimSweepResult::values in the same order. */
+  void SetOutputProperties(const std::vector<std::string>& names)
+  { OutputProperties = names; }
+
+  /** Set the name of the CSV file to which the results are streamed. An empty
+      path (the default) disables the file output. */
+  void SetOutputFile(const SGPath& path) { OutputFile = path; }
+
+  /** Set the factory of the loggers used by the worker threads. The factory is
+      called once by each worker thread when it starts. By default, the worker
+      threads log to the console. */
+  void SetLoggerFactory(std::function<FGLogger_ptr(void)> factory)
+  { LoggerFactory = factory; }
+
+  /** Add an axis to the grid.
+      @param property the name of the property swept along the axis
+      @param values the values taken by the property
+      @return the index of the axis */
+  size_t AddAxis(const std::string& property, const std::vector<double>& values);
+
+  /// Remove all the axes from the grid.
+  void ClearAxes(void) { Axes.clear(); }
+
+  /// Returns the number of points in the grid.
+  size_t GetNumPoints(void) const;
+
+  /// Returns the values of the axes properties at a point of the grid.
+  std::vector<double> GetPoint(size_t index) const;
+
+  /// Returns the number of worker threads.
+  unsigned int GetNumThreads(void) const { return NumThreads; }
+
+  /** Trim (and linearize) all the points of the grid. The call returns once
+      all the points have been processed.
+      @return the results of the points, in the order of the grid */
+  std::vector<FGTrimSweepResult> Run(void);
+
+  /// Returns the names of the trim controls. Filled by Run().
+  const std::vector<std::string>& GetControlNames(void) const
+  { return ControlNames; }
+  /// Returns the names of the states of the linear models. Filled by Run().
+  const std::vector<std::string>& GetStateNames(void) const
+  { return StateNames; }
+  /// Returns the names of the inputs of the linear models. Filled by Run().
+  const std::vector<std::string>& GetInputNames(void) const
+  { return InputNames; }
+  /// Returns the names of the outputs of the linear models. Filled by Run().
+  const std::vector<std::string>& GetOutputNames(void) const
+  { return OutputNames; }
+
+private:
+  SGPath RootDir;
+  SGPath AircraftPath;
+  SGPath EnginePath;
+  SGPath SystemsPath;
+  SGPath InitFile;
+  SGPath OutputFile;
+  std::string Model;
+  unsigned int NumThreads;
+  TrimMode Mode;
+  bool WarmStart;
+  bool Linearize;
+  std::vector<std::pair<std::string, std::vector<double>>> Axes;
+  std::vector<std::string> OutputProperties;
+  std::vector<std::string> ControlNames;
+  std::vector<std::string> StateNames;
+  std::vector<std::string> InputNames;
+  std::vector<std::string> OutputNames;
+  std::function<FGLogger_ptr(void)> LoggerFactory;
+
+  // Names of the trim controls and of the linear models variables.
+  struct Layout {
+    std::vector<std::string> controls, states, inputs, outputs;
+  };
+
+  std::vector<size_t> GetIndices(size_t index) const;
+  void TrimPoint(FGFDMExec& fdmex, const FGInitialCondition& ic, size_t index,
+                 const std::vector<double>& guess, FGTrimSweepResult& result,
+                 Layout& layout) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,321 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBinaryInputSocket.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage input of binary packets from a UDP socket
+ Called by:    FGInput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+This class establishes a UDP socket and decodes the binary packets received
+from it into properties.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGBinaryInputSocket.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "string_utilities.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static const int endianTest = 1;
+#define isLittleEndian (*((char *) &endianTest ) != 0)
+
+// Size of the buffer used by FGfdmSocket::Receive() to read a datagram.
+static const size_t MaxPacketSize = 1024;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGBinaryInputSocket::FGBinaryInputSocket(FGFDMExec* fdmex, bool isEnabled) :
+  FGInputSocket(fdmex, isEnabled), PacketSize(0), SwapBytes(false),
+  HasSequence(false), HasTimeStamp(false), Accepted(false), LastSequence(0),
+  LastTimeStamp(0.0), StalePackets(0.0), MalformedPackets(0.0)
+{
+  SockPort = 5140;
+  SockProtocol = FGfdmSocket::ptUDP;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBinaryInputSocket::Load(Element* el)
+{
+  if (!FGInputSocket::Load(el))
+    return false;
+
+  string rate = el->GetAttributeValue("rate");
+  if (!rate.empty())
+    SetRate(0.5 + 1.0/(FDMExec->GetDeltaT()*atof(rate.c_str())));
+
+  string byteorder = el->GetAttributeValue("byteorder");
+  to_upper(byteorder);
+  if (byteorder.empty() || byteorder == "LITTLE")
+    SwapBytes = !isLittleEndian;
+  else if (byteorder == "BIG")
+    SwapBytes = isLittleEndian;
+  else {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "Unknown byte order " << byteorder << ". Expecting LITTLE or BIG.\n";
+    return false;
+  }
+
+  // The fields are stored in the packets in the order of the elements.
+  for (unsigned int i=0; i<el->GetNumElements(); ++i) {
+    Element* field_element = el->GetElement(i);
+    const string& name = field_element->GetName();
+    Field field;
+
+    if (name != "property" && name != "sequence" && name != "timestamp")
+      continue;
+
+    if (!LoadField(field_element, field))
+      return false;
+
+    if (name == "property") {
+      string property_str = field_element->GetDataLine();
+      field.Node = PropertyManager->GetNode(property_str);
+      if (!field.Node) {
+        // The field is skipped but the layout of the packets is unchanged.
+        FGXMLLogging log(field_element, LogLevel::ERROR);
+        log << LogFormat::RED << LogFormat::BOLD << "\n  No property by the name "
+            << property_str << " can be found.\n" << LogFormat::RESET;
+      } else
+        Fields.push_back(field);
+    } else if (name == "sequence") {
+      if (HasSequence || field.Type == eType::Float32
+          || field.Type == eType::Float64) {
+        FGXMLLogging log(field_element, LogLevel::ERROR);
+        log << "A packet must have at most one sequence number of integer type.\n";
+        return false;
+      }
+      HasSequence = true;
+      Sequence = field;
+    } else {
+      if (HasTimeStamp) {
+        FGXMLLogging log(field_element, LogLevel::ERROR);
+        log << "A packet must have at most one time stamp.\n";
+        return false;
+      }
+      HasTimeStamp = true;
+      TimeStamp = field;
+    }
+  }
+
+  if (PacketSize > MaxPacketSize) {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "The packets of " << PacketSize << " bytes exceed the maximum size of "
+        << MaxPacketSize << " bytes.\n";
+    return false;
+  }
+
+  string inputProp = CreateIndexedPropertyName("simulation/input", InputIdx);
+  PropertyManager->Tie(inputProp + "/stale-packets", this,
+                       &FGBinaryInputSocket::GetStalePackets);
+  PropertyManager->Tie(inputProp + "/malformed-packets", this,
+                       &FGBinaryInputSocket::GetMalformedPackets);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBinaryInputSocket::LoadField(Element* el, Field& field)
+{
+  string type = el->GetAttributeValue("type");
+  to_upper(type);
+
+  if (type == "INT8")         { field.Type = eType::Int8;    field.Size = 1; }
+  else if (type == "UINT8")   { field.Type = eType::UInt8;   field.Size = 1; }
+  else if (type == "INT16")   { field.Type = eType::Int16;   field.Size = 2; }
+  else if (type == "UINT16")  { field.Type = eType::UInt16;  field.Size = 2; }
+  else if (type == "INT32")   { field.Type = eType::Int32;   field.Size = 4; }
+  else if (type == "UINT32")  { field.Type = eType::UInt32;  field.Size = 4; }
+  else if (type == "INT64")   { field.Type = eType::Int64;   field.Size = 8; }
+  else if (type == "UINT64")  { field.Type = eType::UInt64;  field.Size = 8; }
+  else if (type == "FLOAT32") { field.Type = eType::Float32; field.Size = 4; }
+  else if (type.empty() || type == "FLOAT64") {
+    field.Type = eType::Float64;
+    field.Size = 8;
+  } else {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "Unknown type " << type << " for the field " << el->GetName()
+        << ".\n";
+    return false;
+  }
+
+  field.Offset = PacketSize;
+  PacketSize += field.Size;
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBinaryInputSocket::InitModel(void)
+{
+  // The sender may restart its sequence numbering with the simulation.
+  Accepted = false;
+
+  return FGInputSocket::InitModel();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBinaryInputSocket::Read(bool Holding)
+{
+  if (!socket) return;
+
+  vector<string> packets;
+  if (Endpoint) {
+    auto lock = Endpoint->Lock();
+    Receive(packets);
+  } else {
+    // Drain the socket so that the packets do not pile up when the sender runs
+    // faster than the input.
+    for (;;) {
+      string packet = socket->Receive();
+      if (packet.empty()) break;
+      packets.push_back(packet);
+    }
+  }
+
+  for (string& packet : packets) {
+    data.swap(packet);
+    ProcessData();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBinaryInputSocket::ProcessData(void)
+{
+  if (data.size() != PacketSize) {
+    ++MalformedPackets;
+    return;
+  }
+
+  const char* packet = data.data();
+  uint64_t sequence = 0;
+  double timestamp = 0.0;
+
+  if (HasSequence) {
+    sequence = DecodeSequence(packet);
+    if (Accepted) {
+      // Serial number arithmetic: the packet is more recent if it is ahead of
+      // the last one by less than half the range of the sequence numbers.
+      unsigned int bits = 8*Sequence.Size;
+      uint64_t mask = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+      uint64_t ahead = (sequence - LastSequence) & mask;
+      if (ahead == 0 || ahead > (mask >> 1)) {
+        ++StalePackets;
+        return;
+      }
+    }
+  }
+
+  if (HasTimeStamp) {
+    timestamp = Decode(TimeStamp, packet);
+    if (Accepted && timestamp < LastTimeStamp) {
+      ++StalePackets;
+      return;
+    }
+  }
+
+  Accepted = true;
+  LastSequence = sequence;
+  LastTimeStamp = timestamp;
+
+  for (const Field& field : Fields)
+    field.Node->setDoubleValue(Decode(field, packet));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <typename T>
+T FGBinaryInputSocket::Extract(const char* src) const
+{
+  T value;
+
+  if (SwapBytes) {
+    char bytes[sizeof(T)];
+    for (size_t i=0; i<sizeof(T); ++i)
+      bytes[i] = src[sizeof(T)-1-i];
+    memcpy(&value, bytes, sizeof(T));
+  } else
+    memcpy(&value, src, sizeof(T));
+
+  return value;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGBinaryInputSocket::Decode(const Field& field, const char* packet) const
+{
+  const char* src = packet + field.Offset;
+
+  switch(field.Type) {
+  case eType::Int8:    return Extract<int8_t>(src);
+  case eType::UInt8:   return Extract<uint8_t>(src);
+  case eType::Int16:   return Extract<int16_t>(src);
+  case eType::UInt16:  return Extract<uint16_t>(src);
+  case eType::Int32:   return Extract<int32_t>(src);
+  case eType::UInt32:  return Extract<uint32_t>(src);
+  case eType::Int64:   return static_cast<double>(Extract<int64_t>(src));
+  case eType::UInt64:  return static_cast<double>(Extract<uint64_t>(src));
+  case eType::Float32: return Extract<float>(src);
+  case eType::Float64: return Extract<double>(src);
+  }
+
+  return 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// The sequence number is read as an unsigned integer whatever its signedness
+// so that its wrap around is handled by ProcessData().
+
+uint64_t FGBinaryInputSocket::DecodeSequence(const char* packet) const
+{
+  const char* src = packet + Sequence.Offset;
+
+  switch(Sequence.Size) {
+  case 1: return Extract<uint8_t>(src);
+  case 2: return Extract<uint16_t>(src);
+  case 4: return Extract<uint32_t>(src);
+  default: return Extract<uint64_t>(src);
+  }
+}
+}
@@ -0,0 +1,153 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBinaryInputSocket.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBINARYINPUTSOCKET_H
+#define FGBINARYINPUTSOCKET_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+
+#include "FGInputSocket.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Implements a UDP input socket that receives binary packets.
+
+    The layout of the packets is declared by the children of the &lt;input&gt;
+    element, in the order of the fields in the packets, without padding:
+
+@code
+<input type="BINARY" port="5140" rate="500" byteorder="BIG">
+  <sequence type="UINT32"/>
+  <timestamp type="FLOAT64"/>
+  <property type="FLOAT32"> fcs/aileron-cmd-norm </property>
+  <property type="FLOAT32"> fcs/elevator-cmd-norm </property>
+  <property type="UINT8"> gear/gear-cmd-norm </property>
+</input>
+@endcode
+
+    The type of a field is one of INT8, UINT8, INT16, UINT16, INT32, UINT32,
+    INT64, UINT64, FLOAT32 and FLOAT64 (the default). The attribute byteorder
+    is either LITTLE (the default) or BIG.
+
+    The optional &lt;sequence&gt; field is an integer incremented by the sender
+    for each packet: a packet whose sequence number is not more recent than the
+    last packet accepted (modulo the range of its type) is rejected. The
+    optional &lt;timestamp&gt; field is the time at which the packet was sent
+    and a packet older than the last packet accepted is rejected as well. The
+    packets with a size that does not match the layout are also rejected.
+
+    The properties are resolved when the input is loaded so a packet is decoded
+    directly into the property nodes. The number of rejected packets is
+    available from the properties
+    <tt>simulation/input[i]/stale-packets</tt> and
+    <tt>simulation/input[i]/malformed-packets</tt>.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBinaryInputSocket : public FGInputSocket
+{
+public:
+  /** Constructor. */
+  FGBinaryInputSocket(FGFDMExec* fdmex, bool isEnabled=true);
+
+  /** Reads the layout of the packets from an XML file.
+      @param element The root XML Element of the input file.
+  */
+  bool Load(Element* el) override;
+
+  /** Opens the socket and forgets the last packet accepted.
+      @result true if the execution succeeded. */
+  bool InitModel(void) override;
+
+  /// Reads the socket and updates properties accordingly.
+  void Read(bool Holding) override;
+
+  /// Returns the size in bytes of the packets.
+  size_t GetPacketSize(void) const { return PacketSize; }
+  /// Returns the number of packets rejected as out of sequence or too old.
+  double GetStalePackets(void) const { return StalePackets; }
+  /// Returns the number of packets rejected because of their size.
+  double GetMalformedPackets(void) const { return MalformedPackets; }
+
+protected:
+  enum class eType {Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+                    Float32, Float64};
+
+  struct Field {
+    eType Type;
+    size_t Offset;
+    size_t Size;
+    SGPropertyNode_ptr Node;
+  };
+
+  std::vector<Field> Fields;
+  size_t PacketSize;
+  bool SwapBytes;
+
+  bool HasSequence;
+  Field Sequence;
+  bool HasTimeStamp;
+  Field TimeStamp;
+
+  bool Accepted;
+  uint64_t LastSequence;
+  double LastTimeStamp;
+
+  double StalePackets;
+  double MalformedPackets;
+
+  bool LoadField(Element* el, Field& field);
+  /// Updates the properties with the values of the packet stored in data.
+  void ProcessData(void);
+  double Decode(const Field& field, const char* packet) const;
+  uint64_t DecodeSequence(const char* packet) const;
+  template <typename T> T Extract(const char* src) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,209 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGBinaryRecord.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Pack the output values in a binary format
+ Called by:    FGOutputBinaryFile, FGOutputBinarySocket
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+#include "FGBinaryRecord.h"
+#include "FGXMLElement.h"
+#include "FGLog.h"
+#include "string_utilities.h"
+#include "math/FGFunction.h"
+#include "math/FGPropertyValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+static const int endianTest = 1;
+#define isLittleEndian (*((char *) &endianTest ) != 0)
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+char* FGBinaryRecord::StoreLittleEndian(char* dest, const void* src, size_t size)
+{
+  if (isLittleEndian)
+    memcpy(dest, src, size);
+  else {
+    const char* bytes = static_cast<const char*>(src);
+    for (size_t i=0; i<size; ++i)
+      dest[i] = bytes[size-1-i];
+  }
+
+  return dest + size;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGBinaryRecord::Load(Element* el)
+{
+  string format = el->GetAttributeValue("format");
+  to_upper(format);
+
+  if (format.empty() || format == "FLOAT64")
+    SinglePrecision = false;
+  else if (format == "FLOAT32")
+    SinglePrecision = true;
+  else {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "Unknown binary output format: " << format
+        << ". It must be FLOAT64 or FLOAT32.\n";
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+string FGBinaryRecord::GetUnit(const string& name)
+{
+  string::size_type slash = name.find_last_of('/');
+  string::size_type dash = name.find_last_of('-');
+
+  if (dash == string::npos || (slash != string::npos && dash < slash))
+    return string();
+
+  string unit = name.substr(dash+1);
+  if (unit.empty()) return unit;
+
+  for (char c: unit) {
+    unsigned char uc = static_cast<unsigned char>(c);
+    if (!islower(uc) && !isdigit(uc) && c != '_')
+      return string();
+  }
+
+  return unit;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBinaryRecord::AppendString(const string& str)
+{
+  char length[2];
+  uint16_t size = static_cast<uint16_t>(min<size_t>(str.size(), UINT16_MAX));
+
+  StoreLittleEndian(length, &size, sizeof(size));
+  Buffer.append(length, sizeof(length));
+  Buffer.append(str, 0, size);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const string& FGBinaryRecord::BuildHeader(const vector<FGPropertyValue*>& parameters,
+                                          const vector<string>& captions,
+                                          const vector<shared_ptr<FGFunction>>& functions)
+{
+  char fields[8];
+  uint16_t version = 1;
+  uint16_t size = SinglePrecision ? sizeof(float) : sizeof(double);
+  uint32_t nchannels = 1 + parameters.size() + functions.size();
+
+  Buffer.assign("JSBB");
+  char* dest = StoreLittleEndian(fields, &version, sizeof(version));
+  dest = StoreLittleEndian(dest, &size, sizeof(size));
+  StoreLittleEndian(dest, &nchannels, sizeof(nchannels));
+  Buffer.append(fields, sizeof(fields));
+
+  AppendString("Time");
+  AppendString("sec");
+
+  for (unsigned int i=0; i<parameters.size(); ++i) {
+    if (!captions[i].empty())
+      AppendString(captions[i]);
+    else
+      AppendString(parameters[i]->GetFullyQualifiedName());
+    AppendString(GetUnit(parameters[i]->GetName()));
+  }
+
+  for (auto& function: functions) {
+    AppendString(function->GetName());
+    AppendString(GetUnit(function->GetName()));
+  }
+
+  return Buffer;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+char* FGBinaryRecord::StoreValue(char* dest, double value) const
+{
+  if (SinglePrecision) {
+    float fvalue = static_cast<float>(value);
+    return StoreLittleEndian(dest, &fvalue, sizeof(fvalue));
+  }
+
+  return StoreLittleEndian(dest, &value, sizeof(value));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const string& FGBinaryRecord::BuildRecord(double time,
+                                          const vector<FGPropertyValue*>& parameters,
+                                          const vector<shared_ptr<FGFunction>>& functions)
+{
+  size_t size = SinglePrecision ? sizeof(float) : sizeof(double);
+
+  // The buffer keeps its capacity from one record to the next.
+  Buffer.resize((1 + parameters.size() + functions.size())*size);
+
+  char* dest = StoreValue(&Buffer[0], time);
+  for (auto parameter: parameters)
+    dest = StoreValue(dest, parameter->GetValue());
+  for (auto& function: functions)
+    dest = StoreValue(dest, function->getDoubleValue());
+
+  return Buffer;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+const string& FGBinaryRecord::BuildRecord(const double* values, size_t count)
+{
+  size_t size = SinglePrecision ? sizeof(float) : sizeof(double);
+
+  Buffer.resize(count*size);
+
+  char* dest = &Buffer[0];
+  for (size_t i=0; i<count; ++i)
+    dest = StoreValue(dest, values[i]);
+
+  return Buffer;
+}
+}
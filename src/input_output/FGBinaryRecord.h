@@ -0,0 +1,158 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGBinaryRecord.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGBINARYRECORD_H
+#define FGBINARYRECORD_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class Element;
+class FGFunction;
+class FGPropertyValue;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Packs the output values in the binary format shared by FGOutputBinaryFile
+    and FGOutputBinarySocket.
+
+    The stream starts with a header that describes the channels of the
+    records:
+
+<pre>
+    char[4]   magic number "JSBB"
+    uint16    version of the format (1)
+    uint16    size in bytes of the values (8 for float64, 4 for float32)
+    uint32    number of channels N
+    N times:
+      uint16  length of the channel name followed by the name (UTF-8)
+      uint16  length of the channel unit followed by the unit (UTF-8)
+</pre>
+
+    It is followed by the records, each of which is made of the N values of the
+    channels in the order of the header. The first channel is the simulation
+    time in seconds, then come the properties and the functions of the
+    &lt;output&gt; element. All the integers and values are stored in little
+    endian byte order, without padding.
+
+    The name of a property channel is its caption when it has one, otherwise
+    its fully qualified name. The unit is deduced from the suffix of the
+    property name (for instance "ft" for "position/h-sl-ft") and is empty when
+    there is no such suffix.
+
+    The values are stored as IEEE 754 float64 unless the attribute
+    <tt>format="FLOAT32"</tt> is specified on the &lt;output&gt; element.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGBinaryRecord
+{
+public:
+  FGBinaryRecord(void) : SinglePrecision(false) {}
+
+  /** Reads the format of the values from the attribute "format" of an
+      &lt;output&gt; element.
+      @param el XML Element that is pointing to the output directives
+      @return false if the format is not recognized */
+  bool Load(Element* el);
+
+  /// Selects float32 (true) or float64 (false) values.
+  void SetSinglePrecision(bool single) { SinglePrecision = single; }
+  /// Returns true if the values are stored as float32.
+  bool GetSinglePrecision(void) const { return SinglePrecision; }
+
+  /** Builds the header of the stream.
+      @param parameters the properties of the output
+      @param captions the captions of the properties (empty if none)
+      @param functions the functions of the output
+      @return a reference to the bytes of the header. It is valid until the
+              next call to BuildHeader() or BuildRecord(). */
+  const std::string& BuildHeader(const std::vector<FGPropertyValue*>& parameters,
+                                 const std::vector<std::string>& captions,
+                                 const std::vector<std::shared_ptr<FGFunction>>& functions);
+
+  /** Builds a record with the current values of the channels.
+      @param time the simulation time
+      @param parameters the properties of the output
+      @param functions the functions of the output
+      @return a reference to the bytes of the record. It is valid until the
+              next call to BuildHeader() or BuildRecord(). */
+  const std::string& BuildRecord(double time,
+                                 const std::vector<FGPropertyValue*>& parameters,
+                                 const std::vector<std::shared_ptr<FGFunction>>& functions);
+
+  /** Builds a record from values captured beforehand.
+      @param values the values of the channels, starting with the time
+      @param count the number of values
+      @return a reference to the bytes of the record. It is valid until the
+              next call to BuildHeader() or BuildRecord(). */
+  const std::string& BuildRecord(const double* values, size_t count);
+
+  /** Returns the unit of a property deduced from the suffix of its name.
+      @param name the name of the property
+      @return the unit or an empty string if there is no suffix */
+  static std::string GetUnit(const std::string& name);
+
+  /** Copies the bytes of a value in little endian order.
+      @param dest the destination of the bytes
+      @param src the value to copy
+      @param size the size in bytes of the value
+      @return a pointer past the last byte copied to dest */
+  static char* StoreLittleEndian(char* dest, const void* src, size_t size);
+
+private:
+  bool SinglePrecision;
+  std::string Buffer;
+
+  void AppendString(const std::string& str);
+  char* StoreValue(char* dest, double value) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
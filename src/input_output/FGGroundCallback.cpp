@@ -33,6 +33,7 @@ SENTRY
 
 #include "math/FGLocation.h"
 #include "FGGroundCallback.h"
+#include "FGSnapshot.h"
 
 namespace JSBSim {
 
@@ -58,4 +59,19 @@ double FGDefaultGroundCallback::GetAGLevel(double t, const FGLocation& loc,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGGroundCallback::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGDefaultGroundCallback::SerializeState(FGSnapshot& snapshot)
+{
+  FGGroundCallback::SerializeState(snapshot);
+  snapshot(mTerrainElevation);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 } // namespace JSBSim
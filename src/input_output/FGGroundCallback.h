@@ -42,6 +42,7 @@ namespace JSBSim {
 
 class FGLocation;
 class FGColumnVector3;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -114,6 +115,13 @@ public:
    */
   void SetTime(double _time) { time = _time; }
 
+  /** Saves or restores the state of the ground callback.
+      Must be overridden by the callbacks that store data which may change
+      during the simulation (e.g. the terrain elevation).
+      @see FGSnapshot
+   */
+  virtual void SerializeState(FGSnapshot& snapshot);
+
 protected:
   double time;
 };
@@ -139,6 +147,8 @@ public:
   void SetEllipse(double semimajor, double semiminor) override
   { a = semimajor; b = semiminor; }
 
+  void SerializeState(FGSnapshot& snapshot) override;
+
 private:
   double a, b;
   double mTerrainElevation = 0.0;
@@ -0,0 +1,315 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGInputEventLoop.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Receive the data of the input sockets in a background thread
+ Called by:    FGInputSocket
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <chrono>
+#include <set>
+#include <sstream>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <sys/select.h>
+#endif
+
+#include "FGInputEventLoop.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Period at which the event loop checks if it must stop and if the descriptors
+// watched for the TCP sockets have changed (client connected or disconnected).
+static const int PollTimeout = 10; // milliseconds
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGInputEventLoop::Endpoint::Endpoint(FGfdmSocket* socket)
+  : Socket(socket), Watched(FGfdmSocket::InvalidDescriptor)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputEventLoop::Endpoint::Fetch(vector<string>& data)
+{
+  data.clear();
+  data.swap(Received);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputEventLoop::Endpoint::WaitUntilReadable(unique_lock<mutex>& lock)
+{
+  Readable.wait(lock, [this]{
+    if (!Received.empty() || !Socket) return true;
+    // A TCP server without client only watches its listening socket.
+    return Socket->GetProtocol() == FGfdmSocket::ptTCP
+      && Socket->GetPollDescriptor() == Socket->GetDescriptor();
+  });
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGInputEventLoop::FGInputEventLoop(void)
+  : NextId(0), Stop(false)
+{
+#ifdef __linux__
+  EpollFd = epoll_create1(0);
+  if (EpollFd == -1) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not create the input event loop, error = " << errno << "\n";
+  }
+#endif
+  Thread = thread(&FGInputEventLoop::Run, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGInputEventLoop::~FGInputEventLoop()
+{
+  Stop = true;
+  Thread.join();
+#ifdef __linux__
+  if (EpollFd != -1) close(EpollFd);
+#endif
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<FGInputEventLoop> FGInputEventLoop::GetInstance(void)
+{
+  static mutex InstanceMutex;
+  static weak_ptr<FGInputEventLoop> Instance;
+
+  lock_guard<mutex> lock(InstanceMutex);
+  shared_ptr<FGInputEventLoop> loop = Instance.lock();
+
+  if (!loop) {
+    loop.reset(new FGInputEventLoop);
+    Instance = loop;
+  }
+
+  return loop;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<FGInputEventLoop::Endpoint> FGInputEventLoop::Register(FGfdmSocket* socket)
+{
+  auto endpoint = make_shared<Endpoint>(socket);
+  uint64_t id;
+
+  {
+    lock_guard<mutex> lock(Mutex);
+    id = NextId++;
+    Endpoints[id] = endpoint;
+  }
+
+  auto lock = endpoint->Lock();
+  Watch(id, *endpoint);
+
+  return endpoint;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputEventLoop::Unregister(const shared_ptr<Endpoint>& endpoint)
+{
+  {
+    lock_guard<mutex> lock(Mutex);
+    for (auto it = Endpoints.begin(); it != Endpoints.end(); ++it) {
+      if (it->second == endpoint) {
+        Endpoints.erase(it);
+        break;
+      }
+    }
+  }
+
+  auto lock = endpoint->Lock();
+
+#ifdef __linux__
+  // A descriptor that has been closed since it was watched is already removed
+  // from the epoll set and its number may have been reused by another socket.
+  if (endpoint->Socket && FGfdmSocket::IsValid(endpoint->Watched)
+      && endpoint->Watched == endpoint->Socket->GetPollDescriptor())
+    epoll_ctl(EpollFd, EPOLL_CTL_DEL, endpoint->Watched, nullptr);
+#endif
+
+  endpoint->Socket = nullptr;
+  endpoint->Readable.notify_all();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Updates the descriptor watched for an endpoint. The endpoint must be locked.
+
+void FGInputEventLoop::Watch(uint64_t id, Endpoint& endpoint)
+{
+  FGfdmSocket::Descriptor desired = endpoint.Socket->GetPollDescriptor();
+
+  if (desired == endpoint.Watched) return;
+
+#ifdef __linux__
+  if (EpollFd == -1) return;
+
+  // Only the listening socket is still open when the watched descriptor
+  // changes: the connection with a TCP client is closed when it is lost.
+  if (FGfdmSocket::IsValid(endpoint.Watched)
+      && endpoint.Watched == endpoint.Socket->GetDescriptor())
+    epoll_ctl(EpollFd, EPOLL_CTL_DEL, endpoint.Watched, nullptr);
+
+  if (FGfdmSocket::IsValid(desired)) {
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = id;
+    if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, desired, &event) == -1
+        && errno != EEXIST) {
+      FGLogging log(LogLevel::ERROR);
+      log << "Could not watch the input socket, error = " << errno << "\n";
+    }
+  }
+#endif
+
+  endpoint.Watched = desired;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Receives the pending data of an endpoint. The endpoint must be locked.
+
+void FGInputEventLoop::Service(Endpoint& endpoint)
+{
+  // A TCP socket receives the whole stream at once and accepts the connection
+  // of a client. A UDP socket receives one datagram at a time.
+  for (;;) {
+    string data = endpoint.Socket->Receive();
+    if (data.empty()) break;
+    endpoint.Received.push_back(move(data));
+  }
+
+  // Also wake up the simulation thread when a TCP client has disconnected.
+  endpoint.Readable.notify_all();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputEventLoop::Run(void)
+{
+  vector<pair<uint64_t, shared_ptr<Endpoint>>> endpoints;
+  set<uint64_t> ready;
+
+  while (!Stop) {
+    {
+      lock_guard<mutex> lock(Mutex);
+      endpoints.assign(Endpoints.begin(), Endpoints.end());
+    }
+
+    ready.clear();
+
+#ifdef __linux__
+    // An endpoint that is locked by the simulation thread is skipped: its
+    // descriptor is updated at the next iteration.
+    for (auto& [id, endpoint] : endpoints) {
+      unique_lock<mutex> lock(endpoint->Mutex, try_to_lock);
+      if (lock && endpoint->Socket) Watch(id, *endpoint);
+    }
+
+    epoll_event events[32];
+    int num_events = EpollFd == -1 ? 0 : epoll_wait(EpollFd, events, 32,
+                                                    PollTimeout);
+
+    if (EpollFd == -1)
+      this_thread::sleep_for(chrono::milliseconds(PollTimeout));
+
+    for (int i=0; i<num_events; ++i)
+      ready.insert(events[i].data.u64);
+#else
+    fd_set fds;
+    FD_ZERO(&fds);
+    FGfdmSocket::Descriptor max_fd = 0;
+    vector<pair<uint64_t, FGfdmSocket::Descriptor>> watched;
+
+    for (auto& [id, endpoint] : endpoints) {
+      unique_lock<mutex> lock(endpoint->Mutex, try_to_lock);
+      if (!lock || !endpoint->Socket) continue;
+      Watch(id, *endpoint);
+      if (!FGfdmSocket::IsValid(endpoint->Watched)) continue;
+#ifdef _WIN32
+      // The size of a Windows fd_set limits the number of descriptors...
+      if (watched.size() >= FD_SETSIZE) continue;
+#else
+      // ...whereas it limits the value of the descriptors elsewhere.
+      if (endpoint->Watched >= FD_SETSIZE) continue;
+#endif
+      FD_SET(endpoint->Watched, &fds);
+      max_fd = max(max_fd, endpoint->Watched);
+      watched.emplace_back(id, endpoint->Watched);
+    }
+
+    if (watched.empty()) {
+      // select() fails on Windows when no descriptor is given.
+      this_thread::sleep_for(chrono::milliseconds(PollTimeout));
+      continue;
+    }
+
+    timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = PollTimeout*1000;
+
+    if (select((int)max_fd+1, &fds, nullptr, nullptr, &timeout) > 0) {
+      for (auto& [id, fd] : watched)
+        if (FD_ISSET(fd, &fds)) ready.insert(id);
+    }
+#endif
+
+    for (auto& [id, endpoint] : endpoints) {
+      if (ready.find(id) == ready.end()) continue;
+
+      // The data of an endpoint locked by the simulation thread stays in the
+      // socket and is reported again at the next iteration.
+      unique_lock<mutex> lock(endpoint->Mutex, try_to_lock);
+      if (lock && endpoint->Socket) Service(*endpoint);
+    }
+
+    endpoints.clear();
+  }
+}
+}
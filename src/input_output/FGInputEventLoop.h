@@ -0,0 +1,160 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGInputEventLoop.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGINPUTEVENTLOOP_H
+#define FGINPUTEVENTLOOP_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FGfdmSocket.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Receives the data of the input sockets in a background thread.
+
+    A single event loop is shared by all the input sockets of the process,
+    whichever FGFDMExec instance they belong to. Its thread waits for incoming
+    data on all the sockets at once (with epoll on Linux, select elsewhere),
+    accepts the TCP connections and stores the received data in the endpoint
+    of each socket. The simulation thread then fetches the data from the
+    endpoint when the input is read, which never waits for the network.
+
+    The endpoint must be locked while the socket is used by the simulation
+    thread (for instance to reply to a TCP client) since the event loop may
+    otherwise close or accept a connection at the same time.
+
+    @code
+    auto loop = FGInputEventLoop::GetInstance();
+    auto endpoint = loop->Register(socket);
+    ...
+    {
+      auto lock = endpoint->Lock();
+      endpoint->Fetch(data);
+      // Process the data and reply
+    }
+    ...
+    loop->Unregister(endpoint); // before the socket is destroyed
+    @endcode
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGInputEventLoop
+{
+public:
+  /// The data received from a socket, waiting to be fetched.
+  class Endpoint
+  {
+  public:
+    explicit Endpoint(FGfdmSocket* socket);
+
+    /// Locks the endpoint.
+    std::unique_lock<std::mutex> Lock(void)
+    { return std::unique_lock<std::mutex>(Mutex); }
+    /** Moves the received data to a vector. For UDP, each element is a
+        datagram. For TCP, the elements are consecutive chunks of the stream.
+        The endpoint must be locked. */
+    void Fetch(std::vector<std::string>& data);
+    /** Waits until some data is received. Returns immediately if no TCP client
+        is connected.
+        @param lock the lock returned by Lock() */
+    void WaitUntilReadable(std::unique_lock<std::mutex>& lock);
+
+  private:
+    friend class FGInputEventLoop;
+
+    std::mutex Mutex;
+    std::condition_variable Readable;
+    FGfdmSocket* Socket;
+    FGfdmSocket::Descriptor Watched;
+    std::vector<std::string> Received;
+  };
+
+  ~FGInputEventLoop();
+
+  FGInputEventLoop(const FGInputEventLoop&) = delete;
+  FGInputEventLoop& operator=(const FGInputEventLoop&) = delete;
+
+  /** Returns the event loop of the process. It is created on the first call
+      and destroyed when the last reference to it is released. */
+  static std::shared_ptr<FGInputEventLoop> GetInstance(void);
+
+  /** Starts to receive the data of a socket.
+      @param socket the input socket. It must remain valid until the endpoint
+                    is unregistered.
+      @return the endpoint where the received data is stored */
+  std::shared_ptr<Endpoint> Register(FGfdmSocket* socket);
+  /// Stops to receive the data of the socket of an endpoint.
+  void Unregister(const std::shared_ptr<Endpoint>& endpoint);
+
+private:
+  FGInputEventLoop(void);
+
+  std::mutex Mutex;
+  std::map<uint64_t, std::shared_ptr<Endpoint>> Endpoints;
+  uint64_t NextId;
+  std::atomic<bool> Stop;
+  std::thread Thread;
+#ifdef __linux__
+  int EpollFd;
+#endif
+
+  void Run(void);
+  void Watch(uint64_t id, Endpoint& endpoint);
+  void Service(Endpoint& endpoint);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
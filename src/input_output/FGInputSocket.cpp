@@ -55,12 +55,19 @@ CLASS IMPLEMENTATION
 
 FGInputSocket::FGInputSocket(FGFDMExec* fdmex, bool isEnabled) :
   FGInputType(fdmex, isEnabled), SockProtocol(FGfdmSocket::ptTCP),
-  BlockingInput(false)
+  BlockingInput(false), Async(false)
 {
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGInputSocket::~FGInputSocket()
+{
+  CloseSocket();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGInputSocket::Load(Element* el)
 {
   if (!FGInputType::Load(el))
@@ -78,6 +85,10 @@ bool FGInputSocket::Load(Element* el)
   if (to_upper(action) == "BLOCKING_INPUT")
     BlockingInput = true;
 
+  string async = el->GetAttributeValue("async");
+  if (to_upper(async) == "ON")
+    Async = true;
+
   return true;
 }
 
@@ -98,16 +109,47 @@ bool FGInputSocket::InitModel(void)
 
 bool FGInputSocket::CreateSocket()
 {
+  CloseSocket();
   socket = std::make_unique<FGfdmSocket>(SockPort, SockProtocol);
 
   if (!socket) return false;
   if (!socket->GetConnectStatus()) return false;
 
+  if (Async) {
+    EventLoop = FGInputEventLoop::GetInstance();
+    Endpoint = EventLoop->Register(socket.get());
+  }
+
   return true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGInputSocket::CloseSocket()
+{
+  // The event loop must stop using the socket before it is destroyed.
+  if (Endpoint) {
+    EventLoop->Unregister(Endpoint);
+    Endpoint.reset();
+  }
+  socket.reset();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGInputSocket::Receive(vector<string>& received)
+{
+  if (Endpoint)
+    Endpoint->Fetch(received);
+  else {
+    received.clear();
+    string raw_data = socket->Receive();
+    if (!raw_data.empty()) received.push_back(raw_data);
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGInputSocket::Enable()
 {
   if (enabled) return; // already enabled
@@ -120,7 +162,7 @@ void FGInputSocket::Enable()
 void FGInputSocket::Disable()
 {
   FGInputType::Disable();
-  socket.reset();
+  CloseSocket();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -131,7 +173,7 @@ bool FGInputSocket::Toggle()
   if (enabled_status)
     CreateSocket();
   else
-    socket.reset();
+    CloseSocket();
 
   return enabled_status;
 }
@@ -143,15 +185,26 @@ void FGInputSocket::Read(bool Holding)
   if (!socket) return;
   if (!socket->GetConnectStatus()) return;
 
-  if (BlockingInput)
-    socket->WaitUntilReadable(); // block until a transmission is received
+  // The event loop must not use the socket while the commands are replied to.
+  unique_lock<mutex> lock;
+  if (Endpoint) lock = Endpoint->Lock();
+
+  if (BlockingInput) {
+    // block until a transmission is received
+    if (Endpoint)
+      Endpoint->WaitUntilReadable(lock);
+    else
+      socket->WaitUntilReadable();
+  }
 
-  string raw_data = socket->Receive(); // read data
+  vector<string> received;
+  Receive(received); // read data
 
-  if (!raw_data.empty()) {
+  if (!received.empty()) {
     size_t start = 0;
 
-    data += raw_data;
+    for (const string& raw_data : received)
+      data += raw_data;
 
     // parse lines
     while (1) {
@@ -40,6 +40,7 @@ INCLUDES
 
 #include "FGInputType.h"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGInputEventLoop.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -53,6 +54,10 @@ CLASS DOCUMENTATION
 
 /** Implements the input from a socket. This class inputs data from a telnet
     session. This is a leaf class.
+
+    When the attribute async="ON" is specified, the socket is serviced by the
+    FGInputEventLoop of the process and the data received meanwhile is
+    processed when the input is read.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -64,6 +69,7 @@ class FGInputSocket : public FGInputType
 public:
   /** Constructor. */
   FGInputSocket(FGFDMExec* fdmex, bool isEnabled);
+  ~FGInputSocket() override;
 
   /** Init the input directives from an XML file.
       @param element XML Element that is pointing to the input directives
@@ -87,12 +93,20 @@ public:
 protected:
 
   bool CreateSocket();
+  void CloseSocket();
+  /** Returns the data received since the last call. When the input is
+      asynchronous, the endpoint must be locked.
+      @param received the data received, one element per UDP datagram. */
+  void Receive(std::vector<std::string>& received);
 
   unsigned int SockPort;
   std::unique_ptr<FGfdmSocket> socket;
   FGfdmSocket::ProtocolType SockProtocol;
   std::string data;
   bool BlockingInput;
+  bool Async;
+  std::shared_ptr<FGInputEventLoop> EventLoop;
+  std::shared_ptr<FGInputEventLoop::Endpoint> Endpoint;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -0,0 +1,207 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGMappedFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Map a file in memory
+ Called by:    FGOutputColumnarFile
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "FGMappedFile.h"
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifdef _WIN32
+
+FGMappedFile::FGMappedFile(void)
+  : File(INVALID_HANDLE_VALUE), Mapping(nullptr)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::Open(const SGPath& path)
+{
+  Close();
+  File = CreateFileW(path.wstr().c_str(), GENERIC_READ | GENERIC_WRITE,
+                     FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                     FILE_ATTRIBUTE_NORMAL, nullptr);
+  return File != INVALID_HANDLE_VALUE;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMappedFile::Close(void)
+{
+  if (Mapping) {
+    CloseHandle(Mapping);
+    Mapping = nullptr;
+  }
+  if (File != INVALID_HANDLE_VALUE) {
+    CloseHandle(File);
+    File = INVALID_HANDLE_VALUE;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::IsOpen(void) const
+{
+  return File != INVALID_HANDLE_VALUE;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::Resize(size_t size)
+{
+  // The mapping object can not grow: it is recreated with the new size. The
+  // views of the previous mapping object remain valid until they are unmapped.
+  if (Mapping) {
+    CloseHandle(Mapping);
+    Mapping = nullptr;
+  }
+
+  LARGE_INTEGER li;
+  li.QuadPart = size;
+  if (!SetFilePointerEx(File, li, nullptr, FILE_BEGIN) || !SetEndOfFile(File))
+    return false;
+
+  Mapping = CreateFileMappingW(File, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+  return Mapping != nullptr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+char* FGMappedFile::Map(size_t offset, size_t length)
+{
+  if (!Mapping) return nullptr;
+
+  ULARGE_INTEGER li;
+  li.QuadPart = offset;
+  return static_cast<char*>(MapViewOfFile(Mapping, FILE_MAP_WRITE, li.HighPart,
+                                          li.LowPart, length));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMappedFile::Unmap(char* region, size_t)
+{
+  if (region) UnmapViewOfFile(region);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGMappedFile::GetGranularity(void)
+{
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwAllocationGranularity;
+}
+
+#else
+
+FGMappedFile::FGMappedFile(void)
+  : File(-1)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::Open(const SGPath& path)
+{
+  Close();
+  File = open(path.utf8Str().c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  return File >= 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMappedFile::Close(void)
+{
+  if (File >= 0) {
+    close(File);
+    File = -1;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::IsOpen(void) const
+{
+  return File >= 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMappedFile::Resize(size_t size)
+{
+  return ftruncate(File, size) == 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+char* FGMappedFile::Map(size_t offset, size_t length)
+{
+  void* region = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, File,
+                      offset);
+  return region == MAP_FAILED ? nullptr : static_cast<char*>(region);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMappedFile::Unmap(char* region, size_t length)
+{
+  if (region) munmap(region, length);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGMappedFile::GetGranularity(void)
+{
+  return sysconf(_SC_PAGESIZE);
+}
+
+#endif
+}
@@ -0,0 +1,119 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGMappedFile.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGMAPPEDFILE_H
+#define FGMAPPEDFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstddef>
+
+#include "simgear/misc/sg_path.hxx"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Thin wrapper around the memory mapping of a file (mmap on POSIX systems,
+    file mapping objects on Windows).
+
+    The file is opened for reading and writing and is truncated when it is
+    opened. Regions of the file can then be mapped in memory: the data written
+    to a mapped region is transferred to the file by the operating system,
+    without blocking the caller. The offset of a mapped region must be a
+    multiple of GetGranularity() and the region must lie within the file, the
+    size of which is set by Resize().
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGMappedFile
+{
+public:
+  FGMappedFile(void);
+  /// Destructor: closes the file. The regions must have been unmapped.
+  ~FGMappedFile() { Close(); }
+
+  FGMappedFile(const FGMappedFile&) = delete;
+  FGMappedFile& operator=(const FGMappedFile&) = delete;
+
+  /** Creates the file or truncates it if it already exists.
+      @param path the path to the file
+      @return false if the file could not be opened */
+  bool Open(const SGPath& path);
+  /// Closes the file.
+  void Close(void);
+  /// Returns true if the file is open.
+  bool IsOpen(void) const;
+
+  /** Sets the size of the file. The regions that are already mapped are
+      not affected.
+      @param size the new size of the file in bytes
+      @return false if the file could not be resized */
+  bool Resize(size_t size);
+
+  /** Maps a region of the file in memory.
+      @param offset the offset of the region. It must be a multiple of
+                    GetGranularity().
+      @param length the size of the region in bytes
+      @return a pointer to the region or nullptr if it could not be mapped */
+  char* Map(size_t offset, size_t length);
+  /** Unmaps a region of the file.
+      @param region the pointer returned by Map()
+      @param length the size of the region in bytes */
+  void Unmap(char* region, size_t length);
+
+  /// Returns the alignment of the offsets of the regions.
+  static size_t GetGranularity(void);
+
+private:
+#ifdef _WIN32
+  void* File;
+  void* Mapping;
+#else
+  int File;
+#endif
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -0,0 +1,106 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputBinaryFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage output of sim parameters to a binary file
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputBinaryFile.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+bool FGOutputBinaryFile::Load(Element* el)
+{
+  if (!FGOutputFile::Load(el))
+    return false;
+
+  return Record.Load(el);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputBinaryFile::OpenFile(void)
+{
+  datafile.clear();
+  datafile.open(Filename);
+  if (!datafile) {
+    FGLogging log(LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD << "\nERROR: unable to open the file "
+        << LogFormat::RESET << Filename.c_str()
+        << LogFormat::RED << LogFormat::BOLD << "\n       => Output to this file is disabled.\n\n"
+        << LogFormat::RESET;
+    Disable();
+    return false;
+  }
+
+  if (SubSystems) {
+    FGLogging log(LogLevel::WARN);
+    log << "The subsystems are not recorded in the binary output "
+        << Name << ". Only the properties and the functions are.\n";
+  }
+
+  const string& header = Record.BuildHeader(OutputParameters, OutputCaptions,
+                                            PreFunctions);
+  datafile.write(header.data(), header.size());
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::Print(void)
+{
+  if (!datafile.is_open()) return;
+
+  const string& record = Record.BuildRecord(FDMExec->GetSimTime(),
+                                            OutputParameters, PreFunctions);
+  datafile.write(record.data(), record.size());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinaryFile::PrintValues(const double* values)
+{
+  if (!datafile.is_open()) return;
+
+  const string& record = Record.BuildRecord(values, GetNumChannels());
+  datafile.write(record.data(), record.size());
+}
+}
@@ -0,0 +1,94 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputBinarySocket.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage output of sim parameters to a binary socket
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputBinarySocket.h"
+#include "FGFDMExec.h"
+#include "FGfdmSocket.h"
+#include "FGLog.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+bool FGOutputBinarySocket::Load(Element* el)
+{
+  if (!FGOutputSocket::Load(el))
+    return false;
+
+  return Record.Load(el);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinarySocket::PrintHeaders(void)
+{
+  if (SubSystems) {
+    FGLogging log(LogLevel::WARN);
+    log << "The subsystems are not recorded in the binary output "
+        << Name << ". Only the properties and the functions are.\n";
+  }
+
+  const string& header = Record.BuildHeader(OutputParameters, OutputCaptions,
+                                            PreFunctions);
+  socket->Send(header);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinarySocket::Print(void)
+{
+  if (socket == 0) return;
+  if (!socket->GetConnectStatus()) return;
+
+  const string& record = Record.BuildRecord(FDMExec->GetSimTime(),
+                                            OutputParameters, PreFunctions);
+  socket->Send(record);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputBinarySocket::PrintValues(const double* values)
+{
+  if (socket == 0) return;
+  if (!socket->GetConnectStatus()) return;
+
+  const string& record = Record.BuildRecord(values, GetNumChannels());
+  socket->Send(record);
+}
+}
@@ -0,0 +1,351 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputColumnarFile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Manage output of sim parameters to a columnar file
+ Called by:    FGOutput
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGOutputColumnarFile.h"
+#include "FGFDMExec.h"
+#include "FGXMLElement.h"
+#include "FGLog.h"
+#include "string_utilities.h"
+#include "math/FGFunction.h"
+#include "math/FGPropertyValue.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+// Offsets of the fields of the header
+static const size_t NumRecordsOffset = 32;
+static const size_t NumChunksOffset = 40;
+static const size_t IndexOffsetOffset = 48;
+static const size_t ChannelsSizeOffset = 56;
+static const size_t ChannelsOffset = 60;
+
+static size_t RoundUp(size_t size, size_t alignment)
+{
+  return ((size + alignment - 1) / alignment) * alignment;
+}
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+FGOutputColumnarFile::FGOutputColumnarFile(FGFDMExec* fdmex) :
+  FGOutputFile(fdmex),
+  RecordsPerChunk(4096),
+  RingSize(4),
+  XOREncoding(false),
+  Header(nullptr),
+  Window(nullptr),
+  DataOffset(0),
+  ChunkSize(0),
+  WindowChunk(0),
+  CurrentChunk(0),
+  ChunkRecord(0),
+  NumRecords(0)
+{
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputColumnarFile::Load(Element* el)
+{
+  if (!FGOutputFile::Load(el))
+    return false;
+
+  if (el->HasAttribute("chunk")) {
+    double records = el->GetAttributeValueAsNumber("chunk");
+    if (records < 1.0) {
+      FGXMLLogging log(el, LogLevel::ERROR);
+      log << "The number of records per chunk must be positive.\n";
+      return false;
+    }
+    RecordsPerChunk = static_cast<unsigned int>(records);
+  }
+
+  if (el->HasAttribute("ring")) {
+    double chunks = el->GetAttributeValueAsNumber("ring");
+    if (chunks < 1.0) {
+      FGXMLLogging log(el, LogLevel::ERROR);
+      log << "The number of chunks of the ring must be positive.\n";
+      return false;
+    }
+    RingSize = static_cast<unsigned int>(chunks);
+  }
+
+  string encoding = el->GetAttributeValue("encoding");
+  to_upper(encoding);
+  if (encoding.empty() || encoding == "NONE")
+    XOREncoding = false;
+  else if (encoding == "XOR")
+    XOREncoding = true;
+  else {
+    FGXMLLogging log(el, LogLevel::ERROR);
+    log << "Unknown encoding: " << encoding << ". It must be NONE or XOR.\n";
+    return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputColumnarFile::OpenFile(void)
+{
+  if (!File.Open(Filename)) {
+    FGLogging log(LogLevel::ERROR);
+    log << LogFormat::RED << LogFormat::BOLD << "\nERROR: unable to open the file "
+        << LogFormat::RESET << Filename.c_str()
+        << LogFormat::RED << LogFormat::BOLD << "\n       => Output to this file is disabled.\n\n"
+        << LogFormat::RESET;
+    Disable();
+    return false;
+  }
+
+  if (SubSystems) {
+    FGLogging log(LogLevel::WARN);
+    log << "The subsystems are not recorded in the columnar output "
+        << Name << ". Only the properties and the functions are.\n";
+  }
+
+  FGBinaryRecord record;
+  const string& channels = record.BuildHeader(OutputParameters, OutputCaptions,
+                                              PreFunctions);
+  uint32_t nchannels = 1 + OutputParameters.size() + PreFunctions.size();
+  size_t granularity = FGMappedFile::GetGranularity();
+
+  // The chunks are aligned on the granularity of the memory mapping so that
+  // the window can be mapped at any chunk.
+  DataOffset = RoundUp(ChannelsOffset + channels.size(), granularity);
+  ChunkSize = RoundUp(nchannels*RecordsPerChunk*sizeof(double), granularity);
+  NumRecords = 0;
+  CurrentChunk = 0;
+  ChunkRecord = 0;
+  PreviousBits.assign(nchannels, 0);
+  Index.clear();
+
+  if (File.Resize(DataOffset))
+    Header = File.Map(0, DataOffset);
+
+  if (!Header || !MapWindow(0)) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Unable to map the file " << Filename.c_str() << " in memory.\n"
+        << "       => Output to this file is disabled.\n";
+    CloseFile();
+    Disable();
+    return false;
+  }
+
+  uint16_t version = 1;
+  uint16_t encoding = XOREncoding ? 1 : 0;
+  uint32_t records = RecordsPerChunk;
+  uint64_t chunkSize = ChunkSize;
+  uint64_t dataOffset = DataOffset;
+  uint32_t channelsSize = channels.size();
+
+  memcpy(Header, "JSBC", 4);
+  char* dest = FGBinaryRecord::StoreLittleEndian(Header+4, &version, sizeof(version));
+  dest = FGBinaryRecord::StoreLittleEndian(dest, &encoding, sizeof(encoding));
+  dest = FGBinaryRecord::StoreLittleEndian(dest, &nchannels, sizeof(nchannels));
+  dest = FGBinaryRecord::StoreLittleEndian(dest, &records, sizeof(records));
+  dest = FGBinaryRecord::StoreLittleEndian(dest, &chunkSize, sizeof(chunkSize));
+  FGBinaryRecord::StoreLittleEndian(dest, &dataOffset, sizeof(dataOffset));
+  FGBinaryRecord::StoreLittleEndian(Header+ChannelsSizeOffset, &channelsSize,
+                                    sizeof(channelsSize));
+  memcpy(Header+ChannelsOffset, channels.data(), channels.size());
+  UpdateHeader();
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputColumnarFile::MapWindow(size_t first)
+{
+  size_t length = RingSize*ChunkSize;
+
+  if (Window) {
+    File.Unmap(Window, length);
+    Window = nullptr;
+  }
+
+  // Growing the file only reserves its size: the disk blocks are allocated
+  // by the operating system when the pages are written back.
+  if (!File.Resize(DataOffset + (first + RingSize)*ChunkSize))
+    return false;
+
+  Window = File.Map(DataOffset + first*ChunkSize, length);
+  WindowChunk = first;
+  return Window != nullptr;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::StoreValue(char* chunk, size_t channel,
+                                      double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  uint64_t stored = bits;
+  if (XOREncoding) {
+    stored ^= PreviousBits[channel];
+    PreviousBits[channel] = bits;
+  }
+
+  char* dest = chunk + (channel*RecordsPerChunk + ChunkRecord)*sizeof(double);
+  FGBinaryRecord::StoreLittleEndian(dest, &stored, sizeof(stored));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::UpdateHeader(void)
+{
+  uint64_t nchunks = Index.size();
+
+  FGBinaryRecord::StoreLittleEndian(Header+NumRecordsOffset, &NumRecords,
+                                    sizeof(NumRecords));
+  FGBinaryRecord::StoreLittleEndian(Header+NumChunksOffset, &nchunks,
+                                    sizeof(nchunks));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::Print(void)
+{
+  if (!Window) return;
+
+  char* chunk = Window + (CurrentChunk - WindowChunk)*ChunkSize;
+  double time = FDMExec->GetSimTime();
+  size_t channel = 0;
+
+  StoreValue(chunk, channel++, time);
+  for (auto parameter: OutputParameters)
+    StoreValue(chunk, channel++, parameter->GetValue());
+  for (auto& function: PreFunctions)
+    StoreValue(chunk, channel++, function->getDoubleValue());
+
+  EndRecord(time);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::PrintValues(const double* values)
+{
+  if (!Window) return;
+
+  char* chunk = Window + (CurrentChunk - WindowChunk)*ChunkSize;
+
+  for (size_t channel=0; channel<GetNumChannels(); ++channel)
+    StoreValue(chunk, channel, values[channel]);
+
+  EndRecord(values[0]);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::EndRecord(double time)
+{
+  if (ChunkRecord == 0)
+    Index.push_back({time, time});
+  else
+    Index.back().last = time;
+
+  ++NumRecords;
+  UpdateHeader();
+
+  if (++ChunkRecord == RecordsPerChunk) {
+    ChunkRecord = 0;
+    ++CurrentChunk;
+    fill(PreviousBits.begin(), PreviousBits.end(), 0);
+
+    if (CurrentChunk == WindowChunk + RingSize && !MapWindow(CurrentChunk)) {
+      FGLogging log(LogLevel::ERROR);
+      log << "Unable to extend the file " << Filename.c_str() << ".\n"
+          << "       => Output to this file is disabled.\n";
+      CloseFile();
+      // This method is also called by the writer thread.
+      RequestDisable();
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputColumnarFile::CloseFile(void)
+{
+  if (!File.IsOpen()) return;
+
+  if (Window) {
+    File.Unmap(Window, RingSize*ChunkSize);
+    Window = nullptr;
+  }
+
+  if (Header) {
+    // The header is unmapped while the file is truncated since some systems
+    // do not allow to shrink a file which has mapped regions.
+    File.Unmap(Header, DataOffset);
+    Header = nullptr;
+
+    uint64_t indexOffset = DataOffset + Index.size()*ChunkSize;
+    size_t indexSize = Index.size()*sizeof(ChunkTimes);
+
+    if (File.Resize(indexOffset + indexSize)) {
+      char* index = indexSize > 0 ? File.Map(indexOffset, indexSize) : nullptr;
+      if (index) {
+        char* dest = index;
+        for (auto& chunk: Index) {
+          dest = FGBinaryRecord::StoreLittleEndian(dest, &chunk.first, sizeof(double));
+          dest = FGBinaryRecord::StoreLittleEndian(dest, &chunk.last, sizeof(double));
+        }
+        File.Unmap(index, indexSize);
+      }
+
+      Header = File.Map(0, DataOffset);
+      if (Header) {
+        UpdateHeader();
+        if (index || indexSize == 0)
+          FGBinaryRecord::StoreLittleEndian(Header+IndexOffsetOffset,
+                                            &indexOffset, sizeof(indexOffset));
+        File.Unmap(Header, DataOffset);
+        Header = nullptr;
+      }
+    }
+  }
+
+  File.Close();
+}
+}
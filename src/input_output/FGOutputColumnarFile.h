@@ -0,0 +1,197 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputColumnarFile.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTCOLUMNARFILE_H
+#define FGOUTPUTCOLUMNARFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstdint>
+#include <vector>
+
+#include "FGOutputFile.h"
+#include "FGBinaryRecord.h"
+#include "FGMappedFile.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Records the output in a columnar file for long simulation runs.
+
+    The records are grouped in chunks of a fixed number of records. In a
+    chunk, the values of each channel are stored contiguously as little endian
+    float64 so that a column of a chunk can be mapped directly in memory by the
+    readers. The file is written through a memory mapped window of
+    preallocated chunks: printing a record only copies its values to memory
+    and the operating system transfers them to the disk in the background. The
+    window is moved further in the file each time its chunks are full.
+
+    The file is made of a header, the chunks and, once the file is closed, an
+    index of the chunks:
+
+<pre>
+    Header:
+      char[4]   magic number "JSBC"
+      uint16    version of the format (1)
+      uint16    encoding of the values (0: none, 1: XOR)
+      uint32    number of channels N
+      uint32    number of records per chunk R
+      uint64    size in bytes of a chunk
+      uint64    offset of the first chunk
+      uint64    number of records
+      uint64    number of chunks
+      uint64    offset of the index (0 until the file is closed)
+      uint32    size in bytes of the channels description
+      followed by the description of the channels in the format of
+      FGBinaryRecord (the header of a binary output).
+
+    Chunk k, at (offset of the first chunk + k * size of a chunk):
+      N columns of R float64. Only the first records of the last chunk are
+      valid.
+
+    Index, one entry per chunk:
+      float64   time of the first record of the chunk
+      float64   time of the last record of the chunk
+</pre>
+
+    The number of records is updated after each record so that the file can be
+    read while the simulation is running or after it has been interrupted.
+
+    With the XOR encoding, each value is stored as the exclusive or of its bits
+    with the bits of the previous value of the same column in the chunk (the
+    first value of a column is stored as is). Slowly varying values then have
+    most of their bits set to zero, which improves dramatically the
+    compression ratio of the files by general purpose compressors. The columns
+    are decoded with a cumulative XOR.
+
+    The following attributes of the &lt;output&gt; element are specific to this
+    output:
+    - chunk: the number of records per chunk (4096 by default).
+    - encoding: NONE (default) or XOR.
+    - ring: the number of chunks of the memory mapped window (4 by default).
+
+    @code
+    <output name="endurance.jsbc" type="COLUMNAR" rate="120" chunk="8192"
+            encoding="XOR">
+      <property> position/h-sl-ft </property>
+      <property> velocities/vc-kts </property>
+    </output>
+    @endcode
+
+    Only the simulation time, the properties and the functions of the
+    &lt;output&gt; element are recorded. A column can be read in Python with
+    numpy:
+
+    @code
+    data = np.memmap('endurance.jsbc', dtype='u1', mode='r')
+    chunks = np.ndarray((nchunks, N, R), dtype='<f8', buffer=data,
+                        offset=data_offset, strides=(chunk_size, 8*R, 8))
+    column = chunks[:, channel, :].ravel()[:nrecords]
+    @endcode
+
+    where <tt>chunks[k, channel]</tt> is a view of the column in the chunk k
+    that does not copy the data.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputColumnarFile : public FGOutputFile
+{
+public:
+  /// Constructor
+  FGOutputColumnarFile(FGFDMExec* fdmex);
+  /// Destructor: closes the file and writes the index of the chunks.
+  ~FGOutputColumnarFile() override { CloseFile(); }
+
+  /** Init the output directives from an XML file.
+      @param element XML Element that is pointing to the output directives
+  */
+  bool Load(Element* el) override;
+
+  /// Sets the number of records per chunk.
+  void SetRecordsPerChunk(unsigned int records) { RecordsPerChunk = records; }
+  /// Sets the number of chunks of the memory mapped window.
+  void SetRingSize(unsigned int chunks) { RingSize = chunks; }
+  /// Enables the XOR encoding of the values.
+  void SetXOREncoding(bool xor_encoding) { XOREncoding = xor_encoding; }
+
+  /// Generates the output to the columnar file.
+  void Print(void) override;
+
+protected:
+  bool OpenFile(void) override;
+  void CloseFile(void) override;
+  bool SupportsAsync(void) const override { return true; }
+  void PrintValues(const double* values) override;
+
+private:
+  struct ChunkTimes {
+    double first;
+    double last;
+  };
+
+  unsigned int RecordsPerChunk;
+  unsigned int RingSize;
+  bool XOREncoding;
+
+  FGMappedFile File;
+  char* Header;
+  char* Window;
+  size_t DataOffset;
+  size_t ChunkSize;
+  size_t WindowChunk;
+  size_t CurrentChunk;
+  unsigned int ChunkRecord;
+  uint64_t NumRecords;
+  std::vector<uint64_t> PreviousBits;
+  std::vector<ChunkTimes> Index;
+
+  bool MapWindow(size_t first);
+  void StoreValue(char* chunk, size_t channel, double value);
+  void UpdateHeader(void);
+  void EndRecord(double time);
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -40,9 +40,12 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <cstring>
+#include <new>
 
 #include "FGOutputFG.h"
+#include "FGFDMExec.h"
 #include "FGXMLElement.h"
+#include "string_utilities.h"
 #include "models/FGAuxiliary.h"
 #include "models/FGPropulsion.h"
 #include "models/FGFCS.h"
@@ -116,7 +119,8 @@ CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 FGOutputFG::FGOutputFG(FGFDMExec* fdmex) :
-  FGOutputSocket(fdmex), outputOptions{false, 1e6}
+  FGOutputSocket(fdmex), outputOptions{false, 1e6}, Region(nullptr),
+  SharedMemory(false)
 {
   memset(&fgSockBuf, 0x0, sizeof(fgSockBuf));
 
@@ -144,12 +148,34 @@ FGOutputFG::FGOutputFG(FGFDMExec* fdmex) :
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGOutputFG::~FGOutputFG()
+{
+  if (Region) SharedFile.Unmap((char*)Region, sizeof(SharedRegion));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGOutputFG::Load(Element* el)
 {
   if (!FGOutputSocket::Load(el)) {
     return false;
   }
 
+  string protocol = el->GetAttributeValue("protocol");
+  if (to_upper(protocol) == "SHM") {
+    SharedMemory = true;
+
+    SGPath path = SGPath::fromUtf8(el->GetAttributeValue("name"));
+    if (path.isRelative()) {
+#ifdef __linux__
+      path = SGPath("/dev/shm") / path.utf8Str();
+#else
+      path = FDMExec->GetOutputPath() / path.utf8Str();
+#endif
+    }
+    Name = path.utf8Str();
+  }
+
   // Check if there is a <time> element
   Element* time_el = el->FindElement("time");
   if (time_el) {
@@ -173,6 +199,38 @@ bool FGOutputFG::Load(Element* el)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGOutputFG::InitModel(void)
+{
+  if (!SharedMemory)
+    return FGOutputSocket::InitModel();
+
+  if (!FGOutputType::InitModel())
+    return false;
+
+  // The region is kept across the resets so that the readers can keep their
+  // own mapping of the file.
+  if (Region) return true;
+
+  SGPath path = SGPath::fromUtf8(Name);
+  if (SharedFile.Open(path) && SharedFile.Resize(sizeof(SharedRegion)))
+    Region = reinterpret_cast<SharedRegion*>(SharedFile.Map(0, sizeof(SharedRegion)));
+
+  if (!Region) {
+    FGLogging log(LogLevel::ERROR);
+    log << "Could not map the shared memory " << path << "\n";
+    return false;
+  }
+
+  // The file is zero filled by Resize().
+  memcpy(Region->Magic, "JSBF", 4);
+  Region->Size = sizeof(FGNetFDM);
+  new (&Region->Sequence) std::atomic<uint64_t>(0);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputFG::SocketDataFill(FGNetFDM* net)
 {
   unsigned int i;
@@ -298,8 +356,9 @@ void FGOutputFG::SocketDataFill(FGNetFDM* net)
   net->speedbrake        = (float)(FCS->GetDsbPos(ofNorm));   // Norm Speedbrake Pos, --
   net->spoilers          = (float)(FCS->GetDspPos(ofNorm));   // Norm Spoiler Pos, --
 
-  // Convert the net buffer to network format
-  if ( isLittleEndian ) {
+  // Convert the net buffer to network format. The shared memory carries the
+  // native layout.
+  if ( isLittleEndian && !SharedMemory ) {
     net->version = htonl(net->version);
 
     htond(net->longitude);
@@ -381,6 +440,19 @@ void FGOutputFG::Print(void)
 {
   int length = sizeof(fgSockBuf);
 
+  if (SharedMemory) {
+    if (!Region) return;
+
+    // The data is filled in place, between the two increments of the
+    // sequence number.
+    uint64_t sequence = Region->Sequence.load(std::memory_order_relaxed);
+    Region->Sequence.store(sequence+1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    SocketDataFill(&Region->Data);
+    Region->Sequence.store(sequence+2, std::memory_order_release);
+    return;
+  }
+
   if (socket == 0) return;
   if (!socket->GetConnectStatus()) return;
 
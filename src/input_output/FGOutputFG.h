@@ -39,9 +39,13 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
+#include <cstdint>
+
 #include "FGOutputSocket.h"
 #include "input_output/net_fdm.hxx"
 #include "input_output/FGfdmSocket.h"
+#include "input_output/FGMappedFile.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -54,6 +58,32 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /** Implements the output to a FlightGear socket.
+
+    When the attribute <tt>protocol="SHM"</tt> is specified, the FGNetFDM
+    structure is instead published in a memory mapped file, for the visual
+    systems that run on the same host. The file is created in /dev/shm on
+    Linux (in the output directory elsewhere) and is named after the attribute
+    name:
+
+@code
+<output type="FLIGHTGEAR" protocol="SHM" name="jsbsim-fdm" rate="60"/>
+@endcode
+
+    The file contains a SharedRegion: the FGNetFDM structure is stored in the
+    native byte order of the host, without any conversion, and is protected by
+    a sequence lock. The sequence number is odd while the structure is
+    updated, so a reader gets a consistent copy of the latest state with:
+
+@code
+uint64_t before, after;
+FGNetFDM fdm;
+do {
+  before = region->Sequence.load(std::memory_order_acquire);
+  memcpy(&fdm, &region->Data, sizeof(FGNetFDM));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  after = region->Sequence.load(std::memory_order_relaxed);
+} while (before != after || (before & 1));
+@endcode
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -65,6 +95,7 @@ class FGOutputFG : public FGOutputSocket
 public:
   /// Constructor
   FGOutputFG(FGFDMExec* fdmex);
+  ~FGOutputFG() override;
 
   void Print(void) override;
 
@@ -73,6 +104,18 @@ public:
   */
   bool Load(Element*) override;
 
+  /** Opens the socket or maps the shared memory.
+      @result true if the execution succeeded. */
+  bool InitModel(void) override;
+
+  /// Layout of the memory mapped file of the SHM protocol.
+  struct SharedRegion {
+    char Magic[4];                   // "JSBF"
+    uint32_t Size;                   // sizeof(FGNetFDM)
+    std::atomic<uint64_t> Sequence;  // Odd while Data is updated
+    FGNetFDM Data;
+  };
+
 protected:
   void PrintHeaders(void) override {};
 
@@ -84,6 +127,10 @@ private:
   } outputOptions;
 
   FGNetFDM fgSockBuf;
+  FGMappedFile SharedFile;
+  SharedRegion* Region;
+  bool SharedMemory;
+
   void SocketDataFill(FGNetFDM* net);
 };
 }
@@ -403,4 +403,33 @@ void FGOutputTextFile::Print(void)
   outstream << endl;
   outstream.flush();
 }
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputTextFile::SupportsAsync(void) const
+{
+  // The subsystems values are read from the models while the record is
+  // printed, and the console logger is local to the simulation thread.
+  string scratch = Filename.utf8Str();
+  return SubSystems == 0 && to_upper(scratch) != "COUT";
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputTextFile::PrintValues(const double* values)
+{
+  if (!datafile.is_open()) return;
+
+  ostream outstream(datafile.rdbuf());
+
+  outstream.precision(10);
+  outstream << values[0];
+
+  outstream.precision(18);
+  for (size_t i=1; i<GetNumChannels(); ++i)
+    outstream << delimeter << values[i];
+
+  outstream << endl;
+  outstream.flush();
+}
 }
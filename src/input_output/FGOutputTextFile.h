@@ -56,6 +56,9 @@ CLASS DOCUMENTATION
 /** Implements the output to a human readable text file. This class uses the
     standard C++ library to open and close a file to which output values are
     comma-separated (CSV) or tabulated (TAB).
+
+    The output can be asynchronous (see FGOutputType) when it records no
+    subsystems and is not directed to the console.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -88,6 +91,8 @@ protected:
 
   bool OpenFile(void) override;
   void CloseFile(void) override { if (datafile.is_open()) datafile.close(); }
+  bool SupportsAsync(void) const override;
+  void PrintValues(const double* values) override;
 };
 }
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
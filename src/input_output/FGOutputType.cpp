@@ -44,6 +44,7 @@ INCLUDES
 #include "math/FGTemplateFunc.h"
 #include "math/FGFunctionValue.h"
 #include "FGLog.h"
+#include "string_utilities.h"
 
 using namespace std;
 
@@ -56,7 +57,11 @@ CLASS IMPLEMENTATION
 FGOutputType::FGOutputType(FGFDMExec* fdmex) :
   FGModel(fdmex),
   SubSystems(0),
-  enabled(true)
+  enabled(true),
+  DisableRequested(false),
+  Async(false),
+  Overflow(FGOutputWriter::eOverflow::Block),
+  QueueSize(256)
 {
   Aerodynamics = FDMExec->GetAerodynamics();
   Auxiliary = FDMExec->GetAuxiliary();
@@ -78,6 +83,8 @@ FGOutputType::FGOutputType(FGFDMExec* fdmex) :
 
 FGOutputType::~FGOutputType()
 {
+  Writer.reset();
+
   for (auto param: OutputParameters)
     delete param;
 
@@ -92,6 +99,8 @@ void FGOutputType::SetIdx(unsigned int idx)
 
   PropertyManager->Tie(outputProp + "/log_rate_hz", this, &FGOutputType::GetRateHz, &FGOutputType::SetRateHz);
   PropertyManager->Tie(outputProp + "/enabled", &enabled);
+  PropertyManager->Tie(outputProp + "/dropped-records", this, &FGOutputType::GetDroppedRecords);
+  PropertyManager->Tie(outputProp + "/queued-records", this, &FGOutputType::GetQueuedRecords);
   OutputIdx = idx;
 }
 
@@ -168,6 +177,36 @@ bool FGOutputType::Load(Element* element)
 
   SetRateHz(outRate);
 
+  string async = element->GetAttributeValue("async");
+  Async = to_upper(async) == "ON";
+
+  if (element->HasAttribute("overflow")) {
+    string overflow = element->GetAttributeValue("overflow");
+    to_upper(overflow);
+    if (overflow == "BLOCK")
+      Overflow = FGOutputWriter::eOverflow::Block;
+    else if (overflow == "DROP")
+      Overflow = FGOutputWriter::eOverflow::Drop;
+    else if (overflow == "GROW")
+      Overflow = FGOutputWriter::eOverflow::Grow;
+    else {
+      FGXMLLogging log(element, LogLevel::ERROR);
+      log << "Unknown overflow policy: " << overflow
+          << ". It must be BLOCK, DROP or GROW.\n";
+      return false;
+    }
+  }
+
+  if (element->HasAttribute("queue")) {
+    double records = element->GetAttributeValueAsNumber("queue");
+    if (records < 1.0) {
+      FGXMLLogging log(element, LogLevel::ERROR);
+      log << "The number of records of the queue must be positive.\n";
+      return false;
+    }
+    QueueSize = static_cast<unsigned int>(records);
+  }
+
   return true;
 }
 
@@ -175,6 +214,9 @@ bool FGOutputType::Load(Element* element)
 
 bool FGOutputType::InitModel(void)
 {
+  // The derived classes may reopen their file or socket.
+  Flush();
+
   bool ret = FGModel::InitModel();
 
   Debug(2);
@@ -186,10 +228,11 @@ bool FGOutputType::InitModel(void)
 bool FGOutputType::Run(bool Holding)
 {
   if (FGModel::Run(Holding)) return true;
+  if (DisableRequested.exchange(false)) Disable();
   if (!enabled) return true;
 
   RunPreFunctions();
-  Print();
+  Generate();
   RunPostFunctions();
 
   Debug(4);
@@ -199,6 +242,47 @@ bool FGOutputType::Run(bool Holding)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGOutputType::Generate(void)
+{
+  if (Async && !Writer) {
+    if (SupportsAsync()) {
+      Writer = make_unique<FGOutputWriter>(GetNumChannels(), QueueSize, Overflow,
+                                           [this](const double* values) {
+                                             PrintValues(values);
+                                           });
+    } else {
+      FGLogging log(LogLevel::WARN);
+      log << "The output " << Name << " can not be generated asynchronously."
+          << " It is generated by the simulation thread.\n";
+      Async = false;
+    }
+  }
+
+  if (!Writer) {
+    Print();
+    return;
+  }
+
+  double* values = Writer->Acquire();
+  if (values) {
+    CaptureValues(values);
+    Writer->Commit();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputType::CaptureValues(double* values) const
+{
+  *values++ = FDMExec->GetSimTime();
+  for (auto parameter: OutputParameters)
+    *values++ = parameter->GetValue();
+  for (auto& function: PreFunctions)
+    *values++ = function->getDoubleValue();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGOutputType::SetRateHz(double rtHz)
 {
   rtHz = rtHz>1000?1000:(rtHz<0?0:rtHz);
@@ -38,9 +38,11 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
 #include <memory>
 
 #include "models/FGModel.h"
+#include "FGOutputWriter.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -82,6 +84,24 @@ CLASS DOCUMENTATION
     The class mimics some functionalities of FGModel (methods InitModel(),
     Run() and SetRate()). However it does not inherit from FGModel since it is
     conceptually different from the model paradigm.
+
+    An output can be generated asynchronously by a writer thread (see
+    FGOutputWriter) so that a slow disk or network peer does not delay the
+    simulation. The simulation thread then only captures the values of the
+    channels (the simulation time, the properties and the functions of the
+    output) and the writer thread formats them and performs the I/O. This is
+    enabled by the following attributes of the &lt;output&gt; element:
+    - async: ON to enable the asynchronous output (OFF by default).
+    - overflow: the policy applied when the queue of the records is full:
+      BLOCK (the default) waits for the writer thread, DROP discards the
+      record and GROW enlarges the queue.
+    - queue: the number of records of the queue (256 by default).
+
+    Only the outputs that override SupportsAsync() can be asynchronous, the
+    others are generated synchronously with a warning. The number of dropped
+    records and of the records waiting to be written are available in the
+    properties <tt>simulation/output[idx]/dropped-records</tt> and
+    <tt>simulation/output[idx]/queued-records</tt>.
  */
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -157,6 +177,26 @@ public:
    */
   virtual void Print(void) = 0;
 
+  /** Generate the output, or queue the values of its channels for the writer
+      thread when the output is asynchronous. This method should be called
+      instead of Print() by the output manager. */
+  void Generate(void);
+
+  /** Waits until the writer thread has generated all the queued records. It
+      must be called before the file or the socket of an asynchronous output
+      is closed or reopened. */
+  void Flush(void) { if (Writer) Writer->Flush(); }
+
+  /// Stops the writer thread after it has generated the queued records.
+  void StopWriter(void) { Writer.reset(); }
+
+  /// Returns the number of records dropped by the asynchronous output.
+  double GetDroppedRecords(void) const
+  { return Writer ? Writer->GetDroppedRecords() : 0.0; }
+  /// Returns the number of records waiting to be written by the writer thread.
+  double GetQueuedRecords(void) const
+  { return Writer ? Writer->GetQueuedRecords() : 0.0; }
+
   /** Reset the output prior to a restart of the simulation. This method should
       be called when the simulation is restarted with, for example, new initial
       conditions. When this method is executed the output instance can take
@@ -173,6 +213,10 @@ public:
       @result the output generation status i.e. true if the output has been
               enabled, false if the output has been disabled. */
   bool Toggle(void) {enabled = !enabled; return enabled;}
+  /** Requests the output generation to be disabled. Unlike Disable(), this
+      method can be called from the writer thread: the output is disabled by
+      the simulation thread when the output is next run. */
+  void RequestDisable(void) { DisableRequested = true; }
 
   /// Subsystem types for specifying which will be output in the FDM data logging
   enum  eSubSystems {
@@ -197,6 +241,12 @@ protected:
   std::vector <FGPropertyValue*> OutputParameters;
   std::vector <std::string> OutputCaptions;
   bool enabled;
+  std::atomic<bool> DisableRequested;
+
+  bool Async;
+  FGOutputWriter::eOverflow Overflow;
+  unsigned int QueueSize;
+  std::unique_ptr<FGOutputWriter> Writer;
 
   std::shared_ptr<FGAerodynamics> Aerodynamics;
   std::shared_ptr<FGAuxiliary> Auxiliary;
@@ -211,6 +261,23 @@ protected:
   std::shared_ptr<FGExternalReactions> ExternalReactions;
   std::shared_ptr<FGBuoyantForces> BuoyantForces;
 
+  /** Returns true if the output can be generated by PrintValues() from the
+      values captured by CaptureValues(). */
+  virtual bool SupportsAsync(void) const { return false; }
+  /** Stores the current values of the channels: the simulation time followed
+      by the properties and the functions of the output.
+      @param values where the 1 + OutputParameters.size() + PreFunctions.size()
+                    values are stored */
+  void CaptureValues(double* values) const;
+  /// Returns the number of values stored by CaptureValues().
+  size_t GetNumChannels(void) const
+  { return 1 + OutputParameters.size() + PreFunctions.size(); }
+  /** Generates the output from the values of the channels. This method is
+      called by the writer thread for the outputs that support asynchronous
+      output.
+      @param values the values stored by CaptureValues() */
+  virtual void PrintValues(const double* values) {}
+
   void Debug(int from) override;
 };
 }
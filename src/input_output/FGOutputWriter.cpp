@@ -0,0 +1,186 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGOutputWriter.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Generate the output records in a background thread
+ Called by:    FGOutputType
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include "FGOutputWriter.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// The threads only sleep on the condition variables once they have raised their
+// "waiting" flag. Since the flags and the indices of the queue are sequentially
+// consistent atomics, a thread that updates an index either sees the flag of
+// the other thread raised (and wakes it up) or the other thread sees the
+// updated index before going to sleep.
+
+FGOutputWriter::FGOutputWriter(size_t recordSize, size_t capacity,
+                               eOverflow overflow,
+                               function<void(const double*)> write)
+  : RecordSize(recordSize), Overflow(overflow), Write(write),
+    Committed(0), Written(0), Dropped(0), ProducerWaiting(false),
+    ConsumerWaiting(false), Stop(false)
+{
+  WriteSegment = ReadSegment = new Segment(max<size_t>(capacity, 1),
+                                           RecordSize);
+  Thread = thread(&FGOutputWriter::Run, this);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGOutputWriter::~FGOutputWriter()
+{
+  Stop = true;
+  {
+    lock_guard<mutex> lock(Mutex);
+    ConsumerCV.notify_one();
+  }
+  Thread.join();
+
+  while (ReadSegment) {
+    Segment* next = ReadSegment->Next;
+    delete ReadSegment;
+    ReadSegment = next;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGOutputWriter::IsFull(const Segment* segment) const
+{
+  return segment->Head - segment->Tail == segment->Capacity;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double* FGOutputWriter::Acquire(void)
+{
+  Segment* segment = WriteSegment;
+
+  if (IsFull(segment)) {
+    switch (Overflow) {
+    case eOverflow::Drop:
+      ++Dropped;
+      return nullptr;
+    case eOverflow::Grow:
+      // The full segment is no longer written: the writer thread moves to the
+      // new one once it has emptied it.
+      segment = new Segment(2*segment->Capacity, RecordSize);
+      WriteSegment->Next = segment;
+      WriteSegment = segment;
+      break;
+    case eOverflow::Block:
+      {
+        unique_lock<mutex> lock(Mutex);
+        ProducerWaiting = true;
+        ProducerCV.wait(lock, [&]{ return !IsFull(segment); });
+        ProducerWaiting = false;
+      }
+      break;
+    }
+  }
+
+  return &segment->Values[(segment->Head % segment->Capacity)*RecordSize];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Commit(void)
+{
+  ++WriteSegment->Head;
+  ++Committed;
+
+  if (ConsumerWaiting) {
+    lock_guard<mutex> lock(Mutex);
+    ConsumerCV.notify_one();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Flush(void)
+{
+  unique_lock<mutex> lock(Mutex);
+  ProducerWaiting = true;
+  ProducerCV.wait(lock, [&]{ return Written == Committed; });
+  ProducerWaiting = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutputWriter::Run(void)
+{
+  for (;;) {
+    Segment* segment = ReadSegment;
+    size_t tail = segment->Tail;
+
+    if (tail == segment->Head) {
+      if (segment->Next) {
+        // The head of a segment is final once the next segment is linked.
+        if (tail == segment->Head) {
+          ReadSegment = segment->Next;
+          delete segment;
+        }
+        continue;
+      }
+
+      unique_lock<mutex> lock(Mutex);
+      ConsumerWaiting = true;
+      ConsumerCV.wait(lock, [&]{
+        return tail != segment->Head || segment->Next || Stop;
+      });
+      ConsumerWaiting = false;
+
+      // The pending records are written before the thread is stopped.
+      if (Stop && tail == segment->Head && !segment->Next) break;
+      continue;
+    }
+
+    // The slot is released once its record is written so that the producer
+    // can not overwrite it meanwhile.
+    Write(&segment->Values[(tail % segment->Capacity)*RecordSize]);
+    segment->Tail = tail + 1;
+    ++Written;
+
+    if (ProducerWaiting) {
+      lock_guard<mutex> lock(Mutex);
+      ProducerCV.notify_one();
+    }
+  }
+}
+}
@@ -0,0 +1,158 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGOutputWriter.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGOUTPUTWRITER_H
+#define FGOUTPUTWRITER_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Background thread that generates the records of an asynchronous output.
+
+    The simulation thread (the producer) captures the values of the channels
+    of a record in a slot of a single producer, single consumer queue and the
+    writer thread (the consumer) calls the output function with the values of
+    each record, in the order in which they were captured. The slots of the
+    queue are preallocated so capturing a record neither allocates memory nor
+    takes a lock, except when the writer thread is asleep and must be woken up.
+
+    A record is captured in two steps:
+    @code
+    double* values = writer.Acquire();
+    if (values) {
+      // Fill the values of the record
+      writer.Commit();
+    }
+    @endcode
+
+    The policy applied when the queue is full is one of:
+    - Block: the simulation thread waits for the writer thread to free a slot.
+      No record is lost.
+    - Drop: the record is discarded and counted by GetDroppedRecords().
+    - Grow: a new queue twice as large is chained to the full one. No record is
+      lost and the simulation thread never waits, at the expense of memory.
+ */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class FGOutputWriter
+{
+public:
+  enum class eOverflow {Block, Drop, Grow};
+
+  /** Constructor. Starts the writer thread.
+      @param recordSize the number of values of a record
+      @param capacity the number of records of the queue
+      @param overflow the policy applied when the queue is full
+      @param write the function called by the writer thread for each record */
+  FGOutputWriter(size_t recordSize, size_t capacity, eOverflow overflow,
+                 std::function<void(const double*)> write);
+  /// Destructor: writes the pending records then stops the writer thread.
+  ~FGOutputWriter();
+
+  FGOutputWriter(const FGOutputWriter&) = delete;
+  FGOutputWriter& operator=(const FGOutputWriter&) = delete;
+
+  /** Returns the slot where the values of the next record must be stored, or
+      nullptr if the queue is full and the record is dropped. */
+  double* Acquire(void);
+  /// Queues the record stored in the slot returned by Acquire().
+  void Commit(void);
+
+  /// Waits until the writer thread has written all the queued records.
+  void Flush(void);
+
+  /// Returns the number of records that have been dropped.
+  uint64_t GetDroppedRecords(void) const { return Dropped.load(); }
+  /// Returns the number of records that are waiting to be written.
+  uint64_t GetQueuedRecords(void) const { return Committed.load() - Written.load(); }
+
+private:
+  struct Segment {
+    Segment(size_t capacity, size_t recordSize)
+      : Values(capacity*recordSize), Capacity(capacity), Head(0), Tail(0),
+        Next(nullptr) {}
+
+    std::vector<double> Values;
+    size_t Capacity;
+    std::atomic<size_t> Head; // Written by the producer
+    std::atomic<size_t> Tail; // Written by the consumer
+    std::atomic<Segment*> Next;
+  };
+
+  size_t RecordSize;
+  eOverflow Overflow;
+  std::function<void(const double*)> Write;
+
+  Segment* WriteSegment; // Only accessed by the producer
+  Segment* ReadSegment;  // Only accessed by the consumer
+
+  std::atomic<uint64_t> Committed;
+  std::atomic<uint64_t> Written;
+  std::atomic<uint64_t> Dropped;
+  std::atomic<bool> ProducerWaiting;
+  std::atomic<bool> ConsumerWaiting;
+  std::atomic<bool> Stop;
+
+  std::mutex Mutex;
+  std::condition_variable ProducerCV;
+  std::condition_variable ConsumerCV;
+  std::thread Thread;
+
+  void Run(void);
+  bool IsFull(const Segment* segment) const;
+};
+}
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
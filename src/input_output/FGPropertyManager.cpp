@@ -142,6 +142,74 @@ string GetRelativeName(const SGPropertyNode* node, const string &path)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGPropertyManager::IsAttached(const SGPropertyNode* node) const
+{
+  // A node that has been removed is detached from its parent so its topmost
+  // ancestor is no longer the root of the tree.
+  const SGPropertyNode* top = node;
+  while (top->getParent()) top = top->getParent();
+
+  return top == root->getRootNode();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPropertyNode* FGPropertyManager::ResolveNode(size_t handle, bool create) const
+{
+  IndexedNode& entry = indexed_nodes[handle];
+
+  if (!entry.node || !IsAttached(entry.node))
+    entry.node = root->getNode(entry.path, create);
+
+  return entry.node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+SGPropertyNode* FGPropertyManager::FindNode(const string& path, bool create) const
+{
+  auto it = node_index.find(path);
+  if (it != node_index.end())
+    return ResolveNode(it->second, create);
+
+  // Only the paths that exist are indexed.
+  SGPropertyNode* node = root->getNode(path, create);
+  if (node) {
+    node_index[path] = indexed_nodes.size();
+    indexed_nodes.push_back({path, node});
+  }
+
+  return node;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+size_t FGPropertyManager::GetHandle(const string& path, bool create)
+{
+  if (!FindNode(path, create))
+    throw BaseException("The property " + path + " does not exist.");
+
+  return node_index[path];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGPropertyManager::GetDoubleValue(size_t handle) const
+{
+  SGPropertyNode* node = ResolveNode(handle, false);
+  return node ? node->getDoubleValue() : 0.0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropertyManager::SetDoubleValue(size_t handle, double value)
+{
+  SGPropertyNode* node = ResolveNode(handle, true);
+  if (node) node->setDoubleValue(value);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropertyManager::Untie(const string &name)
 {
   SGPropertyNode* property = root->getNode(name.c_str());
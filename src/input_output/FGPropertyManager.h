@@ -45,6 +45,8 @@ INCLUDES
 #include <list>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include "simgear/props/props.hxx"
 #if !PROPS_STANDALONE
 # include "simgear/math/SGMath.hxx"
@@ -141,18 +143,52 @@ class JSBSIM_API FGPropertyManager
     virtual ~FGPropertyManager(void) { Unbind(); }
 
     SGPropertyNode* GetNode(void) const { return root; }
+    /** Get a node from its path.
+        The paths that have already been found are kept in a hash index so
+        that the tree is only walked the first time a path is requested.
+        @param path the path of the node
+        @param create true if the node must be created when it does not exist
+        @return the node or nullptr if it does not exist and create is false */
     SGPropertyNode* GetNode(const std::string &path, bool create = false)
-    { return root->getNode(path, create); }
+    { return FindNode(path, create); }
     SGPropertyNode* GetNode(const std::string &relpath, int index, bool create = false)
     { return root->getNode(relpath, index, create); }
     bool HasNode(const std::string& path) const
     {
       std::string newPath = path;
       if (newPath[0] == '-') newPath.erase(0,1);
-      SGPropertyNode* prop = root->getNode(newPath);
+      SGPropertyNode* prop = FindNode(newPath, false);
       return prop != nullptr;
     }
 
+    /** Interns a property path.
+        The handle that is returned gives access to the property without any
+        string processing nor tree walk. It remains valid for the lifetime of
+        the manager: if the node is removed from the tree, the path is looked
+        up again the next time the handle is used.
+        @param path the path of the property
+        @param create true if the property must be created when it does not
+                      exist
+        @return the handle of the property
+        @throw BaseException if the property does not exist and create is
+               false */
+    size_t GetHandle(const std::string& path, bool create = false);
+    /** Get the node of an interned property.
+        @param handle a handle returned by GetHandle()
+        @return the node or nullptr if it has been removed from the tree. */
+    SGPropertyNode* GetNode(size_t handle) const
+    { return ResolveNode(handle, false); }
+    /** Get the value of an interned property.
+        @param handle a handle returned by GetHandle()
+        @return the value of the property or 0.0 if it has been removed from
+                the tree. */
+    double GetDoubleValue(size_t handle) const;
+    /** Set the value of an interned property.
+        The property is created again if it has been removed from the tree.
+        @param handle a handle returned by GetHandle()
+        @param value the value of the property */
+    void SetDoubleValue(size_t handle, double value);
+
     /** Property-ify a name
      *  replaces spaces with '-' and, optionally, makes name all lower case
      *  @param name string to change
@@ -419,6 +455,17 @@ class JSBSIM_API FGPropertyManager
     };
     std::list<PropertyState> tied_properties;
     SGPropertyNode_ptr root;
+
+    struct IndexedNode {
+      std::string path;
+      SGPropertyNode_ptr node;
+    };
+    mutable std::vector<IndexedNode> indexed_nodes;
+    mutable std::unordered_map<std::string, size_t> node_index;
+
+    SGPropertyNode* FindNode(const std::string& path, bool create) const;
+    SGPropertyNode* ResolveNode(size_t handle, bool create) const;
+    bool IsAttached(const SGPropertyNode* node) const;
 };
 }
 #endif // FGPROPERTYMANAGER_H
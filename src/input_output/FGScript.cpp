@@ -42,6 +42,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iomanip>
+#include <algorithm>
 
 #include "FGScript.h"
 #include "FGFDMExec.h"
@@ -51,6 +52,7 @@ INCLUDES
 #include "math/FGCondition.h"
 #include "math/FGFunctionValue.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -62,7 +64,9 @@ CLASS IMPLEMENTATION
 
 // Constructor
 
-FGScript::FGScript(FGFDMExec* fgex) : FDMExec(fgex)
+FGScript::FGScript(FGFDMExec* fgex)
+  : InputEpoch(0), InputChanges(0), ScheduleCount(0), LastTime(-HUGE_VAL),
+    FDMExec(fgex)
 {
   PropertyManager=FDMExec->GetPropertyManager();
 
@@ -227,6 +231,10 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
   LocalProperties.Load(run_element, PropertyManager.get(), true);
   debug_lvl = saved_debug_lvl;
 
+  // The time tests are extracted from the conditions to schedule the events.
+  const string timeName = GetFullyQualifiedName(PropertyManager->GetNode("simulation/sim-time-sec"));
+  map<string, unsigned int> inputIndices;
+
   // Read "events" from script
 
   event_element = run_element->FindElement("event");
@@ -261,6 +269,26 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
         return false;
       }
       newEvent->Condition = newCondition;
+
+      vector<FGPropertyValue*> properties;
+      if (newCondition->GetDependencies(timeName, newEvent->WakeUpTime,
+                                        newEvent->StrictWakeUp, properties)) {
+        newEvent->Dynamic = false;
+        for (auto property: properties) {
+          string name = property->GetFullyQualifiedName();
+          auto it = inputIndices.find(name);
+          if (it == inputIndices.end()) {
+            it = inputIndices.emplace(name, Inputs.size()).first;
+            Inputs.push_back({property, 0.0, 0, 0});
+          }
+          auto& eventInputs = newEvent->Inputs;
+          if (find(eventInputs.begin(), eventInputs.end(), it->second) == eventInputs.end())
+            eventInputs.push_back(it->second);
+        }
+      } else {
+        newEvent->WakeUpTime = -HUGE_VAL;
+        newEvent->StrictWakeUp = false;
+      }
     } else {
       FGXMLLogging log(event_element, LogLevel::ERROR);
       log << "No condition specified in script event " << newEvent->Name << "\n";
@@ -372,6 +400,8 @@ bool FGScript::LoadScript(const SGPath& script, double default_dT,
     event_element = run_element->FindNextElement("event");
   }
 
+  ScheduleEvents();
+
   Debug(4);
 
   return true;
@@ -386,6 +416,58 @@ void FGScript::ResetEvents(void)
 
   for (unsigned int i=0; i<Events.size(); i++)
     Events[i].reset();
+
+  ScheduleEvents();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::ScheduleEvents(void)
+{
+  // All the events are evaluated at the next time step. Those which conditions
+  // are false until a later time then go back to sleep.
+  Timers = decltype(Timers)();
+  ActiveEvents.clear();
+  ++ScheduleCount;
+
+  for (unsigned int i=0; i<Events.size(); i++) {
+    struct event &thisEvent = Events[i];
+
+    thisEvent.Stamp = 0;
+    ActiveEvents.push_back(i);
+
+    // Bind the properties that did not exist when the script was loaded.
+    for (unsigned int j=0; j<thisEvent.SetParam.size(); j++) {
+      if (!thisEvent.SetParam[j] && PropertyManager->HasNode(thisEvent.SetParamName[j]))
+        thisEvent.SetParam[j] = PropertyManager->GetNode(thisEvent.SetParamName[j]);
+    }
+  }
+
+  LastTime = -HUGE_VAL;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGScript::InputsChanged(const struct event& thisEvent)
+{
+  bool changed = thisEvent.Stamp == 0;
+
+  // The inputs are read at most once per epoch. The epoch changes at each time
+  // step and each time the script sets a property.
+  for (unsigned int idx: thisEvent.Inputs) {
+    input& in = Inputs[idx];
+    if (in.Epoch != InputEpoch) {
+      double value = in.Property->GetValue();
+      if (value != in.Value) {
+        in.Value = value;
+        in.Changed = ++InputChanges;
+      }
+      in.Epoch = InputEpoch;
+    }
+    if (in.Changed >= thisEvent.Stamp) changed = true;
+  }
+
+  return changed;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -393,16 +475,45 @@ void FGScript::ResetEvents(void)
 bool FGScript::RunScript(void)
 {
   unsigned i, j;
-  unsigned event_ctr = 0;
+  size_t nactive = 0;
 
   double currentTime = FDMExec->GetSimTime();
   double newSetValue = 0;
 
   if (currentTime > EndTime) return false;
 
-  // Iterate over all events.
-  for (unsigned int ev_ctr=0; ev_ctr < Events.size(); ev_ctr++) {
+  // The events can no longer be trusted to sleep if the time has gone back.
+  if (currentTime < LastTime) ScheduleEvents();
+  LastTime = currentTime;
+
+  // Wake up the events which time has come. They are inserted in the list of
+  // the active events which is kept sorted for the events to be executed in
+  // the order of the script.
+  if (!Timers.empty()) {
+    size_t nsleeping = ActiveEvents.size();
+
+    while (!Timers.empty()) {
+      unsigned int ev_ctr = get<2>(Timers.top());
+      if (!Events[ev_ctr].IsAwake(currentTime)) break;
+      ActiveEvents.push_back(ev_ctr);
+      Timers.pop();
+    }
+
+    if (ActiveEvents.size() > nsleeping) {
+      sort(ActiveEvents.begin() + nsleeping, ActiveEvents.end());
+      inplace_merge(ActiveEvents.begin(), ActiveEvents.begin() + nsleeping,
+                    ActiveEvents.end());
+    }
+  }
 
+  ++InputEpoch;
+
+  unsigned long scheduleCount = ScheduleCount;
+
+  // Iterate over the active events.
+  for (size_t k=0; k < ActiveEvents.size(); k++) {
+
+    unsigned int ev_ctr = ActiveEvents[k];
     struct event &thisEvent = Events[ev_ctr];
 
     // Determine whether the set of conditional tests for this condition equate
@@ -410,58 +521,73 @@ bool FGScript::RunScript(void)
     // to true, then the event is triggered. If the event is not persistent,
     // then this trigger will remain set true. If the event is persistent, the
     // trigger will reset to false when the condition evaluates to false.
-    if (thisEvent.Condition->Evaluate()) {
-      if (!thisEvent.Triggered) {
-
-        // The conditions are true, do the setting of the desired Event
-        // parameters
-        for (i=0; i<thisEvent.SetValue.size(); i++) {
-          if (thisEvent.SetParam[i] == 0L) { // Late bind property if necessary
-            if (PropertyManager->HasNode(thisEvent.SetParamName[i])) {
-              thisEvent.SetParam[i] = PropertyManager->GetNode(thisEvent.SetParamName[i]);
-            } else {
-              LogException err;
-              err << "No property, \"" << thisEvent.SetParamName[i] << "\" is defined.\n";
-              throw err;
+    // The condition is not evaluated if its inputs have not changed since its
+    // previous evaluation: the outcome would be the same.
+    if (thisEvent.Dynamic || InputsChanged(thisEvent)) {
+      bool pass = thisEvent.Condition->Evaluate();
+      thisEvent.Stamp = InputChanges + 1;
+
+      if (pass) {
+        if (!thisEvent.Triggered) {
+
+          // The conditions are true, do the setting of the desired Event
+          // parameters
+          for (i=0; i<thisEvent.SetValue.size(); i++) {
+            if (thisEvent.SetParam[i] == 0L) { // Late bind property if necessary
+              if (PropertyManager->HasNode(thisEvent.SetParamName[i])) {
+                thisEvent.SetParam[i] = PropertyManager->GetNode(thisEvent.SetParamName[i]);
+              } else {
+                LogException err;
+                err << "No property, \"" << thisEvent.SetParamName[i] << "\" is defined.\n";
+                throw err;
+              }
             }
-          }
-          thisEvent.OriginalValue[i] = thisEvent.SetParam[i]->getDoubleValue();
-          if (thisEvent.Functions[i] != 0) { // Parameter should be set to a function value
-            try {
-              thisEvent.SetValue[i] = thisEvent.Functions[i]->GetValue();
-            } catch (BaseException& e) {
-              LogException err;
-              err << "\nA problem occurred in the execution of the script. "
-                  << e.what() << "\n";
-              throw err;
+            thisEvent.OriginalValue[i] = thisEvent.SetParam[i]->getDoubleValue();
+            if (thisEvent.Functions[i] != 0) { // Parameter should be set to a function value
+              try {
+                thisEvent.SetValue[i] = thisEvent.Functions[i]->GetValue();
+              } catch (BaseException& e) {
+                LogException err;
+                err << "\nA problem occurred in the execution of the script. "
+                    << e.what() << "\n";
+                throw err;
+              }
             }
+            switch (thisEvent.Type[i]) {
+            case FG_VALUE:
+            case FG_BOOL:
+              thisEvent.newValue[i] = thisEvent.SetValue[i];
+              break;
+            case FG_DELTA:
+              thisEvent.newValue[i] = thisEvent.OriginalValue[i] + thisEvent.SetValue[i];
+              break;
+            default:
+              FGLogging log(LogLevel::WARN);
+              log << "Invalid Type specified\n";
+              break;
+            }
+            thisEvent.StartTime = currentTime + thisEvent.Delay;
+            thisEvent.ValueSpan[i] = thisEvent.newValue[i] - thisEvent.OriginalValue[i];
+            thisEvent.Transiting[i] = true;
           }
-          switch (thisEvent.Type[i]) {
-          case FG_VALUE:
-          case FG_BOOL:
-            thisEvent.newValue[i] = thisEvent.SetValue[i];
-            break;
-          case FG_DELTA:
-            thisEvent.newValue[i] = thisEvent.OriginalValue[i] + thisEvent.SetValue[i];
-            break;
-          default:
-            FGLogging log(LogLevel::WARN);
-            log << "Invalid Type specified\n";
-            break;
-          }
-          thisEvent.StartTime = currentTime + thisEvent.Delay;
-          thisEvent.ValueSpan[i] = thisEvent.newValue[i] - thisEvent.OriginalValue[i];
-          thisEvent.Transiting[i] = true;
         }
+        thisEvent.Triggered = true;
+
+      } else if (thisEvent.Persistent) { // If the event is persistent, reset the trigger.
+        thisEvent.Triggered = false; // Reset the trigger for persistent events
+        thisEvent.Notified = false;  // Also reset the notification flag
+      } else if (thisEvent.Continuous) { // If the event is continuous, reset the trigger.
+        thisEvent.Triggered = false; // Reset the trigger for persistent events
+        thisEvent.Notified = false;  // Also reset the notification flag
+      }
+
+      // The condition will remain false until the time has come: the event
+      // can sleep until then.
+      if (!pass && !thisEvent.Triggered && !thisEvent.IsAwake(currentTime)) {
+        thisEvent.Stamp = 0;
+        Timers.emplace(thisEvent.WakeUpTime, thisEvent.StrictWakeUp, ev_ctr);
+        continue;
       }
-      thisEvent.Triggered = true;
-
-    } else if (thisEvent.Persistent) { // If the event is persistent, reset the trigger.
-      thisEvent.Triggered = false; // Reset the trigger for persistent events
-      thisEvent.Notified = false;  // Also reset the notification flag
-    } else if (thisEvent.Continuous) { // If the event is continuous, reset the trigger.
-      thisEvent.Triggered = false; // Reset the trigger for persistent events
-      thisEvent.Notified = false;  // Also reset the notification flag
     }
 
     if ((currentTime >= thisEvent.StartTime) && thisEvent.Triggered) {
@@ -500,6 +626,7 @@ bool FGScript::RunScript(void)
             break;
           }
           thisEvent.SetParam[i]->setDoubleValue(newSetValue);
+          ++InputEpoch; // The inputs must be read again.
         }
       }
 
@@ -512,12 +639,12 @@ bool FGScript::RunScript(void)
           out << "  <name> " << currentTime << " seconds" << " </name>\n";
           out << "  <description>\n";
           out << "  <![CDATA[\n";
-          out << "  <b>" << thisEvent.Name << " (Event " << event_ctr << ")"
+          out << "  <b>" << thisEvent.Name << " (Event " << ev_ctr << ")"
                << " executed at time: " << currentTime << "</b><br/>\n";
         } else  {
           out << "\n" << LogFormat::UNDERLINE_ON << LogFormat::BOLD
               << thisEvent.Name << LogFormat::NORMAL << LogFormat::UNDERLINE_OFF
-              << " (Event " << event_ctr << ")"
+              << " (Event " << ev_ctr << ")"
               << " executed at time: " << LogFormat::BOLD << currentTime << LogFormat::NORMAL
               << "\n";
         }
@@ -550,11 +677,51 @@ bool FGScript::RunScript(void)
 
     }
 
-    event_ctr++;
+    // The events have been rescheduled by the actions of this event (the
+    // simulation has been reset, for instance): all the events are now active
+    // and those that follow are processed in the order of the script.
+    if (ScheduleCount != scheduleCount) {
+      scheduleCount = ScheduleCount;
+      k = ev_ctr;
+      nactive = ev_ctr + 1;
+      continue;
+    }
+
+    // A triggered event that is neither persistent nor continuous has no more
+    // work to do once its actions are complete and it has been notified.
+    if (thisEvent.Triggered && !thisEvent.Persistent && !thisEvent.Continuous
+        && !(thisEvent.Notify && !thisEvent.Notified)
+        && find(thisEvent.Transiting.begin(), thisEvent.Transiting.end(), true)
+           == thisEvent.Transiting.end())
+      continue;
+
+    ActiveEvents[nactive++] = ev_ctr;
   }
+
+  ActiveEvents.resize(nactive);
+
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGScript::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(StartTime, EndTime);
+
+  snapshot.Check(Events.size(), "the number of script events");
+  for (auto& event: Events) {
+    snapshot.Check(event.SetValue.size(), "the number of set actions in "
+                                          + event.Name);
+    snapshot(event.Triggered, event.Notified, event.StartTime, event.TimeSpan,
+             event.SetValue, event.newValue, event.OriginalValue,
+             event.ValueSpan, event.Transiting);
+  }
+
+  // The restored events must be evaluated again to be rescheduled.
+  if (snapshot.IsRestoring()) ScheduleEvents();
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -40,6 +40,8 @@ INCLUDES
 #include <vector>
 #include <map>
 #include <memory>
+#include <queue>
+#include <tuple>
 
 #include "FGJSBBase.h"
 #include "FGPropertyReader.h"
@@ -56,6 +58,7 @@ class FGFDMExec;
 class FGCondition;
 class FGFunction;
 class FGPropertyValue;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -157,6 +160,15 @@ CLASS DOCUMENTATION
     to be used are specified in the &quot;use&quot; lines. Next,
     comes the &quot;run&quot; section, where the conditions are
     described in &quot;event&quot; clauses.</p>
+
+    <p>The events are not all evaluated at each time step. The time tests
+    &quot;simulation/sim-time-sec ge|gt value&quot; of a condition are
+    extracted when the condition is loaded, so that an event which condition
+    is false waits in a time ordered queue until its time has come. The other
+    conditions are only evaluated when the value of one of the properties that
+    they compare has changed. Finally, an event which is not persistent nor
+    continuous is no longer processed once it has been triggered and its
+    actions are complete.</p>
     @author Jon S. Berndt
 */
 
@@ -194,6 +206,11 @@ public:
 
   void ResetEvents(void);
 
+  /** Saves or restores the state of the events (triggered, notified, values
+      being transitioned, etc.)
+      @see FGSnapshot */
+  void SerializeState(FGSnapshot& snapshot);
+
 private:
   enum eAction {
     FG_RAMP  = 1,
@@ -233,6 +250,12 @@ private:
     std::vector <double>  ValueSpan;
     std::vector <bool>    Transiting;
     std::vector <FGFunction*> Functions;
+    // Scheduling of the condition evaluation (see FGCondition::GetDependencies)
+    bool             Dynamic;
+    bool             StrictWakeUp;
+    double           WakeUpTime;
+    std::vector <unsigned int> Inputs;
+    unsigned long    Stamp;
 
     event() {
       Triggered = false;
@@ -243,6 +266,10 @@ private:
       Name = "";
       StartTime = 0.0;
       TimeSpan = 0.0;
+      Dynamic = true;
+      StrictWakeUp = false;
+      WakeUpTime = -HUGE_VAL;
+      Stamp = 0;
     }
 
     void reset(void) {
@@ -250,13 +277,39 @@ private:
       Notified = false;
       StartTime = 0.0;
     }
+
+    bool IsAwake(double time) const {
+      return StrictWakeUp ? time > WakeUpTime : time >= WakeUpTime;
+    }
   };
 
+  // A property compared by the conditions of the events.
+  struct input {
+    FGPropertyValue* Property;
+    double           Value;
+    unsigned long    Epoch;   // Epoch at which Value has been read
+    unsigned long    Changed; // Count of changes when Value has changed
+  };
+
+  // Wake up time, strict comparison and index of a sleeping event.
+  typedef std::tuple<double, bool, unsigned int> timer;
+
   std::string  ScriptName;
   double  StartTime;
   double  EndTime;
   std::vector <struct event> Events;
 
+  std::vector <input> Inputs;
+  unsigned long InputEpoch;
+  unsigned long InputChanges;
+  unsigned long ScheduleCount;
+  double LastTime;
+  std::vector <unsigned int> ActiveEvents;
+  std::priority_queue<timer, std::vector<timer>, std::greater<timer>> Timers;
+
+  void ScheduleEvents(void);
+  bool InputsChanged(const struct event& thisEvent);
+
   FGPropertyReader LocalProperties;
 
   FGFDMExec* FDMExec;
@@ -0,0 +1,135 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGSnapshot.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Binary image of the state of a simulation.
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cstring>
+
+#include "FGSnapshot.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+void FGSnapshot::Raw(void* value, size_t size)
+{
+  if (Restoring) {
+    if (Position + size > Data.size())
+      throw BaseException("The snapshot is truncated.");
+
+    memcpy(value, Data.data() + Position, size);
+    Position += size;
+  }
+  else
+    Data.append(static_cast<const char*>(value), size);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(FGColumnVector3& v)
+{
+  for (unsigned int i=1; i<=3; ++i)
+    Process(v.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(FGMatrix33& m)
+{
+  for (unsigned int r=1; r<=3; ++r)
+    for (unsigned int c=1; c<=3; ++c)
+      Process(m.Entry(r, c));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(FGQuaternion& q)
+{
+  // The non-const accessor invalidates the cached Euler angles and matrices.
+  for (unsigned int i=1; i<=4; ++i)
+    Process(q.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(FGLocation& l)
+{
+  // Only the cartesian coordinates are stored: the ellipse parameters belong
+  // to the planet and are not modified by the simulation.
+  for (unsigned int i=1; i<=3; ++i)
+    Process(l.Entry(i));
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(string& s)
+{
+  size_t size = s.size();
+  Process(size);
+  if (Restoring) {
+    if (Position + size > Data.size())
+      throw BaseException("The snapshot is truncated.");
+
+    s.assign(Data, Position, size);
+    Position += size;
+  }
+  else
+    Data.append(s);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Process(RandomNumberGeneratorBase& generator)
+{
+  string state;
+  if (!Restoring) state = generator.GetState();
+  Process(state);
+  if (Restoring) generator.SetState(state);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSnapshot::Check(size_t value, const string& what)
+{
+  size_t saved = value;
+  Process(saved);
+  if (saved != value)
+    throw BaseException("The snapshot does not match the model: " + what
+                        + " is " + to_string(value) + " instead of "
+                        + to_string(saved) + ".");
+}
+
+} // namespace JSBSim
@@ -0,0 +1,163 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGSnapshot.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGSNAPSHOT_H
+#define FGSNAPSHOT_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "FGJSBBase.h"
+#include "math/FGLocation.h"
+#include "math/FGQuaternion.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Binary image of the state of a simulation.
+
+    A snapshot is used in two directions: when it is built with the default
+    constructor, the values that are passed to it are appended to its data
+    (saving); when it is built from the data of a previous snapshot, the values
+    that are passed to it are overwritten with the data (restoring). This
+    allows each class to save and restore its state with a single method
+    listing its state variables, for instance:
+
+    @code
+    void FGFoo::SerializeState(FGSnapshot& snapshot)
+    {
+      snapshot(Output, PreviousInput, vForces);
+    }
+    @endcode
+
+    The data is a raw binary image in the native representation of the host
+    and is not meant to be exchanged between different builds or machines.
+    The structure of the model (number of engines, components, etc.) is
+    recorded with Check() so that restoring a snapshot in an instance of a
+    different model throws a BaseException instead of silently corrupting the
+    state.
+    @author The JSBSim team
+  */
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGSnapshot
+{
+public:
+  /// Constructor of a snapshot in which a state is saved.
+  FGSnapshot(void) : Restoring(false), Position(0) {}
+  /// Constructor of a snapshot from which a state is restored.
+  explicit FGSnapshot(std::string data)
+    : Data(std::move(data)), Restoring(true), Position(0) {}
+
+  /// Returns true if the state is restored from the snapshot.
+  bool IsRestoring(void) const { return Restoring; }
+  /// Returns the binary data of the snapshot.
+  const std::string& GetData(void) const { return Data; }
+  /// Returns true if all the data has been restored.
+  bool AtEnd(void) const { return Position == Data.size(); }
+
+  /// Saves or restores a list of values.
+  template <typename... Args>
+  void operator()(Args&... args) { (Process(args), ...); }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>
+  Process(T& value) { Raw(&value, sizeof(T)); }
+
+  template <typename T, size_t N>
+  void Process(T (&values)[N]) { for (auto& v: values) Process(v); }
+
+  void Process(FGColumnVector3& v);
+  void Process(FGMatrix33& m);
+  void Process(FGQuaternion& q);
+  void Process(FGLocation& l);
+  void Process(std::string& s);
+  void Process(RandomNumberGeneratorBase& generator);
+  void Process(FGJSBBase::Filter& filter) { Raw(&filter, sizeof(filter)); }
+
+  template <typename T>
+  void Process(std::vector<T>& v) {
+    size_t size = v.size();
+    Process(size);
+    if (Restoring) v.resize(size);
+    for (size_t i=0; i < size; ++i) {
+      if constexpr (std::is_same_v<T, bool>) {
+        bool b = v[i];
+        Process(b);
+        v[i] = b;
+      } else
+        Process(v[i]);
+    }
+  }
+
+  template <typename T>
+  void Process(std::deque<T>& d) {
+    size_t size = d.size();
+    Process(size);
+    if (Restoring) d.resize(size);
+    for (auto& v: d) Process(v);
+  }
+
+  /** Records a value describing the structure of the model.
+      When restoring, the value read from the snapshot is compared to the value
+      supplied and an exception is thrown if they differ.
+      @param value the value to check (number of components, engines, ...)
+      @param what a description of the value used in the exception message. */
+  void Check(size_t value, const std::string& what);
+
+private:
+  std::string Data;
+  bool Restoring;
+  size_t Position;
+
+  void Raw(void* value, size_t size);
+};
+} // namespace JSBSim
+
+#endif
@@ -92,44 +92,58 @@ void FGUDPInputSocket::Read(bool Holding)
 {
   if (!socket) return;
 
-  data = socket->Receive();
+  vector<string> datagrams;
+  {
+    unique_lock<mutex> lock;
+    if (Endpoint) lock = Endpoint->Lock();
+    Receive(datagrams);
+  }
 
-  if (!data.empty()) {
+  // The datagrams received since the last frame are processed in the order of
+  // their arrival so that the most recent values prevail.
+  for (string& datagram : datagrams) {
+    data.swap(datagram);
+    ProcessData();
+  }
+}
 
-    vector<string> tokens;
-    stringstream ss(data);
-    string temp;
-    while (getline(ss, temp, ',')) {
-       tokens.push_back(temp);
-    }
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-    vector<double> values;
+void FGUDPInputSocket::ProcessData(void)
+{
+  vector<string> tokens;
+  stringstream ss(data);
+  string temp;
+  while (getline(ss, temp, ',')) {
+     tokens.push_back(temp);
+  }
 
-    try {
-      for (string& token : tokens)
-        values.push_back(atof_locale_c(token));
-    } catch(InvalidNumber& e) {
-      FGLogging log(LogLevel::ERROR);
-      log << e.what() << "\n";
-      return;
-    }
+  vector<double> values;
 
-    if (values[0] < oldTimeStamp) {
-      return;
-    } else {
-      oldTimeStamp = values[0];
-    }
+  try {
+    for (string& token : tokens)
+      values.push_back(atof_locale_c(token));
+  } catch(InvalidNumber& e) {
+    FGLogging log(LogLevel::ERROR);
+    log << e.what() << "\n";
+    return;
+  }
 
-    // the zeroeth value is the time stamp
-    if ((values.size() - 1) != InputProperties.size()) {
-      FGLogging log(LogLevel::ERROR);
-      log << "\nMismatch between UDP input property and value counts.\n";
-      return;
-    }
+  if (values[0] < oldTimeStamp) {
+    return;
+  } else {
+    oldTimeStamp = values[0];
+  }
 
-    for (unsigned int i=1; i<values.size(); i++) {
-      InputProperties[i-1]->setDoubleValue(values[i]);
-    }
+  // the zeroeth value is the time stamp
+  if ((values.size() - 1) != InputProperties.size()) {
+    FGLogging log(LogLevel::ERROR);
+    log << "\nMismatch between UDP input property and value counts.\n";
+    return;
+  }
+
+  for (unsigned int i=1; i<values.size(); i++) {
+    InputProperties[i-1]->setDoubleValue(values[i]);
   }
 }
 
@@ -72,6 +72,8 @@ public:
   void Read(bool Holding) override;
 
 protected:
+  /// Updates the properties with the values of the datagram stored in data.
+  void ProcessData(void);
 
   int rate;
   double oldTimeStamp;
@@ -29,6 +29,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include <iostream>
+#include <mutex>
 #include <sstream>  // for assembling the error messages / what of exceptions.
 #include <stdexcept>  // using domain_error, invalid_argument, and length_error.
 
@@ -45,7 +46,7 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
-bool Element::converterIsInitialized = false;
+std::once_flag Element::converterIsInitialized;
 map <string, map <string, double> > Element::convert;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -59,8 +60,9 @@ Element::Element(const string& nm)
   element_index = 0;
   line_number = -1;
 
-  if (!converterIsInitialized) {
-    converterIsInitialized = true;
+  // Several FGFDMExec instances may be built concurrently in different threads
+  // so the initialization of the shared conversion table must be synchronized.
+  call_once(converterIsInitialized, []() {
     // convert ["from"]["to"] = factor, so: from * factor = to
     // Length
     convert["M"]["FT"] = 3.2808399;
@@ -252,7 +254,7 @@ Element::Element(const string& nm)
     convert["VOLTS"]["VOLTS"] = 1.0;
     convert["OHMS"]["OHMS"] = 1.0;
     convert["AMPERES"]["AMPERES"] = 1.0;
-  }
+  });
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -717,6 +719,8 @@ void Element::AddData(string d)
     d.erase(0,string_start);
   }
   data_lines.push_back(d);
+  numeric_data.reset();
+  numeric_data_checked = false;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -753,4 +757,54 @@ void Element::MergeAttributes(Element* el)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+Element_ptr Element::Clone(void) const
+{
+  Element_ptr copy = new Element(name);
+
+  copy->attributes = attributes;
+  copy->data_lines = data_lines;
+  copy->numeric_data = numeric_data;
+  copy->numeric_data_checked = numeric_data_checked;
+  copy->file_name = file_name;
+  copy->line_number = line_number;
+
+  copy->children.reserve(children.size());
+  for (const auto& child: children) {
+    Element_ptr child_copy = child->Clone();
+    child_copy->SetParent(copy);
+    copy->children.push_back(child_copy);
+  }
+
+  return copy;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+shared_ptr<const vector<double>> Element::GetDataAsNumbers(void)
+{
+  if (!numeric_data_checked) {
+    numeric_data_checked = true;
+
+    stringstream buf;
+    for (const auto& line: data_lines) {
+      if (line.find_first_not_of("0123456789.-+eE \t\n") != string::npos)
+        return numeric_data;
+      buf << line << " ";
+    }
+
+    auto numbers = make_shared<vector<double>>();
+    double x;
+    buf >> x;
+    while (buf) {
+      numbers->push_back(x);
+      buf >> x;
+    }
+    numeric_data = numbers;
+  }
+
+  return numeric_data;
+}
+
 } // end namespace JSBSim
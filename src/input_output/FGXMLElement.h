@@ -36,6 +36,8 @@ INCLUDES
 
 #include <string>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "simgear/structure/SGSharedPtr.hxx"
@@ -384,18 +386,35 @@ public:
    */
   void MergeAttributes(Element* el);
 
+  /** Returns a deep copy of the element and of its children.
+   *  The copy has no parent and its element indices are reset.
+   *  @return a pointer to the root of the copied tree.
+   */
+  Element_ptr Clone(void) const;
+
+  /** Returns the numbers contained in the data lines of the element.
+   *  The data lines are converted once, the result is stored and shared with
+   *  the copies made by Clone() afterwards.
+   *  @return a pointer to the numbers in the order in which they have been
+   *          read, or a null pointer if the data lines contain characters that
+   *          can not be part of a number.
+   */
+  std::shared_ptr<const std::vector<double>> GetDataAsNumbers(void);
+
 private:
   std::string name;
   std::map <std::string, std::string> attributes;
   std::vector <std::string> data_lines;
   std::vector <Element_ptr> children;
+  std::shared_ptr<const std::vector<double>> numeric_data;
+  bool numeric_data_checked = false;
   Element *parent;
   unsigned int element_index;
   std::string file_name;
   int line_number;
   typedef std::map <std::string, std::map <std::string, double> > tMapConvert;
   static tMapConvert convert;
-  static bool converterIsInitialized;
+  static std::once_flag converterIsInitialized;
 };
 
 } // namespace JSBSim
@@ -28,16 +28,71 @@
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <atomic>
+#include <filesystem>
+#include <map>
+#include <mutex>
+
 #include "FGXMLFileRead.h"
 #include "input_output/FGLog.h"
 #include "simgear/io/iostreams/sgstream.hxx"
 
+using namespace std;
+
 namespace JSBSim {
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS IMPLEMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+namespace {
+// The documents stored in the cache are never returned to the callers: they
+// get a copy instead since the element trees are modified while a model is
+// loaded (element indices, files included with the "file" attribute, etc.)
+// The cached trees are only accessed while the mutex is locked because the
+// reference counter of Element is not thread safe.
+struct CachedDocument {
+  filesystem::file_time_type mtime;
+  uintmax_t size;
+  Element_ptr document;
+};
+
+mutex cacheMutex;
+map<string, CachedDocument> documentCache;
+atomic<bool> cacheEnabled(true);
+
+// Convert the content of the tables to numbers before the document is cached
+// so that the conversion is shared by all the copies of the document.
+void ConvertTableData(Element* el)
+{
+  const unsigned int nChildren = el->GetNumElements();
+
+  if (el->GetName() == "tableData" && nChildren == 0 && el->GetNumDataLines() > 0)
+    el->GetDataAsNumbers();
+
+  for (unsigned int i=0; i < nChildren; ++i)
+    ConvertTableData(el->GetElement(i));
+}
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::SetCacheEnabled(bool enabled)
+{
+  cacheEnabled = enabled;
+  if (!enabled) ClearCache();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGXMLFileRead::ClearCache(void)
+{
+  lock_guard<mutex> lock(cacheMutex);
+  documentCache.clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
                                         FGXMLParse& fparse, bool verbose)
 {
@@ -46,22 +101,56 @@ Element* FGXMLFileRead::LoadXMLDocument(const SGPath& XML_filename,
   if (!filename.isNull()) {
     if (filename.extension().empty())
       filename.concat(".xml");
-    infile.open(filename);
-    if ( !infile.is_open()) {
-      if (verbose) {
-        FGLogging log(LogLevel::ERROR);
-        log << "Could not open file: " << filename << "\n";
-      }
-      return nullptr;
-    }
   } else {
     FGLogging log(LogLevel::ERROR);
     log << "No filename given.\n";
     return nullptr;
   }
+
+  // Look for the document in the cache. The file is identified by its
+  // absolute path, its modification time and its size.
+  bool cacheable = false;
+  string key;
+  CachedDocument entry;
+
+  if (cacheEnabled) {
+    error_code ec;
+    filesystem::path fspath = filesystem::u8path(filename.utf8Str());
+    key = filesystem::absolute(fspath, ec).u8string();
+    if (!ec) entry.mtime = filesystem::last_write_time(fspath, ec);
+    if (!ec) entry.size = filesystem::file_size(fspath, ec);
+    cacheable = !ec;
+  }
+
+  if (cacheable) {
+    lock_guard<mutex> lock(cacheMutex);
+    auto it = documentCache.find(key);
+    if (it != documentCache.end() && it->second.mtime == entry.mtime
+        && it->second.size == entry.size) {
+      fparse.SetDocument(it->second.document->Clone());
+      return fparse.GetDocument();
+    }
+  }
+
+  infile.open(filename);
+  if ( !infile.is_open()) {
+    if (verbose) {
+      FGLogging log(LogLevel::ERROR);
+      log << "Could not open file: " << filename << "\n";
+    }
+    return nullptr;
+  }
   readXML(infile, fparse, filename.utf8Str());
   Element* document = fparse.GetDocument();
   infile.close();
+
+  if (document && cacheable) {
+    ConvertTableData(document);
+    entry.document = document->Clone();
+    lock_guard<mutex> lock(cacheMutex);
+    documentCache[key] = entry;
+  }
+
   return document;
 }
 
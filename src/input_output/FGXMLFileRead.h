@@ -59,6 +59,18 @@ public:
 
   void ResetParser(void) {file_parser.reset();}
 
+  /** Enables or disables the process-wide cache of the XML documents.
+      When enabled (the default), each file is parsed once and the following
+      loads of the same file return a copy of the cached element tree as long
+      as the modification time and the size of the file are unchanged. The
+      cache is shared by all the FGFDMExec instances of the process and is
+      thread safe. Disabling the cache also empties it.
+      @param enabled true to enable the cache. */
+  static void SetCacheEnabled(bool enabled);
+
+  /// Removes all the documents from the cache.
+  static void ClearCache(void);
+
 private:
   FGXMLParse file_parser;
 };
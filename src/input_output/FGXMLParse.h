@@ -70,6 +70,8 @@ public:
   FGXMLParse(void) : current_element(nullptr) {}
 
   Element* GetDocument(void) {return document;}
+  /// Replaces the document by an element tree that has been built elsewhere.
+  void SetDocument(Element* el) {reset(); document = el;}
 
   void startElement (const char * name, const XMLAttributes &atts) override;
   void endElement (const char * name) override;
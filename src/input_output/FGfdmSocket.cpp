@@ -175,7 +175,7 @@ FGfdmSocket::FGfdmSocket(const string& address, int port, int protocol, int prec
 // assumes TCP or UDP socket on localhost, for inbound datagrams
 FGfdmSocket::FGfdmSocket(int port, int protocol, int precision)
 {
-  sckt = INVALID_SOCKET;
+  sckt = sckt_in = INVALID_SOCKET;
   connected = false;
   Protocol = (ProtocolType)protocol;
   string ProtocolName;
@@ -456,6 +456,16 @@ void FGfdmSocket::WaitUntilReadable(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+FGfdmSocket::Descriptor FGfdmSocket::GetPollDescriptor(void) const
+{
+  if (Protocol == ptTCP && sckt_in != INVALID_SOCKET)
+    return sckt_in;
+
+  return sckt;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGfdmSocket::LogSocketError(const std::string& msg)
 {
   // An error has occurred, display the error message.
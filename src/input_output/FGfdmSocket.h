@@ -176,6 +176,28 @@ public:
 
   enum ProtocolType {ptUDP, ptTCP};
 
+#if defined(_MSC_VER) || defined(__MINGW32__)
+  typedef SOCKET Descriptor;
+  static constexpr Descriptor InvalidDescriptor = INVALID_SOCKET;
+#else
+  typedef int Descriptor;
+  static constexpr Descriptor InvalidDescriptor = -1;
+#endif
+
+  /// Return the descriptor of the listening TCP socket or of the UDP socket.
+  Descriptor GetDescriptor(void) const { return sckt; }
+  /**
+   * @brief Return the descriptor that must be watched for incoming data.
+   *
+   * For a TCP server, this is the connection with the client when a client is
+   * connected, otherwise the listening socket. For UDP, this is the socket.
+   */
+  Descriptor GetPollDescriptor(void) const;
+  /// Return true if the descriptor refers to a socket.
+  static bool IsValid(Descriptor d) { return d != InvalidDescriptor; }
+  /// Return the protocol of the socket.
+  ProtocolType GetProtocol(void) const { return Protocol; }
+
 private:
 #if defined(_MSC_VER) || defined(__MINGW32__)
   SOCKET sckt;
@@ -40,6 +40,7 @@ INCLUDES
 #include <assert.h>
 #include <array>
 #include <utility>
+#include <cmath>
 
 #include "FGCondition.h"
 #include "FGPropertyValue.h"
@@ -213,6 +214,60 @@ bool FGCondition::Evaluate(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGCondition::GetDependencies(const string& time, double& start,
+                                  bool& strict,
+                                  vector<FGPropertyValue*>& properties) const
+{
+  if (!TestParam1) {
+    for (auto& cond: conditions) {
+      if (Logic == eAND) {
+        if (!cond->GetDependencies(time, start, strict, properties))
+          return false;
+      } else {
+        // The time tests of an OR group can not delay the evaluation of the
+        // whole condition.
+        double cond_start = -HUGE_VAL;
+        bool cond_strict = false;
+        if (!cond->GetDependencies(time, cond_start, cond_strict, properties)
+            || cond_start != -HUGE_VAL)
+          return false;
+      }
+    }
+    return true;
+  }
+
+  FGPropertyValue* param2 = TestParam2->GetPropertyValue();
+
+  if (TestParam1->IsLateBound() || (param2 && param2->IsLateBound()))
+    return false;
+
+  if (TestParam1->GetFullyQualifiedName() == time) {
+    if (param2 || TestParam1->GetNameWithSign()[0] == '-'
+        || (Comparison != eGE && Comparison != eGT))
+      return false;
+
+    double value = TestParam2->GetValue();
+    if (value > start) {
+      start = value;
+      strict = Comparison == eGT;
+    }
+    else if (value == start && Comparison == eGT)
+      strict = true;
+
+    return true;
+  }
+
+  if (param2 && param2->GetFullyQualifiedName() == time)
+    return false;
+
+  properties.push_back(TestParam1);
+  if (param2) properties.push_back(param2);
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGCondition::PrintCondition(string indent) const
 {
   FGLogging out(LogLevel::STDOUT);
@@ -38,7 +38,7 @@ INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #include "FGJSBBase.h"
-#include "math/FGPropertyValue.h"
+#include "math/FGParameterValue.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -71,6 +71,25 @@ public:
   bool Evaluate(void) const;
   void PrintCondition(std::string indent="  ") const;
 
+  /** Collects the inputs of the condition so that its evaluation can be
+      skipped while they are unchanged.
+      The tests of the time property against a value with the "ge" or "gt"
+      comparisons are not collected when they are combined with the rest of
+      the condition by AND operators: the condition can only be true after
+      the largest of these values has been reached.
+      @param time the fully qualified name of the time property
+      @param start updated with the time after which the condition can be
+                   true. It must be initialized to -HUGE_VAL by the caller.
+      @param strict updated with true if the condition is false when the time
+                    is equal to start.
+      @param properties appended with the properties compared by the
+                        condition other than the time.
+      @return false if the condition depends on the time in another manner or
+              if some of its properties are not bound yet. In that case the
+              condition must be evaluated at each time step. */
+  bool GetDependencies(const std::string& time, double& start, bool& strict,
+                       std::vector<FGPropertyValue*>& properties) const;
+
 private:
 
   enum eComparison {ecUndef=0, eEQ, eNE, eGT, eGE, eLT, eLE};
@@ -78,7 +97,7 @@ private:
   eLogic Logic;
 
   FGPropertyValue_ptr TestParam1;
-  FGParameter_ptr TestParam2;
+  FGParameterValue_ptr TestParam2;
   eComparison Comparison;
   std::string conditional;
   std::vector<std::shared_ptr<FGCondition>> conditions;
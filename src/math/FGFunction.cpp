@@ -30,6 +30,7 @@ INCLUDES
 
 #include <iomanip>
 #include <memory>
+#include <typeinfo>
 
 #include "simgear/misc/strutils.hxx"
 #include "FGFDMExec.h"
@@ -37,6 +38,7 @@ INCLUDES
 #include "FGTable.h"
 #include "FGRealValue.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 #include "math/FGFunctionValue.h"
 #include "input_output/string_utilities.h"
 
@@ -90,6 +92,11 @@ public:
     return cached ? cachedValue : f(Parameters);
   }
 
+  void SetMathFn(double(*math_fn)(double)) {
+    opcode = Opcode::MathFn;
+    mathFn = math_fn;
+  }
+
 protected:
   void bind(Element* el, const string& Prefix) override {
     string nName = CreateOutputNode(el, Prefix);
@@ -174,7 +181,9 @@ FGFunction* make_MathFn(double(*math_fn)(double), FGFDMExec* fdmex, Element* el,
   auto f = [math_fn](const std::vector<FGParameter_ptr> &p)->double {
              return math_fn(p[0]->GetValue());
            };
-  return new aFunc<decltype(f), 1>(f, fdmex, el, prefix, v);
+  auto func = new aFunc<decltype(f), 1>(f, fdmex, el, prefix, v);
+  func->SetMathFn(math_fn);
+  return func;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -214,6 +223,8 @@ FGFunction::FGFunction(FGFDMExec* fdmex, Element* el, const string& prefix,
   CheckMinArguments(el, 1);
   CheckMaxArguments(el, 1);
 
+  if (fdmex->GetCompileFunctions()) CompileProgram();
+
   string sCopyTo = el->GetAttributeValue("copyto");
 
   if (!sCopyTo.empty()) {
@@ -297,16 +308,23 @@ void FGFunction::CheckOddOrEvenArguments(Element* el, OddEven odd_even)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-shared_ptr<RandomNumberGenerator> makeRandomGenerator(Element *el, FGFDMExec* fdmex)
+// The counter-based streams are named after the location of the element in
+// the model and after the prefix so that each random function gets its own
+// stream.
+
+shared_ptr<RandomNumberGeneratorBase> makeRandomGenerator(Element *el, FGFDMExec* fdmex,
+                                                          const string& Prefix)
 {
   string seed_attr = el->GetAttributeValue("seed");
+  string stream = "function/" + SGPath(el->GetFileName()).file() + ":"
+                + to_string(el->GetLineNumber()) + "/" + Prefix;
   if (seed_attr.empty())
-    return fdmex->GetRandomGenerator();
+    return fdmex->GetRandomGenerator(stream);
   else if (seed_attr == "time_now")
     return make_shared<RandomNumberGenerator>();
   else {
     unsigned int seed = atoi(seed_attr.c_str());
-    return make_shared<RandomNumberGenerator>(seed);
+    return fdmex->GetRandomGenerator(stream, seed);
   }
 }
 
@@ -327,8 +345,25 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
                return temp;
              };
 
+  // Operations that can be executed by the compiled programs. The other
+  // operations are executed by calling the GetValue() method of their node.
+  static const map<string, Opcode> opcodes = {
+    {"sum", Opcode::Sum}, {"product", Opcode::Product}, {"avg", Opcode::Avg},
+    {"difference", Opcode::Difference}, {"min", Opcode::Min},
+    {"max", Opcode::Max}, {"quotient", Opcode::Quotient}, {"pow", Opcode::Pow},
+    {"toradians", Opcode::ToRadians}, {"todegrees", Opcode::ToDegrees},
+    {"sqrt", Opcode::Sqrt}, {"log2", Opcode::Log2}, {"ln", Opcode::Ln},
+    {"log10", Opcode::Log10}, {"sign", Opcode::Sign}, {"fmod", Opcode::Fmod},
+    {"roundmultiple", Opcode::RoundMultiple}, {"atan2", Opcode::Atan2},
+    {"mod", Opcode::Mod}, {"fraction", Opcode::Fraction},
+    {"integer", Opcode::Integer}, {"lt", Opcode::Lt}, {"le", Opcode::Le},
+    {"gt", Opcode::Gt}, {"ge", Opcode::Ge}, {"eq", Opcode::Eq},
+    {"nq", Opcode::Nq}, {"random", Opcode::Random}, {"urandom", Opcode::Random}
+  };
+
   while (element) {
     string operation = element->GetName();
+    size_t nParams = Parameters.size();
 
     // data types
     if (operation == "property" || operation == "p") {
@@ -635,7 +670,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
           throw err;
         }
       }
-      auto generator(makeRandomGenerator(element, fdmex));
+      auto generator(makeRandomGenerator(element, fdmex, Prefix));
       auto f = [generator, mean, stddev]()->double {
                  double value = generator->GetNormalRandomNumber();
                  return value*stddev + mean;
@@ -665,7 +700,7 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
           throw err;
         }
       }
-      auto generator(makeRandomGenerator(element, fdmex));
+      auto generator(makeRandomGenerator(element, fdmex, Prefix));
       double a = 0.5*(upper-lower);
       double b = 0.5*(upper+lower);
       auto f = [generator, a, b]()->double {
@@ -907,6 +942,17 @@ void FGFunction::Load(Element* el, FGPropertyValue* var, FGFDMExec* fdmex,
           << "> detected in configuration file\n" << LogFormat::RESET;
     }
 
+    // Record the operation executed by the new function. The functions that
+    // have already been tagged are arguments returned as is by VarArgsFn.
+    if (Parameters.size() > nParams) {
+      FGFunction* p = dynamic_cast<FGFunction*>(Parameters.back().ptr());
+
+      if (p && p->opcode == Opcode::None) {
+        auto it = opcodes.find(operation);
+        p->opcode = it != opcodes.end() ? it->second : Opcode::Call;
+      }
+    }
+
     // Optimize functions applied on constant parameters by replacing them by
     // their constant result.
     if (!Parameters.empty()){
@@ -983,11 +1029,18 @@ void FGFunction::cacheValue(bool cache)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFunction::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(cached, cachedValue);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGFunction::GetValue(void) const
 {
   if (cached) return cachedValue;
 
-  double val = Parameters[0]->GetValue();
+  double val = Program.empty() ? Parameters[0]->GetValue() : Execute();
 
   if (pCopyTo) pCopyTo->setDoubleValue(val);
 
@@ -996,6 +1049,249 @@ double FGFunction::GetValue(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFunction::CompileProgram(void)
+{
+  size_t depth = 0;
+
+  Program.clear();
+  Stack.clear();
+  Compile(Parameters[0], depth);
+
+  // Nothing is gained by executing a program made of a single instruction.
+  if (Program.size() == 1) {
+    Program.clear();
+    Stack.clear();
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Returns true if the evaluation of the node has no side effects, in which case
+// the order in which its arguments are evaluated does not matter.
+
+bool FGFunction::IsPure(const FGParameter* node)
+{
+  if (dynamic_cast<const FGFunctionValue*>(node)) return false;
+
+  auto f = dynamic_cast<const FGFunction*>(node);
+  if (!f) return true; // Properties, values and tables
+
+  if (f->opcode == Opcode::Random) return false;
+
+  for (const auto& p: f->Parameters) {
+    if (!IsPure(p)) return false;
+  }
+
+  return true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFunction::Compile(const FGParameter* node, size_t& depth)
+{
+  Instruction ins;
+  auto f = dynamic_cast<const FGFunction*>(node);
+
+  if (f && f->opcode > Opcode::Property) {
+    // The variadic and unary functions evaluate their arguments sequentially
+    // so they can be compiled even if the arguments have side effects. The
+    // other functions are compiled only if their arguments are pure since they
+    // may not evaluate them from left to right.
+    bool sequential = f->opcode <= Opcode::Max || f->Parameters.size() == 1;
+
+    if (sequential || IsPure(f)) {
+      for (const auto& p: f->Parameters)
+        Compile(p, depth);
+
+      ins.op = f->opcode;
+      ins.n = static_cast<unsigned int>(f->Parameters.size());
+      ins.fn = f->mathFn;
+      Program.push_back(ins);
+      depth -= ins.n - 1;
+      return;
+    }
+  }
+
+  if (auto v = dynamic_cast<const FGRealValue*>(node)) {
+    ins.op = Opcode::Constant;
+    ins.value = v->GetValue();
+  } else if (typeid(*node) == typeid(FGPropertyValue)) {
+    ins.op = Opcode::Property;
+    ins.property = static_cast<const FGPropertyValue*>(node);
+  } else {
+    ins.op = Opcode::Call;
+    ins.param = node;
+  }
+
+  ins.n = 0;
+  Program.push_back(ins);
+
+  if (++depth > Stack.size()) Stack.resize(depth);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The operations below must give the same results as the lambda functions
+// defined in FGFunction::Load().
+
+double FGFunction::Execute(void) const
+{
+  double* sp = Stack.data(); // Points to the first free slot of the stack.
+
+  for (const auto& ins: Program) {
+    switch (ins.op) {
+    case Opcode::Constant:
+      *sp++ = ins.value;
+      break;
+    case Opcode::Property:
+      *sp++ = ins.property->FGPropertyValue::GetValue();
+      break;
+    case Opcode::Sum:
+    {
+      sp -= ins.n;
+      double temp = 0.0;
+      for (unsigned int i=0; i < ins.n; ++i) temp += sp[i];
+      *sp++ = temp;
+      break;
+    }
+    case Opcode::Product:
+    {
+      sp -= ins.n;
+      double temp = 1.0;
+      for (unsigned int i=0; i < ins.n; ++i) temp *= sp[i];
+      *sp++ = temp;
+      break;
+    }
+    case Opcode::Avg:
+    {
+      sp -= ins.n;
+      double temp = 0.0;
+      for (unsigned int i=0; i < ins.n; ++i) temp += sp[i];
+      *sp++ = temp / ins.n;
+      break;
+    }
+    case Opcode::Difference:
+    {
+      sp -= ins.n;
+      double temp = sp[0];
+      for (unsigned int i=1; i < ins.n; ++i) temp -= sp[i];
+      *sp++ = temp;
+      break;
+    }
+    case Opcode::Min:
+    {
+      sp -= ins.n;
+      double _min = HUGE_VAL;
+      for (unsigned int i=0; i < ins.n; ++i) {
+        if (sp[i] < _min) _min = sp[i];
+      }
+      *sp++ = _min;
+      break;
+    }
+    case Opcode::Max:
+    {
+      sp -= ins.n;
+      double _max = -HUGE_VAL;
+      for (unsigned int i=0; i < ins.n; ++i) {
+        if (sp[i] > _max) _max = sp[i];
+      }
+      *sp++ = _max;
+      break;
+    }
+    case Opcode::Quotient:
+      --sp;
+      sp[-1] = sp[0] != 0.0 ? sp[-1]/sp[0] : HUGE_VAL;
+      break;
+    case Opcode::Pow:
+      --sp;
+      sp[-1] = pow(sp[-1], sp[0]);
+      break;
+    case Opcode::ToRadians:
+      sp[-1] = sp[-1]*M_PI/180.;
+      break;
+    case Opcode::ToDegrees:
+      sp[-1] = sp[-1]*180./M_PI;
+      break;
+    case Opcode::Sqrt:
+      sp[-1] = sp[-1] >= 0.0 ? sqrt(sp[-1]) : -HUGE_VAL;
+      break;
+    case Opcode::Log2:
+      sp[-1] = sp[-1] > 0.0 ? log10(sp[-1])*invlog2val : -HUGE_VAL;
+      break;
+    case Opcode::Ln:
+      sp[-1] = sp[-1] > 0.0 ? log(sp[-1]) : -HUGE_VAL;
+      break;
+    case Opcode::Log10:
+      sp[-1] = sp[-1] > 0.0 ? log10(sp[-1]) : -HUGE_VAL;
+      break;
+    case Opcode::Sign:
+      sp[-1] = sp[-1] < 0.0 ? -1 : 1;
+      break;
+    case Opcode::MathFn:
+      sp[-1] = ins.fn(sp[-1]);
+      break;
+    case Opcode::Fmod:
+      --sp;
+      sp[-1] = sp[0] != 0.0 ? fmod(sp[-1], sp[0]) : HUGE_VAL;
+      break;
+    case Opcode::RoundMultiple:
+      --sp;
+      sp[-1] = round(sp[-1] / sp[0]) * sp[0];
+      break;
+    case Opcode::Atan2:
+      --sp;
+      sp[-1] = atan2(sp[-1], sp[0]);
+      break;
+    case Opcode::Mod:
+      --sp;
+      sp[-1] = static_cast<int>(sp[-1]) % static_cast<int>(sp[0]);
+      break;
+    case Opcode::Fraction:
+    {
+      double scratch;
+      sp[-1] = modf(sp[-1], &scratch);
+      break;
+    }
+    case Opcode::Integer:
+    {
+      double result;
+      modf(sp[-1], &result);
+      sp[-1] = result;
+      break;
+    }
+    case Opcode::Lt:
+      --sp;
+      sp[-1] = sp[-1] < sp[0] ? 1.0 : 0.0;
+      break;
+    case Opcode::Le:
+      --sp;
+      sp[-1] = sp[-1] <= sp[0] ? 1.0 : 0.0;
+      break;
+    case Opcode::Gt:
+      --sp;
+      sp[-1] = sp[-1] > sp[0] ? 1.0 : 0.0;
+      break;
+    case Opcode::Ge:
+      --sp;
+      sp[-1] = sp[-1] >= sp[0] ? 1.0 : 0.0;
+      break;
+    case Opcode::Eq:
+      --sp;
+      sp[-1] = sp[-1] == sp[0] ? 1.0 : 0.0;
+      break;
+    case Opcode::Nq:
+      --sp;
+      sp[-1] = sp[-1] != sp[0] ? 1.0 : 0.0;
+      break;
+    default:
+      *sp++ = ins.param->GetValue();
+      break;
+    }
+  }
+
+  return Stack[0];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 string FGFunction::GetValueAsString(void) const
 {
   ostringstream buffer;
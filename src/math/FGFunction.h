@@ -48,6 +48,7 @@ namespace JSBSim {
 class Element;
 class FGPropertyValue;
 class FGFDMExec;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -752,6 +753,16 @@ refers to one or more instances of a property, value, or table.
        <v> 0.90 </v>  <v> 0.60 </v>
      </interpolate1d>
      @endcode
+
+When a function is built, its tree of operations is compiled into a flat
+stack based program which is executed without going through the virtual
+GetValue() method of each node. Properties and constant values are pushed
+directly on the stack. Tables, operations with side effects (such as random)
+and operations which evaluate their arguments conditionally (such as ifthen)
+are evaluated by calling their GetValue() method. The results are identical
+to the evaluation of the tree. The compilation can be disabled with
+FGFDMExec::SetCompileFunctions().
+
 @author Jon Berndt
 */
 
@@ -822,14 +833,41 @@ public:
     value. */
   void cacheValue(bool shouldCache);
 
+  /** Saves or restores the value cached by the function.
+      @see FGSnapshot */
+  void SerializeState(FGSnapshot& snapshot);
+
   enum class OddEven {Either, Odd, Even};
 
 protected:
+  /** Operations of the compiled programs. The operations from Sum onwards are
+      executed by the program evaluator, the other operations are evaluated by
+      calling the GetValue() method of the node. */
+  enum class Opcode : unsigned char {
+    None, Call, Random, Constant, Property, Sum, Product, Avg, Difference,
+    Min, Max, Quotient, Pow, ToRadians, ToDegrees, Sqrt, Log2, Ln, Log10,
+    Sign, MathFn, Fmod, RoundMultiple, Atan2, Mod, Fraction, Integer, Lt, Le,
+    Gt, Ge, Eq, Nq
+  };
+
+  struct Instruction {
+    Opcode op;
+    unsigned int n; // Number of operands popped from the stack
+    union {
+      double value;
+      const FGPropertyValue* property;
+      const FGParameter* param;
+      double (*fn)(double);
+    };
+  };
+
   bool cached;
   double cachedValue;
   std::vector <FGParameter_ptr> Parameters;
   std::shared_ptr<FGPropertyManager> PropertyManager;
   SGPropertyNode_ptr pNode;
+  Opcode opcode = Opcode::None;
+  double (*mathFn)(double) = nullptr;
 
   void Load(Element* element, FGPropertyValue* var, FGFDMExec* fdmex,
             const std::string& prefix="");
@@ -842,7 +880,13 @@ protected:
 private:
   std::string Name;
   SGPropertyNode_ptr pCopyTo; // Property node for CopyTo property string
+  std::vector<Instruction> Program;
+  mutable std::vector<double> Stack;
 
+  void CompileProgram(void);
+  void Compile(const FGParameter* node, size_t& depth);
+  static bool IsPure(const FGParameter* node);
+  double Execute(void) const;
   void Debug(int from);
 };
 
@@ -320,6 +320,20 @@ public:
     return *this;
   }
 
+  /** Comparison operator.
+      @param B other matrix.
+      Returns true if both matrices are exactly the same.   */
+  bool operator==(const FGMatrix33& B) const {
+    for (unsigned int i=0; i < eRows*eColumns; i++)
+      if (data[i] != B.data[i]) return false;
+    return true;
+  }
+
+  /** Comparison operator.
+      @param B other matrix.
+      Returns false if both matrices are exactly the same.   */
+  bool operator!=(const FGMatrix33& B) const { return ! operator==(B); }
+
   /** Matrix vector multiplication.
 
       @param v vector to multiply with.
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGModelFunctions.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -128,6 +129,19 @@ void FGModelFunctions::RunPostFunctions(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModelFunctions::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot.Check(PreFunctions.size(), "the number of pre functions");
+  for (auto& prefunc: PreFunctions)
+    prefunc->SerializeState(snapshot);
+
+  snapshot.Check(PostFunctions.size(), "the number of post functions");
+  for (auto& postfunc: PostFunctions)
+    postfunc->SerializeState(snapshot);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 std::shared_ptr<FGFunction> FGModelFunctions::GetPreFunction(const std::string& name)
 {
   for (auto& prefunc: PreFunctions) {
@@ -49,6 +49,7 @@ class FGFunction;
 class Element;
 class FGPropertyManager;
 class FGFDMExec;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -97,6 +98,13 @@ public:
    */
   std::shared_ptr<FGFunction> GetPreFunction(const std::string& name);
 
+  /** Saves or restores the state of the model.
+      The same method is used in both directions: the state variables are
+      saved in the snapshot or overwritten with its content depending on
+      FGSnapshot::IsRestoring().
+      @param snapshot the snapshot of the simulation state */
+  virtual void SerializeState(FGSnapshot& snapshot);
+
 protected:
   std::vector <std::shared_ptr<FGFunction>> PreFunctions;
   std::vector <std::shared_ptr<FGFunction>> PostFunctions;
@@ -89,7 +89,7 @@ public:
   bool IsConstant(void) const override { return param->IsConstant(); }
 
   std::string GetName(void) const override {
-    FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
+    FGPropertyValue* v = GetPropertyValue();
     if (v)
       return v->GetNameWithSign();
     else
@@ -97,9 +97,14 @@ public:
   }
 
   bool IsLateBound(void) const {
-    FGPropertyValue* v = dynamic_cast<FGPropertyValue*>(param.ptr());
+    FGPropertyValue* v = GetPropertyValue();
     return v != nullptr && v->IsLateBound();
   }
+
+  /// Returns the property of the parameter or nullptr if it is a real value.
+  FGPropertyValue* GetPropertyValue(void) const {
+    return dynamic_cast<FGPropertyValue*>(param.ptr());
+  }
 private:
   FGParameter_ptr param;
 };
@@ -86,9 +86,28 @@ SGPropertyNode* FGPropertyValue::GetNode(void) const
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-double FGPropertyValue::GetValue(void) const
+double FGPropertyValue::GetBoundValue(void) const
 {
-  return GetNode()->getDoubleValue()*Sign;
+  SGPropertyNode* node = GetNode();
+  const SGRaw* raw = node->getRawValue();
+
+  Binding = nullptr;
+
+  // Only resolve the binding of readable properties of type double which
+  // reads are not traced. The other properties must go through
+  // SGPropertyNode::getDoubleValue() for the conversion, the attributes and
+  // the tracing to be managed.
+  if (raw && node->getType() == simgear::props::DOUBLE
+      && node->getAttribute(SGPropertyNode::READ)
+      && !node->getAttribute(SGPropertyNode::TRACE_READ)) {
+    auto ptr = dynamic_cast<const SGRawValuePointer<double>*>(raw);
+    Pointer = ptr ? ptr->getPointer() : nullptr;
+    Getter = static_cast<const SGRawValue<double>*>(raw);
+    Binding = raw;
+    BindingVersion = node->getBindingVersion();
+  }
+
+  return node->getDoubleValue()*Sign;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -52,6 +52,14 @@ CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
   /** Represents a property value which can use late binding.
+
+      When the property is tied to a variable of type double or to a getter
+      returning a double, the binding is resolved at the first read: the
+      pointer to the variable (or the raw value holding the getter) is cached
+      and subsequent reads bypass the SGPropertyNode type dispatch. The cache
+      is checked against the binding version of the node at each read so that
+      it is discarded when the property is untied, tied to another source or
+      when its attributes are modified.
       @author Jon Berndt, Anders Gidenstam
   */
 
@@ -68,12 +76,16 @@ public:
   FGPropertyValue(const std::string& propName,
                   std::shared_ptr<FGPropertyManager> propertyManager, Element* el);
 
-  double GetValue(void) const override;
+  double GetValue(void) const override {
+    if (Binding && PropertyNode->getBindingVersion() == BindingVersion)
+      return (Pointer ? *Pointer : Getter->getValue())*Sign;
+    return GetBoundValue();
+  }
   bool IsConstant(void) const override {
     return PropertyNode && (!PropertyNode->isTied()
                          && !PropertyNode->getAttribute(SGPropertyNode::WRITE));
   }
-  void SetNode(SGPropertyNode* node) {PropertyNode = node;}
+  void SetNode(SGPropertyNode* node) {PropertyNode = node; Binding = nullptr;}
   void SetValue(double value);
   bool IsLateBound(void) const { return PropertyNode == nullptr; }
 
@@ -91,6 +103,13 @@ private:
   mutable Element_ptr XML_def;
   std::string PropertyName;
   double Sign;
+  // Cache of the binding of a tied property.
+  mutable const SGRaw* Binding = nullptr;
+  mutable unsigned int BindingVersion = 0;
+  mutable const double* Pointer = nullptr;
+  mutable const SGRawValue<double>* Getter = nullptr;
+
+  double GetBoundValue(void) const;
 };
 
 typedef SGSharedPtr<FGPropertyValue> FGPropertyValue_ptr;
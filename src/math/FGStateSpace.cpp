@@ -18,13 +18,40 @@
 
 #include "initialization/FGInitialCondition.h"
 #include "FGStateSpace.h"
+#include <atomic>
 #include <limits>
 #include <iomanip>
 #include <string>
+#include <thread>
 
 namespace JSBSim
 {
 
+namespace
+{
+
+// copy of a state space bound to a clone of the flight dynamics model
+struct Worker
+{
+    std::unique_ptr<FGFDMExec> fdm;
+    std::unique_ptr<FGStateSpace> ss;
+    std::vector< std::unique_ptr<FGStateSpace::Component> > components;
+
+    bool copy(const FGStateSpace::ComponentVector & from, FGStateSpace::ComponentVector & to)
+    {
+        for (unsigned int i=0;i<from.getSize();i++)
+        {
+            FGStateSpace::Component * comp = from.getComp(i)->clone();
+            if (!comp) return false;
+            components.emplace_back(comp);
+            to.add(comp);
+        }
+        return true;
+    }
+};
+
+}
+
 void FGStateSpace::linearize(
     std::vector<double> x0,
     std::vector<double> u0,
@@ -32,86 +59,141 @@ void FGStateSpace::linearize(
     std::vector< std::vector<double> > & A,
     std::vector< std::vector<double> > & B,
     std::vector< std::vector<double> > & C,
-    std::vector< std::vector<double> > & D)
+    std::vector< std::vector<double> > & D,
+    unsigned int nthreads)
 {
     double h = 1e-4;
+    size_t nX = x.getSize();
+    size_t nU = u.getSize();
+    size_t nY = y.getSize();
+
+    A.assign(nX, std::vector<double>(nX)); // A, d(x)/dx
+    B.assign(nX, std::vector<double>(nU)); // B, d(x)/du
+    C.assign(nY, std::vector<double>(nX)); // C, d(y)/dx
+    D.assign(nY, std::vector<double>(nU)); // D, d(y)/du
+
+    // Each perturbation of x gives a column of A and C, each perturbation of u
+    // a column of B and D. The columns are numbered x first, then u.
+    size_t nColumns = nX + nU;
+    auto column = [&](FGStateSpace & ss, size_t i)
+    {
+        if (i < nX) ss.numericalJacobian(A, C, ss.x, x0, i, h);
+        else ss.numericalJacobian(B, D, ss.u, u0, i-nX, h);
+    };
 
-    // A, d(x)/dx
-    numericalJacobian(A,x,x,x0,x0,h,true);
-    // B, d(x)/du
-    numericalJacobian(B,x,u,x0,u0,h,true);
-    // C, d(y)/dx
-    numericalJacobian(C,y,x,y0,x0,h);
-    // D, d(y)/du
-    numericalJacobian(D,y,u,y0,u0,h);
+    // start from the operating point so that all the columns are computed
+    // from the same state, whichever thread computes them
+    x.set(x0);
 
+    // The other threads work on clones of the FDM with copies of the
+    // components. This thread works on the FDM itself.
+    std::vector<Worker> workers(std::min<size_t>(nthreads, nColumns) > 1 ?
+                                std::min<size_t>(nthreads, nColumns)-1 : 0);
+    for (auto & w : workers)
+    {
+        w.fdm = m_fdm->Clone();
+        w.ss = std::make_unique<FGStateSpace>(w.fdm.get());
+        if (!w.copy(x, w.ss->x) || !w.copy(u, w.ss->u) || !w.copy(y, w.ss->y))
+        {
+            workers.clear();
+            break;
+        }
+    }
+
+    std::atomic<size_t> next(0);
+    std::vector<std::exception_ptr> errors(workers.size());
+    std::vector<std::thread> threads;
+    threads.reserve(workers.size());
+    for (size_t iW=0;iW<workers.size();iW++)
+    {
+        threads.emplace_back([&, iW]()
+        {
+            try
+            {
+                for (size_t i=next++;i<nColumns;i=next++) column(*workers[iW].ss, i);
+            }
+            catch (...)
+            {
+                errors[iW] = std::current_exception();
+                next = nColumns;
+            }
+        });
+    }
+
+    try
+    {
+        for (size_t i=next++;i<nColumns;i=next++) column(*this, i);
+    }
+    catch (...)
+    {
+        next = nColumns;
+        for (auto & t : threads) t.join();
+        throw;
+    }
+
+    for (auto & t : threads) t.join();
+    for (auto & e : errors)
+        if (e) std::rethrow_exception(e);
 }
 
-void FGStateSpace::numericalJacobian(std::vector< std::vector<double> >  & J, ComponentVector & y,
-                                     ComponentVector & x, const std::vector<double> & y0, const std::vector<double> & x0, double h, bool computeYDerivative)
+void FGStateSpace::numericalJacobian(std::vector< std::vector<double> > & Jx,
+                                     std::vector< std::vector<double> > & Jy,
+                                     ComponentVector & v, const std::vector<double> & v0,
+                                     unsigned int iV, double h)
 {
     size_t nX = x.getSize();
     size_t nY = y.getSize();
-    double f1 = 0, f2 = 0, fn1 = 0, fn2 = 0;
-    J.resize(nY);
-    for (unsigned int iY=0;iY<nY;iY++)
+    const double dv[4] = {h, 2*h, -h, -2*h};
+    std::vector<double> fx[4], fy[4];
+
+    // the state derivatives and the outputs are all evaluated from the same
+    // perturbation of v
+    for (unsigned int k=0;k<4;k++)
+    {
+        v.set(v0);
+        v.set(iV, v.get(iV)+dv[k]);
+        fy[k] = y.get();
+        fx[k] = x.getDeriv();
+    }
+    v.set(v0);
+
+    auto derivative = [&](const std::vector<double> * f, unsigned int i)
     {
-        J[iY].resize(nX);
-        for (unsigned int iX=0;iX<nX;iX++)
+        double diff1 = f[0][i]-f[2][i];
+        double diff2 = f[1][i]-f[3][i];
+
+        // correct for angle wrap
+        if (v.getComp(iV)->getUnit().compare("rad") == 0) {
+            while(diff1 > M_PI) diff1 -= 2*M_PI;
+            if(diff1 < -M_PI) diff1 += 2*M_PI;
+            if(diff2 > M_PI) diff2 -= 2*M_PI;
+            if(diff2 < -M_PI) diff2 += 2*M_PI;
+        } else if (v.getComp(iV)->getUnit().compare("deg") == 0) {
+            if(diff1 > 180) diff1 -= 360;
+            if(diff1 < -180) diff1 += 360;
+            if(diff2 > 180) diff2 -= 360;
+            if(diff2 < -180) diff2 += 360;
+        }
+        double df = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
+
+        if (m_fdm->GetDebugLevel() > 1)
         {
-            x.set(x0);
-            x.set(iX,x.get(iX)+h);
-            if (computeYDerivative) f1 = y.getDeriv(iY);
-            else f1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)+2*h);
-            if (computeYDerivative) f2 = y.getDeriv(iY);
-            else f2 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-h);
-            if (computeYDerivative) fn1 = y.getDeriv(iY);
-            else fn1 = y.get(iY);
-
-            x.set(x0);
-            x.set(iX,x.get(iX)-2*h);
-            if (computeYDerivative) fn2 = y.getDeriv(iY);
-            else fn2 = y.get(iY);
-
-			double diff1 = f1-fn1;
-			double diff2 = f2-fn2;
-
-			// correct for angle wrap
-			if (x.getComp(iX)->getUnit().compare("rad") == 0) {
-				while(diff1 > M_PI) diff1 -= 2*M_PI;
-				if(diff1 < -M_PI) diff1 += 2*M_PI;
-				if(diff2 > M_PI) diff2 -= 2*M_PI;
-				if(diff2 < -M_PI) diff2 += 2*M_PI;
-			} else if (x.getComp(iX)->getUnit().compare("deg") == 0) {
-				if(diff1 > 180) diff1 -= 360;
-				if(diff1 < -180) diff1 += 360;
-				if(diff2 > 180) diff2 -= 360;
-				if(diff2 < -180) diff2 += 360;
-			}
-            J[iY][iX] = (8*diff1-diff2)/(12*h); // 3rd order taylor approx from lewis, pg 203
-
-            x.set(x0);
-
-            if (m_fdm->GetDebugLevel() > 1)
-            {
-                FGLogging log(LogLevel::DEBUG);
-                log << std::scientific << "\ty:\t" << y.getName(iY) << "\tx:\t"
-                    << x.getName(iX)
-                    << "\tfn2:\t" << fn2 << "\tfn1:\t" << fn1
-                    << "\tf1:\t" << f1 << "\tf2:\t" << f2
-                    << "\tf1-fn1:\t" << f1-fn1
-                    << "\tf2-fn2:\t" << f2-fn2
-                    << "\tdf/dx:\t" << J[iY][iX]
-                    << std::fixed << "\n";
-            }
+            FGLogging log(LogLevel::DEBUG);
+            log << std::scientific << "\ty:\t"
+                << (f == fx ? x.getName(i) + " deriv" : y.getName(i))
+                << "\tx:\t" << v.getName(iV)
+                << "\tfn2:\t" << f[3][i] << "\tfn1:\t" << f[2][i]
+                << "\tf1:\t" << f[0][i] << "\tf2:\t" << f[1][i]
+                << "\tf1-fn1:\t" << f[0][i]-f[2][i]
+                << "\tf2-fn2:\t" << f[1][i]-f[3][i]
+                << "\tdf/dx:\t" << df
+                << std::fixed << "\n";
         }
-    }
+        return df;
+    };
+
+    for (unsigned int iX=0;iX<nX;iX++) Jx[iX][iV] = derivative(fx, iX);
+    for (unsigned int iY=0;iY<nY;iY++) Jy[iY][iV] = derivative(fy, iY);
 }
 
 std::ostream &operator<<( std::ostream &out, const FGStateSpace::Component &c )
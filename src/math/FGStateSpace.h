@@ -28,6 +28,7 @@
 #include "models/propulsion/FGTurboProp.h"
 #include "models/FGAuxiliary.h"
 #include "models/FGFCS.h"
+#include "models/FGOutput.h"
 #include <fstream>
 #include <iostream>
 #include <limits>
@@ -52,6 +53,9 @@ public:
         virtual ~Component() {};
         virtual double get() const = 0;
         virtual void set(double val) = 0;
+        // copy of the component, nullptr if it cannot be copied in which case
+        // the jacobians are not computed in parallel
+        virtual Component* clone() const { return nullptr; }
         virtual double getDeriv() const
         {
             // by default should calculate using finite difference approx
@@ -59,6 +63,8 @@ public:
             double f0 = get();
             double dt0 = m_fdm->GetDeltaT();
             double time0 = m_fdm->GetSimTime();
+            // the outputs of the worker clones are disabled and must stay so
+            bool output0 = m_fdm->GetOutput()->IsEnabled();
             m_fdm->Setdt(1./120.);
             m_fdm->DisableOutput();
             m_fdm->Run();
@@ -78,7 +84,7 @@ public:
             double deriv = (f1-f0)/m_fdm->GetDeltaT();
             m_fdm->Setdt(dt0); // restore original value
             m_fdm->Setsim_time(time0);
-            m_fdm->EnableOutput();
+            if (output0) m_fdm->EnableOutput();
             return deriv;
         }
         void setStateSpace(FGStateSpace * stateSpace)
@@ -230,6 +236,7 @@ public:
 
         // wait for stable state
         double cost = stateSum();
+        bool output0 = m_fdm->GetOutput()->IsEnabled();
         for(int i=0;i<1000;i++) {
             m_fdm->GetPropulsion()->GetSteadyState();
             m_fdm->SetTrimStatus(true);
@@ -237,7 +244,7 @@ public:
             m_fdm->SuspendIntegration();
             m_fdm->Run();
             m_fdm->SetTrimStatus(false);
-            m_fdm->EnableOutput();
+            if (output0) m_fdm->EnableOutput();
             m_fdm->ResumeIntegration();
 
             double costNew = stateSum();
@@ -277,20 +284,24 @@ public:
     // deconstructor
     virtual ~FGStateSpace() {};
 
-    // linearization function
+    // linearization function, the columns of the jacobians are spread over
+    // nthreads clones of the flight dynamics model
     void linearize(std::vector<double> x0, std::vector<double> u0, std::vector<double> y0,
                    std::vector< std::vector<double> > & A,
                    std::vector< std::vector<double> > & B,
                    std::vector< std::vector<double> > & C,
-                   std::vector< std::vector<double> > & D);
+                   std::vector< std::vector<double> > & D,
+                   unsigned int nthreads = 1);
 
 
 private:
 
-    // compute numerical jacobian of a matrix
-    void numericalJacobian(std::vector< std::vector<double> > & J, ComponentVector & y,
-                           ComponentVector & x, const std::vector<double> & y0,
-                           const std::vector<double> & x0, double h=1e-5, bool computeYDerivative = false);
+    // compute the column iV of the numerical jacobians of the state
+    // derivatives (Jx) and of the outputs (Jy) with respect to v
+    void numericalJacobian(std::vector< std::vector<double> > & Jx,
+                           std::vector< std::vector<double> > & Jy,
+                           ComponentVector & v, const std::vector<double> & v0,
+                           unsigned int iV, double h);
 
     // flight dynamcis model
     FGFDMExec * m_fdm;
@@ -303,6 +314,7 @@ public:
     {
     public:
         Vt() : Component("Vt","ft/s") {};
+        Component* clone() const { return new Vt(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVt();
@@ -326,6 +338,7 @@ public:
     {
     public:
         VGround() : Component("VGround","ft/s") {};
+        Component* clone() const { return new VGround(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetVground();
@@ -340,6 +353,7 @@ public:
     {
     public:
         AccelX() : Component("AccelX","ft/s^2") {};
+        Component* clone() const { return new AccelX(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(1);
@@ -354,6 +368,7 @@ public:
     {
     public:
         AccelY() : Component("AccelY","ft/s^2") {};
+        Component* clone() const { return new AccelY(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(2);
@@ -368,6 +383,7 @@ public:
     {
     public:
         AccelZ() : Component("AccelZ","ft/s^2") {};
+        Component* clone() const { return new AccelZ(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->GetPilotAccel(3);
@@ -382,6 +398,7 @@ public:
     {
     public:
         Alpha() : Component("Alpha","rad") {};
+        Component* clone() const { return new Alpha(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getalpha();
@@ -406,6 +423,7 @@ public:
     {
     public:
         Theta() : Component("Theta","rad") {};
+        Component* clone() const { return new Theta(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(2);
@@ -425,6 +443,7 @@ public:
     {
     public:
         Q() : Component("Q","rad/s") {};
+        Component* clone() const { return new Q(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(2);
@@ -443,6 +462,7 @@ public:
     {
     public:
         Alt() : Component("Alt","ft") {};
+        Component* clone() const { return new Alt(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetAltitudeASL();
@@ -461,6 +481,7 @@ public:
     {
     public:
         Beta() : Component("Beta","rad") {};
+        Component* clone() const { return new Beta(*this); }
         double get() const
         {
             return m_fdm->GetAuxiliary()->Getbeta();
@@ -481,6 +502,7 @@ public:
     {
     public:
         Phi() : Component("Phi","rad") {};
+        Component* clone() const { return new Phi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(1);
@@ -499,6 +521,7 @@ public:
     {
     public:
         P() : Component("P","rad/s") {};
+        Component* clone() const { return new P(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(1);
@@ -517,6 +540,7 @@ public:
     {
     public:
         R() : Component("R","rad/s") {};
+        Component* clone() const { return new R(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQR(3);
@@ -535,6 +559,7 @@ public:
     {
     public:
         Psi() : Component("Psi","rad") {};
+        Component* clone() const { return new Psi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetEuler(3);
@@ -553,6 +578,7 @@ public:
     {
     public:
         ThrottleCmd() : Component("ThtlCmd","norm") {};
+        Component* clone() const { return new ThrottleCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottleCmd(0);
@@ -569,6 +595,7 @@ public:
     {
     public:
         ThrottlePos() : Component("ThtlPos","norm") {};
+        Component* clone() const { return new ThrottlePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetThrottlePos(0);
@@ -584,6 +611,7 @@ public:
     {
     public:
         DaCmd() : Component("DaCmd","norm") {};
+        Component* clone() const { return new DaCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaCmd();
@@ -599,6 +627,7 @@ public:
     {
     public:
         DaPos() : Component("DaPos","norm") {};
+        Component* clone() const { return new DaPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDaLPos();
@@ -614,6 +643,7 @@ public:
     {
     public:
         DeCmd() : Component("DeCmd","norm") {};
+        Component* clone() const { return new DeCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDeCmd();
@@ -629,6 +659,7 @@ public:
     {
     public:
         DePos() : Component("DePos","norm") {};
+        Component* clone() const { return new DePos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDePos();
@@ -643,6 +674,7 @@ public:
     {
     public:
         DrCmd() : Component("DrCmd","norm") {};
+        Component* clone() const { return new DrCmd(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrCmd();
@@ -658,6 +690,7 @@ public:
     {
     public:
         DrPos() : Component("DrPos","norm") {};
+        Component* clone() const { return new DrPos(*this); }
         double get() const
         {
             return m_fdm->GetFCS()->GetDrPos();
@@ -672,6 +705,7 @@ public:
     {
     public:
         Rpm0() : Component("Rpm0","rev/min") {};
+        Component* clone() const { return new Rpm0(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetRPM();
@@ -686,6 +720,7 @@ public:
     {
     public:
         Rpm1() : Component("Rpm1","rev/min") {};
+        Component* clone() const { return new Rpm1(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(1)->GetThruster()->GetRPM();
@@ -700,6 +735,7 @@ public:
     {
     public:
         Rpm2() : Component("Rpm2","rev/min") {};
+        Component* clone() const { return new Rpm2(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(2)->GetThruster()->GetRPM();
@@ -714,6 +750,7 @@ public:
     {
     public:
         Rpm3() : Component("Rpm3","rev/min") {};
+        Component* clone() const { return new Rpm3(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(3)->GetThruster()->GetRPM();
@@ -728,6 +765,7 @@ public:
     {
     public:
         PropPitch() : Component("Prop Pitch","deg") {};
+        Component* clone() const { return new PropPitch(*this); }
         double get() const
         {
             return m_fdm->GetPropulsion()->GetEngine(0)->GetThruster()->GetPitch();
@@ -743,6 +781,7 @@ public:
     {
     public:
         Longitude() : Component("Longitude","rad") {};
+        Component* clone() const { return new Longitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLongitude();
@@ -761,6 +800,7 @@ public:
     {
     public:
         Latitude() : Component("Latitude","rad") {};
+        Component* clone() const { return new Latitude(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetLatitude();
@@ -779,6 +819,7 @@ public:
     {
     public:
         Pi() : Component("P inertial","rad/s") {};
+        Component* clone() const { return new Pi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(1);
@@ -800,6 +841,7 @@ public:
     {
     public:
         Qi() : Component("Q inertial","rad/s") {};
+        Component* clone() const { return new Qi(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(2);
@@ -821,6 +863,7 @@ public:
     {
     public:
         Ri() : Component("R inertial","rad/s") {};
+        Component* clone() const { return new Ri(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetPQRi(3);
@@ -842,6 +885,7 @@ public:
     {
     public:
         Vn() : Component("Vel north","feet/s") {};
+        Component* clone() const { return new Vn(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(1);
@@ -861,6 +905,7 @@ public:
     {
     public:
         Ve() : Component("Vel east","feet/s") {};
+        Component* clone() const { return new Ve(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(2);
@@ -880,6 +925,7 @@ public:
     {
     public:
         Vd() : Component("Vel down","feet/s") {};
+        Component* clone() const { return new Vd(*this); }
         double get() const
         {
             return m_fdm->GetPropagate()->GetVel(3);
@@ -899,6 +945,7 @@ public:
     {
     public:
         COG() : Component("Course Over Ground","rad") {};
+        Component* clone() const { return new COG(*this); }
         double get() const
         {
             //cog = atan2(Ve,Vn)
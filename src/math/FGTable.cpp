@@ -32,12 +32,15 @@ HISTORY
 --------------------------------------------------------------------------------
 JSB  1/9/00          Created
 ADM  2026/04/17      Added support for 4D and higher tables.
+     2026/10/16      Cached interval lookup and optional reciprocal spans.
 
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <limits>
 #include <optional>
 
@@ -80,6 +83,58 @@ namespace JSBSim {
 
 namespace { // anonymous namespace for helper functions
 
+std::atomic<bool> useReciprocalSpans(false);
+
+// Returns the index r of the upper breakpoint of the interval [x(r-1), x(r)]
+// that contains key, where x(i) = bp[i*stride] and 2 <= r <= n. This is the
+// lowest index such that key <= x(r), or n if there is none.
+// The lookup keys usually change little from one time step to the next so the
+// search starts from the interval found by the previous call (hint) and its
+// neighbours before falling back to a binary search.
+unsigned int FindInterval(const double* bp, size_t stride, unsigned int n,
+                          double key, unsigned int& hint)
+{
+  unsigned int r = hint;
+  assert(r >= 2 && r <= n);
+
+  if (key <= bp[r*stride] || r == n) {
+    if (r == 2 || bp[(r-1)*stride] < key) return r;
+    if (r == 3 || bp[(r-2)*stride] < key) return hint = r-1;
+  } else if (r+1 == n || key <= bp[(r+1)*stride])
+    return hint = r+1;
+
+  unsigned int lo = 2, hi = n;
+  while (lo < hi) {
+    unsigned int mid = (lo + hi) / 2;
+    if (bp[mid*stride] < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return hint = lo;
+}
+
+// Same interval as FindInterval() for breakpoints stored contiguously in
+// bp[1..n], n >= 2. The search is a branchless binary search: its number of
+// iterations only depends on n, which suits the evaluation of many unrelated
+// keys.
+inline unsigned int FindIntervalBranchless(const double* bp, unsigned int n,
+                                           double key)
+{
+  const double* base = bp + 2;
+  unsigned int len = n - 1;
+
+  while (len > 1) {
+    unsigned int half = len / 2;
+    base = base[half] < key ? base + half : base;
+    len -= half;
+  }
+
+  unsigned int r = static_cast<unsigned int>(base - bp) + (*base < key);
+  return r < n ? r : n;
+}
+
 unsigned int FindNumColumns(const string& test_line)
 {
   // determine number of data columns in table (first column is row lookup - don't count)
@@ -382,8 +437,13 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
   }
 
   if (leafData) {
-    stringstream buf;
-    AppendNumericData(leafData, buf);
+    // The numbers are converted once per XML file and shared by all the
+    // tables built from the same document (see FGXMLFileRead).
+    auto numbers = leafData->GetDataAsNumbers();
+    if (!numbers) {
+      stringstream buf;
+      AppendNumericData(leafData, buf); // Throws an exception
+    }
 
     nDims = InferLeafDimension(leafData);
 
@@ -395,7 +455,7 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       // Fill unused elements with NaNs to detect illegal access.
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
-      *this << buf;
+      Data.insert(Data.end(), numbers->begin(), numbers->end());
       break;
     case 2u:
       nRows = leafData->GetNumDataLines()-1u;
@@ -403,7 +463,7 @@ FGTable::FGTable(std::shared_ptr<FGPropertyManager> pm, Element* el,
       Type = tt2D;
       // Fill unused elements with NaNs to detect illegal access.
       Data.push_back(std::numeric_limits<double>::quiet_NaN());
-      *this << buf;
+      Data.insert(Data.end(), numbers->begin(), numbers->end());
       break;
     default:
       UNREACHABLE("invalid table type") // Should never be called
@@ -611,15 +671,10 @@ double FGTable::GetValue(const double* keys) const
     return Tables[nRows-1]->GetValue(keys);
 
   // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2u;
-  while (Data[r] < outerKey) r++;
+  unsigned int r = FindInterval(Data.data(), 1, nRows, outerKey, RowHint);
 
   double x0 = Data[r-1u];
-  double Span = Data[r] - x0;
-  assert(Span > 0.0);
-  double Factor = (outerKey - x0) / Span;
-  assert(Factor >= 0.0 && Factor <= 1.0);
+  double Factor = Interpolate(outerKey, x0, Data[r], RowInvSpans, r);
 
   double y0 = Tables[r-2u]->GetValue(keys);
   return Factor*(Tables[r-1u]->GetValue(keys) - y0) + y0;
@@ -639,15 +694,10 @@ double FGTable::GetValue(double key) const
     return Data[2*nRows+1];
 
   // Search for the right breakpoint.
-  // This is a linear search, the algorithm is O(n).
-  unsigned int r = 2;
-  while (Data[2*r] < key) r++;
+  unsigned int r = FindInterval(Data.data(), 2, nRows, key, RowHint);
 
   double x0 = Data[2*r-2];
-  double Span = Data[2*r] - x0;
-  assert(Span > 0.0);
-  double Factor = (key - x0) / Span;
-  assert(Factor >= 0.0 && Factor <= 1.0);
+  double Factor = Interpolate(key, x0, Data[2*r], RowInvSpans, r);
 
   double y0 = Data[2*r-1];
   return Factor*(Data[2*r+1] - y0) + y0;
@@ -662,24 +712,21 @@ double FGTable::GetValue(double rowKey, double colKey) const
 
   if (nCols == 1) return GetValue(rowKey);
 
-  unsigned int c = 2;
-  while(Data[c] < colKey && c < nCols) c++;
+  unsigned int c = FindInterval(Data.data(), 1, nCols, colKey, ColHint);
   double x0 = Data[c-1];
-  double Span = Data[c] - x0;
-  assert(Span > 0.0);
-  double cFactor = Constrain(0.0, (colKey - x0) / Span, 1.0);
+  double cFactor = Constrain(0.0, Interpolate(colKey, x0, Data[c], ColInvSpans, c),
+                             1.0);
 
   if (nRows == 1) {
     double y0 = Data[(nCols+1)+c-1];
     return cFactor*(Data[(nCols+1)+c] - y0) + y0;
   }
 
-  size_t r = 2;
-  while(Data[r*(nCols+1)] < rowKey && r < nRows) r++;
+  size_t r = FindInterval(Data.data(), nCols+1, nRows, rowKey, RowHint);
   x0 = Data[(r-1)*(nCols+1)];
-  Span = Data[r*(nCols+1)] - x0;
-  assert(Span > 0.0);
-  double rFactor = Constrain(0.0, (rowKey - x0) / Span, 1.0);
+  double rFactor = Constrain(0.0,
+                             Interpolate(rowKey, x0, Data[r*(nCols+1)], RowInvSpans, r),
+                             1.0);
   double col1temp = rFactor*Data[r*(nCols+1)+c-1]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c-1];
   double col2temp = rFactor*Data[r*(nCols+1)+c]+(1.0-rFactor)*Data[(r-1)*(nCols+1)+c];
 
@@ -725,6 +772,246 @@ double FGTable::GetValue(double a1, double a2, double a3, double a4,
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGTable::GetValues(size_t n, const double* keys, double* values) const
+{
+  assert((Type == tt1D) || (Type == tt2D && nCols == 1));
+  assert(Data.size() == 2*nRows+2);
+
+  const double first = Data[2], last = Data[2*nRows];
+
+  if (nRows == 1) {
+    std::fill(values, values+n, Data[3]);
+    return;
+  }
+
+  // Gather the breakpoints in a contiguous array.
+  vector<double> bp(nRows+1);
+  for (unsigned int r=1; r<=nRows; ++r)
+    bp[r] = Data[2*r];
+
+  for (size_t i=0; i<n; ++i) {
+    const double key = keys[i];
+
+    if (key <= first)
+      values[i] = Data[3];
+    else if (key >= last)
+      values[i] = Data[2*nRows+1];
+    else {
+      unsigned int r = FindIntervalBranchless(bp.data(), nRows, key);
+      double Factor = Interpolate(key, bp[r-1], bp[r], RowInvSpans, r);
+      double y0 = Data[2*r-1];
+      values[i] = Factor*(Data[2*r+1] - y0) + y0;
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(size_t n, const double* rowKeys, const double* colKeys,
+                        double* values) const
+{
+  assert(Type == tt2D);
+  assert(Data.size() == (nCols+1)*(nRows+1));
+
+  if (nCols == 1) {
+    GetValues(n, rowKeys, values);
+    return;
+  }
+
+  const size_t stride = nCols+1;
+  // The column breakpoints are contiguous (first row) but the row breakpoints
+  // (first column) must be gathered.
+  const double* colBp = Data.data();
+  vector<double> rowBp(nRows+1);
+  for (unsigned int r=1; r<=nRows; ++r)
+    rowBp[r] = Data[r*stride];
+
+  for (size_t i=0; i<n; ++i) {
+    const double colKey = colKeys[i];
+    unsigned int c = FindIntervalBranchless(colBp, nCols, colKey);
+    double cFactor = Constrain(0.0,
+                               Interpolate(colKey, colBp[c-1], colBp[c],
+                                           ColInvSpans, c),
+                               1.0);
+
+    if (nRows == 1) {
+      double y0 = Data[stride+c-1];
+      values[i] = cFactor*(Data[stride+c] - y0) + y0;
+      continue;
+    }
+
+    const double rowKey = rowKeys[i];
+    size_t r = FindIntervalBranchless(rowBp.data(), nRows, rowKey);
+    double rFactor = Constrain(0.0,
+                               Interpolate(rowKey, rowBp[r-1], rowBp[r],
+                                           RowInvSpans, r),
+                               1.0);
+    double col1temp = rFactor*Data[r*stride+c-1]+(1.0-rFactor)*Data[(r-1)*stride+c-1];
+    double col2temp = rFactor*Data[r*stride+c]+(1.0-rFactor)*Data[(r-1)*stride+c];
+
+    values[i] = cFactor*(col2temp-col1temp)+col1temp;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(size_t n, const double* rowKeys, const double* colKeys,
+                        const double* tableKeys, double* values) const
+{
+  assert(nDims == 3);
+  GetValues(n, {rowKeys, colKeys, tableKeys}, values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::GetValues(size_t n, const vector<const double*>& keys,
+                        double* values) const
+{
+  if (keys.size() < nDims) {
+    LogException err;
+    err << "Keys size does not match the table dimensions.\n";
+    throw err;
+  }
+
+  if (Type == tt1D) {
+    GetValues(n, keys[0], values);
+    return;
+  }
+
+  if (Type == tt2D) {
+    GetValues(n, keys[0], keys[1], values);
+    return;
+  }
+
+  assert(Type == ttND);
+  assert(Data.size() == nRows+1);
+
+  // Index of the lower sub-table of each point and interpolation factor
+  // between the lower and the upper sub-tables. Points off the ends of the
+  // table only use the boundary sub-table and are not interpolated.
+  const double* outerKeys = keys[nDims-1];
+  vector<unsigned int> lower(n);
+  vector<double> factor(n);
+  vector<char> interpolated(n, 0);
+
+  for (size_t i=0; i<n; ++i) {
+    const double key = outerKeys[i];
+
+    if (key <= Data[1])
+      lower[i] = 0;
+    else if (key >= Data[nRows])
+      lower[i] = nRows-1;
+    else {
+      unsigned int r = FindIntervalBranchless(Data.data(), nRows, key);
+      lower[i] = r-2;
+      factor[i] = Interpolate(key, Data[r-1], Data[r], RowInvSpans, r);
+      interpolated[i] = 1;
+    }
+  }
+
+  // Sort the points by lower sub-table so that each sub-table is evaluated
+  // once for all the points that need it.
+  vector<size_t> start(nRows+1, 0), order(n);
+  for (size_t i=0; i<n; ++i) ++start[lower[i]+1];
+  for (unsigned int k=1; k<=nRows; ++k) start[k] += start[k-1];
+  {
+    vector<size_t> pos(start.begin(), start.end()-1);
+    for (size_t i=0; i<n; ++i) order[pos[lower[i]]++] = i;
+  }
+
+  vector<double> y0(n), y1(n);
+  vector<size_t> points;
+  vector<vector<double>> subKeys(nDims-1);
+  vector<const double*> subKeyPtrs(nDims-1);
+  vector<double> subValues;
+
+  for (unsigned int k=0; k<nRows; ++k) {
+    // Tables[k] is the lower sub-table of the points of the bucket k and the
+    // upper sub-table of the interpolated points of the bucket k-1.
+    for (int upper=0; upper<2; ++upper) {
+      points.clear();
+      if (!upper)
+        points.assign(order.begin()+start[k], order.begin()+start[k+1]);
+      else if (k > 0) {
+        for (size_t j=start[k-1]; j<start[k]; ++j)
+          if (interpolated[order[j]]) points.push_back(order[j]);
+      }
+
+      if (points.empty()) continue;
+
+      for (unsigned int axis=0; axis<nDims-1; ++axis) {
+        subKeys[axis].resize(points.size());
+        for (size_t j=0; j<points.size(); ++j)
+          subKeys[axis][j] = keys[axis][points[j]];
+        subKeyPtrs[axis] = subKeys[axis].data();
+      }
+
+      subValues.resize(points.size());
+      Tables[k]->GetValues(points.size(), subKeyPtrs, subValues.data());
+
+      vector<double>& y = upper ? y1 : y0;
+      for (size_t j=0; j<points.size(); ++j)
+        y[points[j]] = subValues[j];
+    }
+  }
+
+  for (size_t i=0; i<n; ++i)
+    values[i] = interpolated[i] ? factor[i]*(y1[i] - y0[i]) + y0[i] : y0[i];
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGTable::Interpolate(double key, double x0, double x1,
+                            const std::vector<double>& invSpans,
+                            size_t i) const
+{
+  if (useReciprocalSpans.load(std::memory_order_relaxed)) {
+    if (SpansDirty) ComputeSpans();
+    return (key - x0) * invSpans[i];
+  }
+
+  double Span = x1 - x0;
+  assert(Span > 0.0);
+  return (key - x0) / Span;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::ComputeSpans(void) const
+{
+  // Row breakpoints are stored in the first column (1D and 2D tables) or in
+  // the first row (ND tables).
+  const size_t stride = Type == ttND ? 1 : nCols+1;
+
+  RowInvSpans.assign(nRows+1, 0.0);
+  for (size_t r=2; r<=nRows; ++r)
+    RowInvSpans[r] = 1.0 / (Data[r*stride] - Data[(r-1)*stride]);
+
+  ColInvSpans.assign(nCols+1, 0.0);
+  if (Type == tt2D) {
+    for (size_t c=2; c<=nCols; ++c)
+      ColInvSpans[c] = 1.0 / (Data[c] - Data[c-1]);
+  }
+
+  SpansDirty = false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTable::SetReciprocalSpans(bool enabled)
+{
+  useReciprocalSpans = enabled;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGTable::GetReciprocalSpans(void)
+{
+  return useReciprocalSpans;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 double FGTable::GetMinValue(void) const
 {
   assert(Type == tt1D);
@@ -750,6 +1037,8 @@ void FGTable::operator<<(istream& in_stream)
     Data.push_back(x);
     in_stream >> x;
   }
+
+  SpansDirty = true;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -758,6 +1047,7 @@ FGTable& FGTable::operator<<(const double x)
 {
   assert(Type != ttND);
   Data.push_back(x);
+  SpansDirty = true;
 
   // Check column is monotically increasing
   size_t n = Data.size();
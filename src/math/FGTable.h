@@ -371,6 +371,26 @@ public:
                   double a6) const;
   double GetValue(const std::vector<double>& keys) const;
 
+  /** @brief Get the values of the table at many points.
+      The breakpoints are searched with a branchless binary search that does
+      not depend on the previous lookups so the points do not need to be
+      sorted. Each value is the same as the one returned by GetValue() for the
+      same keys.
+      @param n Number of points
+      @param keys Lookup keys: keys[axis][i] is the coordinate of the point i
+                  along the axis (row, column, table, ...)
+      @param values Array of size n in which the values are returned */
+  void GetValues(size_t n, const std::vector<const double*>& keys,
+                 double* values) const;
+  /// @brief Get the values of a 1D table at many points.
+  void GetValues(size_t n, const double* rowKeys, double* values) const;
+  /// @brief Get the values of a 2D table at many points.
+  void GetValues(size_t n, const double* rowKeys, const double* colKeys,
+                 double* values) const;
+  /// @brief Get the values of a 3D table at many points.
+  void GetValues(size_t n, const double* rowKeys, const double* colKeys,
+                 const double* tableKeys, double* values) const;
+
   double GetMinValue(void) const;
   double GetMinValue(double colKey) const;
   double GetMinValue(double colKey, double TableKey) const;
@@ -416,6 +436,16 @@ public:
 
   std::string GetName(void) const {return Name;}
 
+  /** Enables or disables the interpolation with precomputed reciprocal spans.
+      The interpolation factors are then computed with a multiplication
+      instead of a division, which is faster but may change the interpolated
+      values in their last bits. The setting applies to all the tables of the
+      process and is disabled by default.
+      @param enabled true to use the reciprocal spans. */
+  static void SetReciprocalSpans(bool enabled);
+  /// Returns true if the tables interpolate with reciprocal spans.
+  static bool GetReciprocalSpans(void);
+
 private:
   enum type {tt1D, tt2D, ttND} Type;
   enum axis {eRow=0, eColumn, eTable};
@@ -427,6 +457,12 @@ private:
   std::vector<std::unique_ptr<FGTable>> Tables;
   unsigned int nRows = 0u, nCols = 0u, nDims = 0u;
   std::string Name;
+  // Intervals found by the last lookups, used as the starting point of the
+  // next lookups.
+  mutable unsigned int RowHint = 2u, ColHint = 2u;
+  // Reciprocals of the breakpoint spans, computed on demand.
+  mutable std::vector<double> RowInvSpans, ColInvSpans;
+  mutable bool SpansDirty = true;
 
   void SetLookupProperty(unsigned int axis, FGPropertyValue_ptr node)
   {
@@ -440,6 +476,9 @@ private:
   }
 
   double GetValue(const double* keys) const;
+  double Interpolate(double key, double x0, double x1,
+                     const std::vector<double>& invSpans, size_t i) const;
+  void ComputeSpans(void) const;
   void bind(Element* el, const std::string& Prefix);
   void missingData(Element *el, unsigned int expected_size, size_t actual_size);
   void Debug(int from);
@@ -55,7 +55,9 @@ INCLUDES
 
 #include "FGAccelerations.h"
 #include "FGFDMExec.h"
+#include "FGGroundReactions.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -71,6 +73,10 @@ FGAccelerations::FGAccelerations(FGFDMExec* fdmex)
   Debug(0);
   Name = "FGAccelerations";
   gravTorque = false;
+  FrictionIterations = 0;
+  MaxFrictionIterations = 50;
+  FrictionConstraints = 0;
+  FrictionResidual = 0.0;
 
   vPQRidot.InitMatrix();
   vUVWidot.InitMatrix();
@@ -99,6 +105,18 @@ bool FGAccelerations::InitModel(void)
   vUVWdot.InitMatrix();
   vBodyAccel.InitMatrix();
 
+  // Each landing gear registers at most 2 Lagrange multipliers: rolling and
+  // side friction or a single dynamic friction.
+  size_t n = 2*FDMExec->GetGroundReactions()->GetNumGearUnits();
+  if (FrictionLambda.size() < n) {
+    FrictionMatrix.resize(n*n);
+    FrictionRHS.resize(n);
+    FrictionLambda.resize(n);
+  }
+  FrictionIterations = 0;
+  FrictionConstraints = 0;
+  FrictionResidual = 0.0;
+
   return true;
 }
 
@@ -237,12 +255,24 @@ void FGAccelerations::CalculateFrictionForces(double dt)
 
   vFrictionForces.InitMatrix();
   vFrictionMoments.InitMatrix();
+  FrictionConstraints = static_cast<int>(n);
+  FrictionIterations = 0;
+  FrictionResidual = 0.0;
 
   // If no gears are in contact with the ground then return
   if (!n) return;
 
-  vector<double> a(n*n); // Will contain Jac*M^-1*Jac^T
-  vector<double> rhs(n);
+  // The storage is normally sized by InitModel() so this only happens if more
+  // multipliers than expected are registered.
+  if (FrictionLambda.size() < n) {
+    FrictionMatrix.resize(n*n);
+    FrictionRHS.resize(n);
+    FrictionLambda.resize(n);
+  }
+
+  double* a = FrictionMatrix.data(); // Will contain Jac*M^-1*Jac^T
+  double* rhs = FrictionRHS.data();
+  double* lambda = FrictionLambda.data();
 
   // Assemble the linear system of equations
   for (unsigned int i=0; i < n; i++) {
@@ -277,6 +307,8 @@ void FGAccelerations::CalculateFrictionForces(double dt)
   // 1. Compute the right hand side member 'rhs'
   // 2. Divide every line of 'a' and 'rhs' by a[i,i]. This is in order to save
   //    a division computation at each iteration of Gauss-Seidel.
+  // 3. Copy the multipliers values of the previous time step (kept by the
+  //    landing gears) to warm start the iterations.
   for (unsigned int i=0; i < n; i++) {
     double d = a[i*n+i];
     FGColumnVector3 U = multipliers[i]->ForceJacobian;
@@ -286,28 +318,37 @@ void FGAccelerations::CalculateFrictionForces(double dt)
 
     for (unsigned int j=0; j < n; j++)
       a[i*n+j] /= d;
+
+    lambda[i] = multipliers[i]->value;
   }
 
-  // Resolve the Lagrange multipliers with the projected Gauss-Seidel method
-  for (int iter=0; iter < 50; iter++) {
+  // Resolve the Lagrange multipliers with the projected Gauss-Seidel method.
+  // The iterations stop as soon as the multipliers are no longer modified.
+  while (FrictionIterations < MaxFrictionIterations) {
     double norm = 0.;
+    FrictionIterations++;
 
     for (unsigned int i=0; i < n; i++) {
-      double lambda0 = multipliers[i]->value;
+      const double* ai = a + i*n;
+      double lambda0 = lambda[i];
       double dlambda = rhs[i];
 
       for (unsigned int j=0; j < n; j++)
-        dlambda -= a[i*n+j]*multipliers[j]->value;
+        dlambda -= ai[j]*lambda[j];
 
-      multipliers[i]->value = Constrain(multipliers[i]->Min, lambda0+dlambda, multipliers[i]->Max);
-      dlambda = multipliers[i]->value - lambda0;
+      lambda[i] = Constrain(multipliers[i]->Min, lambda0+dlambda, multipliers[i]->Max);
+      dlambda = lambda[i] - lambda0;
 
       norm += fabs(dlambda);
     }
 
+    FrictionResidual = norm;
     if (norm < 1E-5) break;
   }
 
+  for (unsigned int i=0; i < n; i++)
+    multipliers[i]->value = lambda[i];
+
   // Calculate the total friction forces and moments
 
   for (unsigned int i=0; i< n; i++) {
@@ -376,11 +417,25 @@ void FGAccelerations::bind(void)
   PropertyManager->Tie("moments/l-gear-lbsft", this, eL, &FGAccelerations::GetGroundMoments);
   PropertyManager->Tie("moments/m-gear-lbsft", this, eM, &FGAccelerations::GetGroundMoments);
   PropertyManager->Tie("moments/n-gear-lbsft", this, eN, &FGAccelerations::GetGroundMoments);
+  PropertyManager->Tie("forces/friction/iterations", this, &FGAccelerations::GetFrictionIterations);
+  PropertyManager->Tie("forces/friction/max-iterations", &MaxFrictionIterations);
+  PropertyManager->Tie("forces/friction/constraints", this, &FGAccelerations::GetFrictionConstraints);
+  PropertyManager->Tie("forces/friction/residual", this, &FGAccelerations::GetFrictionResidual);
+
   PropertyManager->Tie("forces/fbx-gear-lbs", this, eX, &FGAccelerations::GetGroundForces);
   PropertyManager->Tie("forces/fby-gear-lbs", this, eY, &FGAccelerations::GetGroundForces);
   PropertyManager->Tie("forces/fbz-gear-lbs", this, eZ, &FGAccelerations::GetGroundForces);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAccelerations::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(vPQRdot, vPQRidot, vUVWdot, vUVWidot, vBodyAccel, vFrictionForces,
+           vFrictionMoments, gravTorque);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
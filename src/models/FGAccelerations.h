@@ -114,6 +114,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   /** Retrieves the body axis acceleration.
       Retrieves the computed body axis accelerations based on the
@@ -311,6 +312,19 @@ public:
    */
   void InitializeDerivatives(void);
 
+  /** Retrieves the number of projected Gauss-Seidel iterations executed by
+      the friction solver at the last time step. */
+  int GetFrictionIterations(void) const { return FrictionIterations; }
+
+  /** Retrieves the number of Lagrange multipliers (friction constraints)
+      solved at the last time step. */
+  int GetFrictionConstraints(void) const { return FrictionConstraints; }
+
+  /** Retrieves the residual of the friction solver at the last time step. The
+      residual is the sum of the absolute changes of the Lagrange multipliers
+      during the last iteration. */
+  double GetFrictionResidual(void) const { return FrictionResidual; }
+
   /** Sets the property forces/hold-down. This allows to do hard 'hold-down'
       such as for rockets on a launch pad with engines ignited.
       @param hd enables the 'hold-down' function if non-zero
@@ -372,6 +386,18 @@ private:
 
   bool gravTorque;
 
+  // Storage of the friction solver: the matrix Jac*M^-1*Jac^T, the right hand
+  // side and the Lagrange multipliers. It is sized from the number of contact
+  // points when the model is initialized and reused from a time step to the
+  // next.
+  std::vector<double> FrictionMatrix;
+  std::vector<double> FrictionRHS;
+  std::vector<double> FrictionLambda;
+  int FrictionIterations;
+  int MaxFrictionIterations;
+  int FrictionConstraints;
+  double FrictionResidual;
+
   void CalculatePQRdot(void);
   void CalculateUVWdot(void);
 
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -184,24 +185,13 @@ bool FGAerodynamics::Run(bool Holding)
 
   BuildStabilityTransformMatrices();
 
-  for (axis_ctr = 0; axis_ctr < 3; ++axis_ctr) {
-    AeroFunctionArray::iterator f;
-
-    AeroFunctionArray* array = &AeroFunctions[axis_ctr];
-    for (f=array->begin(); f != array->end(); ++f) {
-      // Tell the Functions to cache values, so when the function values are
-      // being requested for output, the functions do not get calculated again
-      // in a context that might have changed, but instead use the values that
-      // have already been calculated for this frame.
-      (*f)->cacheValue(true);
-      vFnative(axis_ctr+1) += (*f)->GetValue();
-    }
+  FGProfiler* profiler = FDMExec->GetProfiler().get();
+  if (!profiler->IsEnabled()) profiler = nullptr;
 
-    array = &AeroFunctionsAtCG[axis_ctr];
-    for (f=array->begin(); f != array->end(); ++f) {
-      (*f)->cacheValue(true); // Same as above
-      vFnativeAtCG(axis_ctr+1) += (*f)->GetValue();
-    }
+  for (axis_ctr = 0; axis_ctr < 3; ++axis_ctr) {
+    vFnative(axis_ctr+1) += RunFunctions(AeroFunctions[axis_ctr], profiler);
+    vFnativeAtCG(axis_ctr+1) += RunFunctions(AeroFunctionsAtCG[axis_ctr],
+                                             profiler);
   }
 
   switch (forceAxisType) {
@@ -251,17 +241,8 @@ bool FGAerodynamics::Run(bool Holding)
 
   vMomentsMRC.InitMatrix();
 
-  for (axis_ctr = 0; axis_ctr < 3; axis_ctr++) {
-    AeroFunctionArray* array = &AeroFunctions[axis_ctr+3];
-    for (AeroFunctionArray::iterator f=array->begin(); f != array->end(); ++f) {
-      // Tell the Functions to cache values, so when the function values are
-      // being requested for output, the functions do not get calculated again
-      // in a context that might have changed, but instead use the values that
-      // have already been calculated for this frame.
-      (*f)->cacheValue(true);
-      vMomentsMRC(axis_ctr+1) += (*f)->GetValue();
-    }
-  }
+  for (axis_ctr = 0; axis_ctr < 3; axis_ctr++)
+    vMomentsMRC(axis_ctr+1) += RunFunctions(AeroFunctions[axis_ctr+3], profiler);
 
   // Transform moments to bodyXYZ if the moments are specified in stability or
   // wind axes
@@ -495,6 +476,29 @@ void FGAerodynamics::DetermineAxisSystem(Element* document)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+double FGAerodynamics::RunFunctions(const AeroFunctionArray& functions,
+                                    FGProfiler* profiler)
+{
+  double sum = 0.0;
+
+  for (auto f: functions) {
+    // Tell the Functions to cache values, so when the function values are
+    // being requested for output, the functions do not get calculated again
+    // in a context that might have changed, but instead use the values that
+    // have already been calculated for this frame.
+    FGProfiler::Scope scope(profiler ? profiler->GetTimer(f, [f]() {
+      string name = f->GetName();
+      return name.rfind("aero/", 0) == 0 ? name : "aero/" + name;
+    }) : nullptr);
+    f->cacheValue(true);
+    sum += f->GetValue();
+  }
+
+  return sum;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGAerodynamics::ProcessAxesNameAndFrame(eAxisType& axisType, const string& name,
                                              const string& frame, Element* el,
                                              const string& validNames)
@@ -660,6 +664,30 @@ void FGAerodynamics::BuildStabilityTransformMatrices(void)
   Tb2s = Ts2b.Transposed();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAerodynamics::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(Ts2b, Tb2s, vFnative, vFw, vForces, vFnativeAtCG, vForcesAtCG,
+           vMoments, vMomentsMRC, vMomentsMRCBodyXYZ, vDXYZcg, vDeltaRP);
+  snapshot(alphaclmax, alphaclmin, alphaclmax0, alphaclmin0, alphahystmax,
+           alphahystmin, impending_stall, stall_hyst, bi2vel, ci2vel, alphaw,
+           clsq, lod, qbar_area);
+
+  // The values of the aerodynamic functions are cached once per frame.
+  for (unsigned int axis=0; axis<6; ++axis) {
+    snapshot.Check(AeroFunctions[axis].size(), "the number of aero functions");
+    for (auto f: AeroFunctions[axis])
+      f->SerializeState(snapshot);
+
+    snapshot.Check(AeroFunctionsAtCG[axis].size(),
+                   "the number of aero functions at CG");
+    for (auto f: AeroFunctionsAtCG[axis])
+      f->SerializeState(snapshot);
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -53,6 +53,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGProfiler;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -130,6 +132,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   /** Loads the Aerodynamics model.
       The Load function for this class expects the XML parser to
@@ -282,6 +285,7 @@ private:
                                Element* el, const std::string& validNames);
   void bind(void);
   void BuildStabilityTransformMatrices(void);
+  double RunFunctions(const AeroFunctionArray& functions, FGProfiler* profiler);
 
   void Debug(int from) override;
 };
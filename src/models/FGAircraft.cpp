@@ -42,6 +42,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -198,6 +199,14 @@ void FGAircraft::bind(void)
   PropertyManager->Tie("metrics/visualrefpoint-z-in", this, eZ, &FGAircraft::GetXYZvrp);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAircraft::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(vMoments, vForces, vXYZrp, vXYZvrp, vXYZep, vDXYZcg);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -117,6 +117,7 @@ public:
       @see JSBSim.cpp documentation
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   bool InitModel(void) override;
 
@@ -45,6 +45,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGAtmosphere.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -358,6 +359,16 @@ void FGAtmosphere::bind(void)
   PropertyManager->Tie("atmosphere/pressure-altitude", this, &FGAtmosphere::GetPressureAltitude);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphere::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(SLtemperature, SLdensity, SLpressure, SLsoundspeed, Temperature,
+           Density, Pressure, Soundspeed, PressureAltitude, DensityAltitude,
+           Viscosity, KinematicViscosity, Reng);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
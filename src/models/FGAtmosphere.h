@@ -96,6 +96,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   bool InitModel(void) override;
 
@@ -49,6 +49,7 @@ INCLUDES
 #include "FGInertial.h"
 #include "FGAtmosphere.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -480,6 +481,19 @@ double FGAuxiliary::BadUnits(void) const
   return 0.0;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAuxiliary::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(vcas, veas, pt, tat, tatc, mTw2b, mTb2w, vPilotAccel, vPilotAccelN,
+           vNcg, vNwcg, vAeroPQR, vAeroUVW, vEulerRates, vMachUVW,
+           vLocationVRP, NEUStartLocation);
+  snapshot(Vt, Vground, Mach, MachU, qbar, qbarUW, qbarUV, Re, alpha, beta,
+           adot, bdot, psigt, gamma, Nx, Ny, Nz, hoverbcg, hoverbmac);
+  NEUCalcValid = false;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
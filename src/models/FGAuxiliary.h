@@ -119,6 +119,7 @@ public:
                      on a socket for the "Resume" command to be given.  @return
                      false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
 // GET functions
 
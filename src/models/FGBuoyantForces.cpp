@@ -40,6 +40,7 @@ INCLUDES
 #include "FGBuoyantForces.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -257,6 +258,19 @@ void FGBuoyantForces::bind(void)
                        &FGBuoyantForces::GetForces, (PSF)nullptr);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBuoyantForces::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(vTotalForces, vTotalMoments, gasCellJ, vGasCellXYZ,
+           vXYZgasCell_arm);
+
+  snapshot.Check(Cells.size(), "the number of gas cells");
+  for (auto cell: Cells)
+    cell->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGExternalReactions.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -147,6 +148,18 @@ void FGExternalReactions::bind(void)
 }
 
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGExternalReactions::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(vTotalForces, vTotalMoments);
+
+  snapshot.Check(Forces.size(), "the number of external forces");
+  for (auto force: Forces)
+    force->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -142,6 +142,7 @@ public:
                      "Resume" command to be given.
       @return true always.  */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
   
   /** Loads the external forces from the XML configuration file.
       If the external_reactions section is encountered in the vehicle configuration
@@ -62,6 +62,7 @@ INCLUDES
 #include "models/flight_control/FGLinearActuator.h"
 
 #include "FGFCSChannel.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -165,6 +166,9 @@ bool FGFCS::Run(bool Holding)
   for (i=0; i<PropAdvance.size(); i++) PropAdvance[i] = PropAdvanceCmd[i];
   for (i=0; i<PropFeather.size(); i++) PropFeather[i] = PropFeatherCmd[i];
 
+  FGProfiler* profiler = FDMExec->GetProfiler().get();
+  if (!profiler->IsEnabled()) profiler = nullptr;
+
   // Execute system channels in order
   for (i=0; i<SystemChannels.size(); i++) {
     if (debug_lvl & 4) {
@@ -172,7 +176,14 @@ bool FGFCS::Run(bool Holding)
       log << "    Executing System Channel: " << SystemChannels[i]->GetName() << endl;
     }
     ChannelRate = SystemChannels[i]->GetRate();
-    SystemChannels[i]->Execute();
+    if (profiler) {
+      FGFCSChannel* channel = SystemChannels[i];
+      FGProfiler::Scope scope(profiler->GetTimer(channel, [channel]() {
+        return "fcs/" + channel->GetName();
+      }));
+      channel->Execute(profiler);
+    } else
+      SystemChannels[i]->Execute();
   }
   ChannelRate = 1;
 
@@ -808,6 +819,24 @@ void FGFCS::bindThrottle(unsigned int num)
                                         &FGFCS::SetPropFeather);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGFCS::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+
+  snapshot(DaCmd, DeCmd, DrCmd, DfCmd, DsbCmd, DspCmd);
+  snapshot(DePos, DaLPos, DaRPos, DrPos, DfPos, DsbPos, DspPos);
+  snapshot(PTrimCmd, YTrimCmd, RTrimCmd);
+  snapshot(ThrottleCmd, ThrottlePos, MixtureCmd, MixturePos, PropAdvanceCmd,
+           PropAdvance, PropFeatherCmd, PropFeather, BrakePos);
+  snapshot(GearCmd, GearPos, TailhookPos, WingFoldPos);
+
+  snapshot.Check(SystemChannels.size(), "the number of FCS channels");
+  for (auto channel: SystemChannels)
+    channel->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -40,6 +40,9 @@ INCLUDES
 
 #include <iostream>
 
+#include "FGProfiler.h"
+#include "input_output/FGSnapshot.h"
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -114,8 +117,10 @@ public:
     // after a reset.
     ExecFrameCountSinceLastRun = ExecRate;
   }
-  /// Executes all the components in a channel.
-  void Execute() {
+  /** Executes all the components in a channel.
+      @param profiler when not null, the execution time of each component is
+                      measured by this profiler. */
+  void Execute(FGProfiler* profiler = nullptr) {
     // If there is an on/off property supplied for this channel, check
     // the value. If it is true, permit execution to continue. If not, return
     // and do not execute the channel.
@@ -132,12 +137,28 @@ public:
     // channel will be run at rate 1 if trimming, or when the next execrate
     // frame is reached
     if (fcs->GetTrimStatus() || ExecFrameCountSinceLastRun >= ExecRate) {
-      for (unsigned int i=0; i<FCSComponents.size(); i++)
-        FCSComponents[i]->Run();
+      if (profiler) {
+        for (auto comp: FCSComponents) {
+          FGProfiler::Scope scope(profiler->GetTimer(comp, [this, comp]() {
+            return "fcs/" + Name + "/" + comp->GetName();
+          }));
+          comp->Run();
+        }
+      } else {
+        for (unsigned int i=0; i<FCSComponents.size(); i++)
+          FCSComponents[i]->Run();
+      }
     }
   }
   /// Get the channel rate
   int GetRate(void) const { return ExecRate; }
+  /// Saves or restores the state of the channel and of its components.
+  void SerializeState(FGSnapshot& snapshot) {
+    snapshot(ExecFrameCountSinceLastRun);
+    snapshot.Check(FCSComponents.size(), "the number of components in " + Name);
+    for (auto comp: FCSComponents)
+      comp->SerializeState(snapshot);
+  }
 
   private:
     FGFCS* fcs;
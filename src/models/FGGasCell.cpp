@@ -40,6 +40,7 @@ INCLUDES
 #include "FGGasCell.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using std::string;
 using std::max;
@@ -424,6 +425,19 @@ void FGGasCell::Calculate(double dt)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGasCell::SerializeState(FGSnapshot& snapshot)
+{
+  FGForce::SerializeState(snapshot);
+  snapshot(Pressure, Contents, Volume, dVolumeIdeal, Temperature, Buoyancy,
+           Mass, gasCellJ, gasCellM);
+
+  snapshot.Check(Ballonet.size(), "the number of ballonets");
+  for (auto ballonet: Ballonet)
+    ballonet->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -776,6 +790,14 @@ void FGBallonet::Calculate(double dt)
   ballonetJ += MassBalance->GetPointmassInertia(GetMass(), GetXYZ());
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBallonet::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(Pressure, Contents, Volume, dVolumeIdeal, dU, Temperature,
+           ballonetJ);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -53,6 +53,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGBallonet;
+class FGSnapshot;
 class FGMassBalance;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -184,6 +185,7 @@ public:
   /** Runs the gas cell model; called by BuoyantForces
    */
   void Calculate(double dt);
+  void SerializeState(FGSnapshot& snapshot) override;
 
   /** Get the index of this gas cell
       @return gas cell index. */
@@ -309,6 +311,8 @@ public:
   /** Runs the ballonet model; called by FGGasCell
    */
   void Calculate(double dt);
+  /// Saves or restores the state of the ballonet.
+  void SerializeState(FGSnapshot& snapshot);
 
 
   /** Get the center of gravity location of the ballonet
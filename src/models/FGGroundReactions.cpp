@@ -42,6 +42,7 @@ INCLUDES
 #include "FGAccelerations.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -248,6 +249,19 @@ void FGGroundReactions::bind(void)
                        &FGGroundReactions::SetDsCmd);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGGroundReactions::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  FGSurface::SerializeState(snapshot);
+  snapshot(vForces, vMoments, DsCmd);
+
+  snapshot.Check(lGear.size(), "the number of contact points");
+  for (auto& gear: lGear)
+    gear->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -41,6 +41,7 @@ INCLUDES
 #include "FGInput.h"
 #include "FGFDMExec.h"
 #include "input_output/FGUDPInputSocket.h"
+#include "input_output/FGBinaryInputSocket.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
@@ -104,6 +105,8 @@ bool FGInput::Load(Element* el)
     Input = new FGInputSocket(FDMExec, enabled);
   } else if (type == "QTJSBSIM") {
     Input = new FGUDPInputSocket(FDMExec, enabled);
+  } else if (type == "BINARY") {
+    Input = new FGBinaryInputSocket(FDMExec, enabled);
   } else if (type != string("NONE")) {
     FGXMLLogging log(element, LogLevel::ERROR);
     log << "Unknown type of input specified in config file" << endl;
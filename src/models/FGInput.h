@@ -63,6 +63,9 @@ CLASS DOCUMENTATION
       SOCKET      Will eventually send data to a socket input, where NAME
                   would then be the IP address of the machine the data should
                   be sent to. DON'T USE THIS YET!
+      QTJSBSIM    Receives UDP datagrams of comma separated values.
+      BINARY      Receives UDP packets of binary values with a layout declared
+                  in the input element (see FGBinaryInputSocket).
       NONE        Specifies to do nothing. This setting makes it easy to turn on and
                   off the data input without having to mess with anything else.
 
@@ -71,6 +74,19 @@ CLASS DOCUMENTATION
 @code
 <input type="SOCKET" port="4321"/>
 @endcode
+<br>
+
+    ASYNC can be set to "ON" for the socket inputs (TCP and UDP) so that the
+    data is received by a background thread shared by all the input sockets of
+    the process, whichever FGFDMExec they belong to. The simulation step then
+    never waits for the network (unless the input is BLOCKING_INPUT) and the
+    received data is applied when FGInput runs, right after FGPropagate and
+    before all the other models, so every model of the frame sees the same
+    values.
+
+@code
+<input type="SOCKET" port="4321" async="ON"/>
+@endcode
 <br>
 
     The class FGInput is the manager of the inputs requested by the user. It
@@ -48,6 +48,7 @@ INCLUDES
 #include "math/FGTable.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -905,6 +906,27 @@ void FGLGear::Report(ReportType repType)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGLGear::SerializeState(FGSnapshot& snapshot)
+{
+  FGForce::SerializeState(snapshot);
+
+  snapshot(mTGear, vLocalGear, vWhlVelVec, vGroundWhlVel, vGroundNormal);
+  snapshot(SteerAngle, staticFCoeff, dynamicFCoeff, rollingFCoeff, Peak,
+           compressLength, compressSpeed, BrakeFCoeff, SinkRate, GroundSpeed,
+           TakeoffDistanceTraveled, TakeoffDistanceTraveled50ft,
+           LandingDistanceTraveled, MaximumStrutForce, StrutForce,
+           MaximumStrutTravel, FCoeff, WheelSlip, GearPos, AGL);
+  snapshot(staticFFactor, rollingFFactor, maximumForce, bumpiness, isSolid);
+  snapshot(WOW, lastWOW, FirstContact, StartedGroundRun, LandingReported,
+           TakeoffReported, ReportEnable, StaticFriction);
+
+  // The Lagrange multipliers are the initial guess of the friction solver.
+  for (auto& lm: LMultiplier)
+    snapshot(lm.ForceJacobian, lm.LeverArm, lm.Min, lm.Max, lm.value);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -235,6 +235,7 @@ public:
 
   /// The Force vector for this gear
   const FGColumnVector3& GetBodyForces(void) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   /// Gets the location of the gear in Body axes
   FGColumnVector3 GetBodyLocation(void) const {
@@ -44,6 +44,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -67,7 +68,12 @@ FGMassBalance::FGMassBalance(FGFDMExec* fdmex)
   baseJ.InitMatrix();
   mJ.InitMatrix();
   mJinv.InitMatrix();
-  pmJ.InitMatrix();
+  UpdateNeeded = true;
+  TanksRevision = 0;
+  ChildFDMWeight = GasMass = 0.0;
+  MassPropertiesUpdates = 0;
+  in.GasMass = 0.0;
+  in.TanksRevision = 0;
   Propagate = fdmex->GetPropagate();
 
   bind();
@@ -92,6 +98,15 @@ bool FGMassBalance::InitModel(void)
 
   vLastXYZcg.InitMatrix();
   vDeltaXYZcg.InitMatrix();
+  UpdateNeeded = true;
+
+  // Rebuild the point mass sums from scratch so that the round off accumulated
+  // by their incremental updates does not carry over to the next run.
+  PointMassTotal = MassProperties();
+  for (auto pm: PointMasses) {
+    pm->Contribution = MassProperties();
+    pm->Changed = true;
+  }
 
   return true;
 }
@@ -161,12 +176,12 @@ bool FGMassBalance::Load(Element* document)
     element = document->FindNextElement("pointmass");
   }
 
-  double ChildFDMWeight = 0.0;
+  ChildFDMWeight = 0.0;
   for (size_t fdm=0; fdm<FDMExec->GetFDMCount(); fdm++) {
     if (FDMExec->GetChildFDM(fdm)->mated) ChildFDMWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
   }
 
-  Weight = EmptyWeight + in.TanksWeight + GetTotalPointMassWeight()
+  Weight = EmptyWeight + in.Tanks.Weight + GetTotalPointMassWeight()
     + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
@@ -189,22 +204,61 @@ bool FGMassBalance::Run(bool Holding)
 
   RunPreFunctions();
 
-  double ChildFDMWeight = 0.0;
+  double ChildWeight = 0.0;
   for (size_t fdm=0; fdm<FDMExec->GetFDMCount(); fdm++) {
-    if (FDMExec->GetChildFDM(fdm)->mated) ChildFDMWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
+    if (FDMExec->GetChildFDM(fdm)->mated) ChildWeight += FDMExec->GetChildFDM(fdm)->exec->GetMassBalance()->GetWeight();
   }
 
-  Weight = EmptyWeight + in.TanksWeight + GetTotalPointMassWeight()
-    + in.GasMass*slugtolb + ChildFDMWeight;
+  // The mass properties are only recomputed when one of the masses has
+  // changed.
+  bool changed = UpdateNeeded || ChildWeight != ChildFDMWeight
+    || in.TanksRevision != TanksRevision || in.GasMass != GasMass
+    || in.GasMoment != GasMoment || in.GasInertia != GasInertia;
+
+  for (auto pm: PointMasses) {
+    if (pm->Changed) {
+      PointMassTotal -= pm->Contribution;
+      pm->Contribution = CalculateMassProperties(pm->Weight, pm->Location,
+                                                 pm->mPMInertia);
+      PointMassTotal += pm->Contribution;
+      pm->Changed = false;
+      changed = true;
+    }
+  }
+
+  if (!changed) {
+    vDeltaXYZcg.InitMatrix();
+    vDeltaXYZcgBody.InitMatrix();
+
+    RunPostFunctions();
+
+    Debug(0);
+
+    return false;
+  }
+
+  UpdateNeeded = false;
+  ChildFDMWeight = ChildWeight;
+  TanksRevision = in.TanksRevision;
+  GasMass = in.GasMass;
+  GasMoment = in.GasMoment;
+  GasInertia = in.GasInertia;
+  MassPropertiesUpdates++;
+
+  // The empty vehicle is a mass located at the base CG with the base
+  // configuration inertia matrix.
+  MassProperties total = CalculateMassProperties(EmptyWeight, vbaseXYZcg,
+                                                 baseJ);
+  total += PointMassTotal;
+  total += in.Tanks;
+
+  Weight = total.Weight + in.GasMass*slugtolb + ChildFDMWeight;
 
   Mass = lbtoslug*Weight;
 
 // Calculate new CG
 
-  vXYZcg = (EmptyWeight*vbaseXYZcg
-            + GetPointMassMoment()
-            + in.TanksMoment
-            + in.GasMoment) / Weight;
+  vXYZcg = (total.Moment + in.GasMoment) / Weight;
 
   // Track frame-by-frame delta CG, and move the EOM-tracked location
   // by this amount.
@@ -220,13 +274,30 @@ bool FGMassBalance::Run(bool Holding)
 
 // Calculate new total moments of inertia
 
-  // At first it is the base configuration inertia matrix ...
-  mJ = baseJ;
-  // ... with the additional term originating from the parallel axis theorem.
-  mJ += GetPointmassInertia( lbtoslug * EmptyWeight, vbaseXYZcg );
-  // Then add the contributions from the additional pointmasses.
-  mJ += CalculatePMInertias();
-  mJ += in.TankInertia;
+  // The inertia of the empty vehicle, the point masses and the tanks is moved
+  // from the origin of the structural frame to the CG by the parallel axis
+  // theorem. Since the CG includes the gas cells and the child FDMs, the first
+  // moment of the masses does not vanish about the CG:
+  //   sum(m*S(p+o)) = sum(m*S(p)) + m*S(o) + 2(P.o)I - P*o^T - o*P^T
+  // where o is the location of the origin relative to the CG and P the first
+  // moment about the origin.
+  FGColumnVector3 o = StructuralToBody(FGColumnVector3());
+  FGColumnVector3 P = lbtoslug*inchtoft*FGColumnVector3(-total.Moment(eX),
+                                                        total.Moment(eY),
+                                                        -total.Moment(eZ));
+  double Po = 2.0*DotProduct(P, o);
+  FGMatrix33 cross;
+
+  for (unsigned int i=1; i<=3; i++) {
+    for (unsigned int j=1; j<=3; j++)
+      cross(i,j) = -P(i)*o(j) - o(i)*P(j);
+    cross(i,i) += Po;
+  }
+
+  mJ = total.J;
+  mJ += GetPointmassInertiaBody(lbtoslug*total.Weight, o);
+  mJ += cross;
+  // The gas cells compute their inertia about the CG.
   mJ += in.GasInertia;
 
   Ixx = mJ(1,1);
@@ -344,18 +415,18 @@ const FGColumnVector3& FGMassBalance::GetPointMassMoment(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-const FGMatrix33& FGMassBalance::CalculatePMInertias(void)
+FGMassBalance::MassProperties
+FGMassBalance::CalculateMassProperties(double weight, const FGColumnVector3& r,
+                                       const FGMatrix33& J)
 {
-  if (PointMasses.empty()) return pmJ;
-
-  pmJ.InitMatrix();
+  MassProperties m;
+  FGColumnVector3 v(-inchtoft*r(eX), inchtoft*r(eY), -inchtoft*r(eZ));
 
-  for (auto pm: PointMasses) {
-    pmJ += GetPointmassInertia( lbtoslug * pm->Weight, pm->Location );
-    pmJ += pm->GetPointMassInertia();
-  }
+  m.Weight = weight;
+  m.Moment = weight*r;
+  m.J = J + GetPointmassInertiaBody(lbtoslug*weight, v);
 
-  return pmJ;
+  return m;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -409,6 +480,8 @@ void FGMassBalance::bind(void)
   PropertyManager->Tie("inertia/iyz-slugs_ft2", this, &FGMassBalance::GetIyz);
   PropertyManager->Tie<FGMassBalance, int>("inertia/print-mass-properties", this,
                                             nullptr, &FGMassBalance::GetMassPropertiesReport);
+  PropertyManager->Tie("inertia/mass-properties-updates", this,
+                       &FGMassBalance::GetMassPropertiesUpdates);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -476,6 +549,24 @@ void FGMassBalance::GetMassPropertiesReport(int i)
       << LogFormat::NORMAL << endl;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMassBalance::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(Weight, EmptyWeight, Mass, mJ, mJinv, baseJ, vXYZcg,
+           vLastXYZcg, vDeltaXYZcg, vDeltaXYZcgBody, vXYZtank, vbaseXYZcg,
+           vPMxyz, PointMassCG, PointMassTotal.Weight, PointMassTotal.Moment,
+           PointMassTotal.J, UpdateNeeded, TanksRevision, ChildFDMWeight,
+           GasMass, GasMoment, GasInertia, MassPropertiesUpdates);
+
+  snapshot.Check(PointMasses.size(), "the number of point masses");
+  for (auto pm: PointMasses)
+    snapshot(pm->Location, pm->Weight, pm->mPMInertia, pm->Changed,
+             pm->Contribution.Weight, pm->Contribution.Moment,
+             pm->Contribution.J);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
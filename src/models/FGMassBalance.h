@@ -65,6 +65,12 @@ CLASS DOCUMENTATION
     inertia to be calculated based on the shape. Note that a cylinder is solid,
     a tube is hollow, a ball is solid and a sphere is hollow.
 
+    The weight, the CG and the inertia matrix are only recomputed when a mass
+    has changed: a point mass, a tank, a gas cell or a child FDM. The
+    contributions of the point masses and of the tanks are then updated by
+    delta. The number of updates is given by the property
+    inertia/mass-properties-updates.
+
     The inertia tensor must be specified in the structural frame (x axis
     positive aft, y axis positive out of the right wing and z axis upward). The
     sign of the inertia cross products are optional by JSBSim.
@@ -139,6 +145,7 @@ public:
                      on a socket for the "Resume" command to be given.  @return
                      false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   double GetMass(void) const {return Mass;}
   double GetWeight(void) const {return Weight;}
@@ -160,19 +167,45 @@ public:
    */
   FGMatrix33 GetPointmassInertia(double mass_sl, const FGColumnVector3& r) const
   {
-    FGColumnVector3 v = StructuralToBody( r );
-    FGColumnVector3 sv = mass_sl*v;
-    double xx = sv(1)*v(1);
-    double yy = sv(2)*v(2);
-    double zz = sv(3)*v(3);
-    double xy = -sv(1)*v(2);
-    double xz = -sv(1)*v(3);
-    double yz = -sv(2)*v(3);
-    return FGMatrix33( yy+zz, xy, xz,
-                       xy, xx+zz, yz,
-                       xz, yz, xx+yy );
+    return GetPointmassInertiaBody(mass_sl, StructuralToBody(r));
   }
 
+  /** Mass properties summed over a set of masses (point masses, tanks, ...).
+      The inertia is taken about the origin of the structural frame rather
+      than about the CG so that the sum can be updated by delta when one of
+      the masses changes, whatever the location of the CG. */
+  struct MassProperties {
+    /// Weight in pounds.
+    double Weight = 0.0;
+    /// Weight times location in the structural frame, in lbs*in.
+    FGColumnVector3 Moment;
+    /// Inertia about the origin of the structural frame, in the body frame.
+    FGMatrix33 J;
+
+    MassProperties& operator+=(const MassProperties& m) {
+      Weight += m.Weight;
+      Moment += m.Moment;
+      J += m.J;
+      return *this;
+    }
+    MassProperties& operator-=(const MassProperties& m) {
+      Weight -= m.Weight;
+      Moment -= m.Moment;
+      J -= m.J;
+      return *this;
+    }
+  };
+
+  /** Computes the mass properties of a mass.
+      @param weight the weight in pounds
+      @param r the location of the mass in the structural frame (inches)
+      @param J the inertia matrix of the mass about its own CG, expressed in
+               the body frame
+   */
+  static MassProperties CalculateMassProperties(double weight,
+                                                const FGColumnVector3& r,
+                                                const FGMatrix33& J);
+
   /** Conversion from the structural frame to the body frame.
       Converts the location given in the structural frame
       coordinate system to the body frame. The units of the structural
@@ -184,8 +217,11 @@ public:
    */
   FGColumnVector3 StructuralToBody(const FGColumnVector3& r) const;
 
-  void SetEmptyWeight(double EW) { EmptyWeight = EW;}
-  void SetBaseCG(const FGColumnVector3& CG) {vbaseXYZcg = vXYZcg = CG;}
+  void SetEmptyWeight(double EW) { EmptyWeight = EW; UpdateNeeded = true;}
+  void SetBaseCG(const FGColumnVector3& CG) {
+    vbaseXYZcg = vXYZcg = CG;
+    UpdateNeeded = true;
+  }
 
   void AddPointMass(Element* el);
   double GetTotalPointMassWeight(void) const;
@@ -195,16 +231,21 @@ public:
   const FGMatrix33& GetJ(void) const {return mJ;}
   /// Returns the inverse of the inertia matrix expressed in the body frame.
   const FGMatrix33& GetJinv(void) const {return mJinv;}
-  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {baseJ = BaseJ;}
+  void SetAircraftBaseInertias(const FGMatrix33& BaseJ) {
+    baseJ = BaseJ;
+    UpdateNeeded = true;
+  }
   void GetMassPropertiesReport(int i);
-  
+  /** Returns the number of times the weight, the CG and the inertia matrix
+      have been recomputed. They are only recomputed when a mass has changed. */
+  int GetMassPropertiesUpdates(void) const {return MassPropertiesUpdates;}
+
   struct Inputs {
     double GasMass;
-    double TanksWeight;
     FGColumnVector3 GasMoment;
     FGMatrix33 GasInertia;
-    FGColumnVector3 TanksMoment;
-    FGMatrix33 TankInertia;
+    MassProperties Tanks;
+    unsigned int TanksRevision;
     bool WOW;
   } in;
 
@@ -215,7 +256,6 @@ private:
   double Mass;
   FGMatrix33 mJ;
   FGMatrix33 mJinv;
-  FGMatrix33 pmJ;
   FGMatrix33 baseJ;
   FGColumnVector3 vXYZcg;
   FGColumnVector3 vLastXYZcg;
@@ -225,7 +265,31 @@ private:
   FGColumnVector3 vbaseXYZcg;
   FGColumnVector3 vPMxyz;
   FGColumnVector3 PointMassCG;
-  const FGMatrix33& CalculatePMInertias(void);
+  MassProperties PointMassTotal;
+
+  // Inputs for which the mass properties were last computed.
+  bool UpdateNeeded;
+  unsigned int TanksRevision;
+  double ChildFDMWeight;
+  double GasMass;
+  FGColumnVector3 GasMoment;
+  FGMatrix33 GasInertia;
+  int MassPropertiesUpdates;
+
+  static FGMatrix33 GetPointmassInertiaBody(double mass_sl,
+                                            const FGColumnVector3& v)
+  {
+    FGColumnVector3 sv = mass_sl*v;
+    double xx = sv(1)*v(1);
+    double yy = sv(2)*v(2);
+    double zz = sv(3)*v(3);
+    double xy = -sv(1)*v(2);
+    double xz = -sv(1)*v(3);
+    double yz = -sv(2)*v(3);
+    return FGMatrix33( yy+zz, xy, xz,
+                       xy, xx+zz, yz,
+                       xz, yz, xx+yy );
+  }
   double GetIxx(void) const { return mJ(1,1); }
   double GetIyy(void) const { return mJ(2,2); }
   double GetIzz(void) const { return mJ(3,3); }
@@ -238,9 +302,10 @@ private:
   struct PointMass {
     PointMass(double w, FGColumnVector3& vXYZ) :
       eShapeType(esUnspecified), Location(vXYZ), Weight(w), Radius(0.0),
-      Length(0.0) {}
+      Length(0.0), Changed(true) {}
 
     void CalculateShapeInertia(void) {
+      Changed = true;
       switch(eShapeType) {
         case esTube:
           mPMInertia(1,1) = (Weight/(slugtolb))*Radius*Radius; // mr^2
@@ -274,6 +339,9 @@ private:
     double Length; /// Length in feet.
     std::string Name;
     FGMatrix33 mPMInertia;
+    /// True if the mass, location or inertia changed since Contribution.
+    bool Changed;
+    MassProperties Contribution;
 
     double GetPointMassLocation(int axis) const {return Location(axis);}
     double GetPointMassWeight(void) const {return Weight;}
@@ -282,16 +350,23 @@ private:
     const FGMatrix33& GetPointMassInertia(void) {return mPMInertia;}
     const std::string& GetName(void) {return Name;}
 
-    void SetPointMassLocation(int axis, double value) {Location(axis) = value;}
+    void SetPointMassLocation(int axis, double value) {
+      Location(axis) = value;
+      Changed = true;
+    }
     void SetPointMassWeight(double wt) {
       Weight = wt;
+      Changed = true;
       CalculateShapeInertia();
     }
     void SetPointMassShapeType(esShape st) {eShapeType = st;}
     void SetRadius(double r) {Radius = r;}
     void SetLength(double l) {Length = l;}
     void SetName(const std::string& name) {Name = name;}
-    void SetPointMassMoI(const FGMatrix33& MoI) { mPMInertia = MoI; }
+    void SetPointMassMoI(const FGMatrix33& MoI) {
+      mPMInertia = MoI;
+      Changed = true;
+    }
     double GetPointMassMoI(int r, int c) {return mPMInertia(r,c);}
 
     void bind(FGPropertyManager* PropertyManager, unsigned int num);
@@ -42,6 +42,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -87,6 +88,14 @@ bool FGModel::InitModel(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGModel::SerializeState(FGSnapshot& snapshot)
+{
+  FGModelFunctions::SerializeState(snapshot);
+  snapshot(exe_ctr, rate);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGModel::Run(bool Holding)
 {
   FGModel::Debug(2);
@@ -97,6 +97,7 @@ public:
   virtual SGPath FindFullPathName(const SGPath& path) const;
   const std::string& GetName(void) const { return Name; }
   virtual bool Load(Element* el) { return true; }
+  void SerializeState(FGSnapshot& snapshot) override;
 
 protected:
   unsigned int exe_ctr;
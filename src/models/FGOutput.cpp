@@ -42,10 +42,14 @@ INCLUDES
 #include "FGOutput.h"
 #include "input_output/FGOutputTextFile.h"
 #include "input_output/FGOutputFG.h"
+#include "input_output/FGOutputBinaryFile.h"
+#include "input_output/FGOutputBinarySocket.h"
+#include "input_output/FGOutputColumnarFile.h"
 #include "input_output/FGXMLFileRead.h"
 #include "input_output/FGModelLoader.h"
 #include "input_output/FGLog.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -70,8 +74,11 @@ FGOutput::FGOutput(FGFDMExec* fdmex) : FGModel(fdmex)
 
 FGOutput::~FGOutput()
 {
-  for (auto output: OutputTypes)
+  // The writer threads must be stopped before the outputs close their files.
+  for (auto output: OutputTypes) {
+    output->StopWriter();
     delete output;
+  }
 
   Debug(1);
 }
@@ -110,15 +117,17 @@ bool FGOutput::Run(bool Holding)
 void FGOutput::Print(void)
 {
   for (auto output: OutputTypes)
-    output->Print();
+    output->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void FGOutput::SetStartNewOutput(void)
 {
-  for (auto output: OutputTypes)
+  for (auto output: OutputTypes) {
+    output->Flush();
     output->SetStartNewOutput();
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -144,7 +153,7 @@ void FGOutput::SetRateHz(double rate)
 void FGOutput::ForceOutput(int idx)
 {
   if (idx >= (int)0 && idx < (int)OutputTypes.size())
-    OutputTypes[idx]->Print();
+    OutputTypes[idx]->Generate();
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -219,6 +228,13 @@ bool FGOutput::Load(int subSystems, std::string protocol, std::string type,
   } else if (type == "FLIGHTGEAR") {
     Output = new FGOutputFG(FDMExec);
     name += ":" + port + "/" + protocol;
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "BINARY_SOCKET") {
+    Output = new FGOutputBinarySocket(FDMExec);
+    name += ":" + port + "/" + protocol;
+  } else if (type == "COLUMNAR") {
+    Output = new FGOutputColumnarFile(FDMExec);
   } else if (type == "TERMINAL") {
     // Not done yet
   } else if (type != string("NONE")) {
@@ -270,6 +286,12 @@ bool FGOutput::Load(Element* document, const SGPath& dir)
     Output = new FGOutputSocket(FDMExec);
   } else if (type == "FLIGHTGEAR") {
     Output = new FGOutputFG(FDMExec);
+  } else if (type == "BINARY") {
+    Output = new FGOutputBinaryFile(FDMExec);
+  } else if (type == "BINARY_SOCKET") {
+    Output = new FGOutputBinarySocket(FDMExec);
+  } else if (type == "COLUMNAR") {
+    Output = new FGOutputColumnarFile(FDMExec);
   } else if (type == "TERMINAL") {
     // Not done yet
   } else if (type != string("NONE")) {
@@ -303,6 +325,19 @@ SGPath FGOutput::FindFullPathName(const SGPath& path) const
   return FGModel::FindFullPathName(path);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGOutput::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+
+  // Only the scheduling of the outputs and the values cached by their functions
+  // are restored: the files and sockets are left untouched.
+  snapshot.Check(OutputTypes.size(), "the number of outputs");
+  for (auto output: OutputTypes)
+    output->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -71,7 +71,20 @@ CLASS DOCUMENTATION
       FLIGHTGEAR  A socket is created for sending binary data packets to
                   an external instance of FlightGear for visuals.  Parameters
                   defining the socket are given on the \<output> line.
+                  With protocol="SHM", the data is instead published in
+                  shared memory, in the native byte order, for a visual system
+                  running on the same host (see FGOutputFG).
       TABULAR     Columnar data.
+      BINARY      Packed binary records of the time, the properties and the
+                  functions of the output, preceded by a header that describes
+                  their names and units (see FGBinaryRecord). The attribute
+                  format="FLOAT32" selects single precision values instead of
+                  the default FLOAT64.
+      BINARY_SOCKET  Same as BINARY but the header and the records are sent
+                  to a TCP or UDP socket defined as for SOCKET.
+      COLUMNAR    Columns of float64 values grouped in chunks and written
+                  through a memory mapped file, for long simulation runs (see
+                  FGOutputColumnarFile).
       TERMINAL    Output to terminal. NOT IMPLEMENTED YET!
       NONE        Specifies to do nothing. This setting makes it easy to turn on
                   and off the data output without having to mess with anything
@@ -96,6 +109,10 @@ CLASS DOCUMENTATION
                 This value may not be *exactly* what you want, due to the
                 dependence on dt, the cycle rate for the FDM.
 
+    ASYNC       ON to generate the output in a background writer thread. The
+                attributes OVERFLOW (BLOCK, DROP or GROW) and QUEUE (number of
+                records) control the queue of the records (see FGOutputType).
+
     The following parameters tell which subsystems of data to output:
 
     simulation       ON|OFF
@@ -144,6 +161,7 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
   /** Makes all the output instances to generate their ouput. This method does
       not check that the time step at which the output is requested is
       consistent with the output rate RATE_IN_HZ. Although Print is not a
@@ -180,6 +198,8 @@ public:
   void Enable(void) { enabled = true; }
   /// Disables the output generation for all output instances.
   void Disable(void) { enabled = false; }
+  /// Returns true if the output generation is enabled.
+  bool IsEnabled(void) const { return enabled; }
   /** Toggles the output generation of each ouput instance.
       @param idx ID of the output instance which output generation will be
                  toggled.
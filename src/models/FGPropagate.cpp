@@ -71,6 +71,7 @@ INCLUDES
 #include "simgear/io/iostreams/sgstream.hxx"
 #include "FGInertial.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -921,6 +922,26 @@ void FGPropagate::bind(void)
                                          nullptr, &FGPropagate::WriteStateFile);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropagate::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+
+  snapshot(VState.vLocation, VState.vUVW, VState.vPQR, VState.vPQRi,
+           VState.qAttitudeLocal, VState.qAttitudeECI, VState.vQtrndot,
+           VState.vInertialVelocity, VState.vInertialPosition,
+           VState.dqPQRidot, VState.dqUVWidot, VState.dqInertialVelocity,
+           VState.dqQtrndot);
+  snapshot(vVel, Tec2b, Tb2ec, Tl2b, Tb2l, Tl2ec, Tec2l, Tec2i, Ti2ec, Ti2b,
+           Tb2i, Ti2l, Tl2i, epa, Qec2b, LocalTerrainVelocity,
+           LocalTerrainAngularVelocity);
+  snapshot(h, Inclination, RightAscension, Eccentricity, PerigeeArgument,
+           TrueAnomaly, ApoapsisRadius, PeriapsisRadius, OrbitalPeriod);
+  snapshot(integrator_rotational_rate, integrator_translational_rate,
+           integrator_rotational_position, integrator_translational_position);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
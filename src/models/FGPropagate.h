@@ -171,6 +171,10 @@ public:
       @return false if no error */
   bool Run(bool Holding);
 
+  /** Saves or restores the state vector, the integrator histories and the
+      transformation matrices. */
+  void SerializeState(FGSnapshot& snapshot) override;
+
   /** Retrieves the velocity vector.
       The vector returned is represented by an FGColumnVector reference. The vector
       for the velocity in Local frame is organized (Vnorth, Veast, Vdown). The vector
@@ -60,6 +60,7 @@ INCLUDES
 #include "models/propulsion/FGTank.h"
 #include "models/propulsion/FGBrushLessDCMotor.h"
 #include "models/FGFCS.h"
+#include "input_output/FGSnapshot.h"
 
 
 using namespace std;
@@ -78,6 +79,7 @@ FGPropulsion::FGPropulsion(FGFDMExec* exec) : FGModel(exec)
 
   ActiveEngine = -1; // -1: ALL, 0: Engine 1, 1: Engine 2 ...
   tankJ.InitMatrix();
+  TanksMassRevision = 0;
   DumpRate = 0.0;
   RefuelRate = 6000.0;
   FuelFreeze = false;
@@ -104,6 +106,11 @@ bool FGPropulsion::InitModel(void)
   vMoments.InitMatrix();
 
   for (auto& tank: Tanks) tank->ResetToIC();
+  // Rebuild the tank sums from scratch so that the round off accumulated by
+  // their incremental updates does not carry over to the next run.
+  TanksMass = FGMassBalance::MassProperties();
+  TankMasses.clear();
+  TankRevisions.clear();
   TotalFuelQuantity = 0.0;
   TotalOxidizerQuantity = 0.0;
   refuel = dump = false;
@@ -266,9 +273,6 @@ void FGPropulsion::ConsumeFuel(FGEngine* engine)
 
 bool FGPropulsion::GetSteadyState(void)
 {
-  double currentThrust = 0, lastThrust = -1;
-  int steady_count = 0, j = 0;
-  bool steady = false;
   bool TrimMode = FDMExec->GetTrimStatus();
   double TimeStep = FDMExec->GetDeltaT();
 
@@ -277,28 +281,12 @@ bool FGPropulsion::GetSteadyState(void)
 
   if (!FGModel::Run(false)) {
     FDMExec->SetTrimStatus(true);
-    // This is a time marching algorithm so it needs a non-zero time step to
-    // reach a steady state.
+    // The engines that cannot solve their steady state directly are time
+    // marched so a non-zero time step is needed to reach a steady state.
     in.TotalDeltaT = 0.5;
 
     for (auto& engine: Engines) {
-      steady=false;
-      steady_count=0;
-      j=0;
-      while (!steady && j < 6000) {
-        engine->Calculate();
-        lastThrust = currentThrust;
-        currentThrust = engine->GetThrust();
-        if (fabs(lastThrust-currentThrust) < 0.0001) {
-          steady_count++;
-          if (steady_count > 120) {
-            steady=true;
-          }
-        } else {
-          steady_count=0;
-        }
-        j++;
-      }
+      engine->GetSteadyState();
       vForces  += engine->GetBodyForces();  // sum body frame forces
       vMoments += engine->GetMoments();     // sum body frame moments
     }
@@ -617,6 +605,33 @@ const FGMatrix33& FGPropulsion::CalculateTankInertias(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+const FGMassBalance::MassProperties& FGPropulsion::GetTanksMassProperties(void)
+{
+  if (TankMasses.size() != Tanks.size()) {
+    TankMasses.resize(Tanks.size());
+    TankRevisions.resize(Tanks.size(), 0);
+  }
+
+  for (size_t i=0; i < Tanks.size(); i++) {
+    const auto& tank = Tanks[i];
+    if (tank->GetMassRevision() == TankRevisions[i]) continue;
+
+    FGMatrix33 J(tank->GetIxx(), 0.0, 0.0,
+                 0.0, tank->GetIyy(), 0.0,
+                 0.0, 0.0, tank->GetIzz());
+    TanksMass -= TankMasses[i];
+    TankMasses[i] = FGMassBalance::CalculateMassProperties(tank->GetContents(),
+                                                           tank->GetXYZ(), J);
+    TanksMass += TankMasses[i];
+    TankRevisions[i] = tank->GetMassRevision();
+    TanksMassRevision++;
+  }
+
+  return TanksMass;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPropulsion::SetMagnetos(int setting)
 {
   if (ActiveEngine < 0) {
@@ -858,6 +873,29 @@ void FGPropulsion::bind(void)
                                            nullptr, &FGPropulsion::SetFuelFreeze);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropulsion::SerializeState(FGSnapshot& snapshot)
+{
+  FGModel::SerializeState(snapshot);
+  snapshot(ActiveEngine, vForces, vMoments, vTankXYZ, vXYZtank_arm, tankJ,
+           refuel, dump, FuelFreeze, TotalFuelQuantity, TotalOxidizerQuantity,
+           DumpRate, RefuelRate, TanksMass.Weight, TanksMass.Moment,
+           TanksMass.J, TankRevisions, TanksMassRevision);
+
+  snapshot.Check(Engines.size(), "the number of engines");
+  for (auto& engine: Engines)
+    engine->SerializeState(snapshot);
+
+  snapshot.Check(Tanks.size(), "the number of tanks");
+  for (auto& tank: Tanks)
+    tank->SerializeState(snapshot);
+
+  if (snapshot.IsRestoring()) TankMasses.resize(TankRevisions.size());
+  for (auto& m: TankMasses)
+    snapshot(m.Weight, m.Moment, m.J);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -42,6 +42,7 @@ INCLUDES
 #include <iosfwd>
 
 #include "FGModel.h"
+#include "FGMassBalance.h"
 #include "propulsion/FGEngine.h"
 #include "math/FGMatrix33.h"
 
@@ -113,6 +114,7 @@ public:
                      "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   bool InitModel(void) override;
 
@@ -146,7 +148,10 @@ public:
     return Tanks[index];
   }
 
-  /** Loops the engines until thrust output steady (used for trimming) */
+  /** Brings the engines to their steady state (used for trimming). The
+      engines solve their equilibrium directly when they can, otherwise they
+      are looped until their thrust output is steady.
+      @see FGEngine::GetSteadyState */
   bool GetSteadyState(void);
 
   /** Sets up the engines as running */
@@ -181,6 +186,12 @@ public:
   void SetActiveEngine(int engine);
   void SetFuelFreeze(bool f);
   const FGMatrix33& CalculateTankInertias(void);
+  /** Returns the mass properties of the tanks. The contribution of a tank is
+      only recomputed when its contents, location or inertia have changed. */
+  const FGMassBalance::MassProperties& GetTanksMassProperties(void);
+  /** Returns a counter that is incremented each time the mass properties of
+      the tanks are modified. */
+  unsigned int GetTanksMassRevision(void) const {return TanksMassRevision;}
 
   struct FGEngine::Inputs in;
 
@@ -193,6 +204,10 @@ private:
   FGColumnVector3 vTankXYZ;
   FGColumnVector3 vXYZtank_arm;
   FGMatrix33 tankJ;
+  FGMassBalance::MassProperties TanksMass;
+  std::vector<FGMassBalance::MassProperties> TankMasses;
+  std::vector<unsigned int> TankRevisions;
+  unsigned int TanksMassRevision;
   bool refuel;
   bool dump;
   bool FuelFreeze;
@@ -40,6 +40,7 @@ INCLUDES
 
 #include "input_output/FGPropertyManager.h"
 #include "models/FGSurface.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -111,4 +112,12 @@ double FGSurface::GetBumpHeight()
   return h*(1/8.)*bumpiness*maxGroundBumpAmplitude;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGSurface::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(staticFFactor, rollingFFactor, maximumForce, bumpiness, isSolid,
+           pos);
+}
+
 } // namespace JSBSim
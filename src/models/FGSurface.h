@@ -46,6 +46,7 @@ namespace JSBSim {
 
 class FGFDMExec;
 class FGPropertyManager;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -70,6 +71,9 @@ public:
   /// Reset all surface values to a default
   void resetValues(void);
 
+  /// Saves or restores the properties of the surface.
+  void SerializeState(FGSnapshot& snapshot);
+
   /// Sets the static friction factor of the surface area
   void SetStaticFFactor(double friction) { staticFFactor = friction; }
 
@@ -0,0 +1,367 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGAtmosphereProfile.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Tabulated altitude profile of atmospheric quantities
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Tabulates atmospheric quantities versus altitude from a reference model and
+interpolates them with monotone piecewise cubic Hermite polynomials.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "FGAtmosphereProfile.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Number of intervals in which the altitude range is initially split before
+// the intervals are bisected.
+static constexpr unsigned int InitialIntervals = 32;
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+static double RelativeError(const vector<double>& values, const double* reference)
+{
+  double error = 0.0;
+
+  for (unsigned int c=0; c<values.size(); ++c) {
+    double delta = fabs(values[c] - reference[c]);
+    error = max(error, reference[c] != 0.0 ? delta / fabs(reference[c]) : delta);
+  }
+
+  return error;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGAtmosphereProfile::FGAtmosphereProfile(const vector<bool>& logScale)
+  : LogScale(logScale)
+{
+  assert(!LogScale.empty());
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphereProfile::Clear(void)
+{
+  Altitudes.clear();
+  Values.clear();
+  Slopes.clear();
+  MaxError = 0.0;
+  LastInterval = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGAtmosphereProfile::Build(const Sampler& reference, double hmin,
+                                double hmax, const vector<double>& breaks,
+                                double tolerance)
+{
+  assert(hmax > hmin);
+
+  const size_t nc = LogScale.size();
+  vector<double> sample(nc);
+
+  // Evaluates the reference model and stores the result in the format used
+  // for the nodes (i.e. with the logarithm of the log scaled columns).
+  auto AddNode = [&](double h, vector<double>& values) {
+    reference(h, sample.data());
+    for (unsigned int c=0; c<nc; ++c)
+      values.push_back(LogScale[c] ? log(sample[c]) : sample[c]);
+  };
+  // The midpoints are kept with their reference values to be compared with
+  // the interpolation.
+  auto AddMidpoint = [&](double h, vector<double>& values) {
+    reference(h, sample.data());
+    values.insert(values.end(), sample.begin(), sample.end());
+  };
+
+  Clear();
+
+  // Seed the profile with the range ends, the breaks and a uniform grid in
+  // between. Each break is replaced by two nodes located half BreakWidth
+  // below and above it so that the reference model is sampled on both sides of
+  // the break, whichever side the break itself belongs to. The short interval
+  // between these two nodes bridges a possible discontinuity of the reference
+  // model and is never bisected.
+  vector<double> knots {hmin};
+  vector<double> sortedBreaks = breaks;
+  sort(sortedBreaks.begin(), sortedBreaks.end());
+  for (double b: sortedBreaks) {
+    if (b - 0.5*BreakWidth > knots.back() && b + 0.5*BreakWidth < hmax) {
+      knots.push_back(b - 0.5*BreakWidth);
+      knots.push_back(b + 0.5*BreakWidth);
+    }
+  }
+  knots.push_back(hmax);
+
+  vector<bool> isBreak, isBridge;
+  double step = (hmax - hmin) / InitialIntervals;
+  for (unsigned int k=0; k<knots.size()-1; ++k) {
+    double length = knots[k+1] - knots[k];
+    bool bridge = k % 2 == 1;
+    unsigned int n = bridge ? 1u
+                   : max(1u, static_cast<unsigned int>(ceil(length / step)));
+    for (unsigned int j=0; j<n; ++j) {
+      Altitudes.push_back(knots[k] + j*length/n);
+      isBreak.push_back(j == 0);
+      isBridge.push_back(bridge);
+    }
+  }
+  Altitudes.push_back(hmax);
+  isBreak.push_back(true);
+
+  vector<double> midpoints;
+  for (unsigned int i=0; i<Altitudes.size(); ++i) {
+    AddNode(Altitudes[i], Values);
+    if (i > 0)
+      AddMidpoint(0.5*(Altitudes[i-1]+Altitudes[i]), midpoints);
+  }
+
+  // Bisect the intervals until the interpolation matches the reference model
+  // at the midpoint of every interval. Since the slopes depend on the
+  // neighbouring nodes, all the intervals are checked again after each pass.
+  // The bridges are not checked since the reference model may jump there.
+  while (true) {
+    ComputeSlopes(isBreak);
+
+    size_t numIntervals = Altitudes.size() - 1;
+    vector<bool> split(numIntervals, false);
+    size_t numSplits = 0;
+    vector<double> interpolated(nc);
+    MaxError = 0.0;
+
+    for (unsigned int i=0; i<numIntervals; ++i) {
+      if (isBridge[i]) continue;
+      double h = 0.5*(Altitudes[i]+Altitudes[i+1]);
+      Evaluate(i, h, interpolated.data());
+      double error = RelativeError(interpolated, &midpoints[i*nc]);
+      MaxError = max(MaxError, error);
+      if (error > tolerance && Altitudes[i+1] - Altitudes[i] > 2.0*MinInterval) {
+        split[i] = true;
+        ++numSplits;
+      }
+    }
+
+    if (numSplits == 0 || Altitudes.size() + numSplits > MaxNodes) break;
+
+    vector<double> newAltitudes, newValues, newMidpoints;
+    vector<bool> newIsBreak, newIsBridge;
+    newAltitudes.reserve(Altitudes.size() + numSplits);
+    newValues.reserve(Values.size() + numSplits*nc);
+    newMidpoints.reserve(midpoints.size() + numSplits*nc);
+
+    for (unsigned int i=0; i<numIntervals; ++i) {
+      newAltitudes.push_back(Altitudes[i]);
+      newIsBreak.push_back(isBreak[i]);
+      newIsBridge.push_back(isBridge[i]);
+      newValues.insert(newValues.end(), Values.begin() + i*nc,
+                       Values.begin() + (i+1)*nc);
+      if (split[i]) {
+        double h = 0.5*(Altitudes[i]+Altitudes[i+1]);
+        newAltitudes.push_back(h);
+        newIsBreak.push_back(false);
+        newIsBridge.push_back(false);
+        for (unsigned int c=0; c<nc; ++c) {
+          double v = midpoints[i*nc+c];
+          newValues.push_back(LogScale[c] ? log(v) : v);
+        }
+        AddMidpoint(0.5*(Altitudes[i]+h), newMidpoints);
+        AddMidpoint(0.5*(h+Altitudes[i+1]), newMidpoints);
+      }
+      else
+        newMidpoints.insert(newMidpoints.end(), midpoints.begin() + i*nc,
+                            midpoints.begin() + (i+1)*nc);
+    }
+    newAltitudes.push_back(Altitudes.back());
+    newIsBreak.push_back(true);
+    newValues.insert(newValues.end(), Values.end() - nc, Values.end());
+
+    Altitudes.swap(newAltitudes);
+    isBreak.swap(newIsBreak);
+    isBridge.swap(newIsBridge);
+    Values.swap(newValues);
+    midpoints.swap(newMidpoints);
+  }
+
+  return MaxError <= tolerance;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The slopes of the nodes are estimated by the derivative of the parabola that
+// goes through the node and its neighbours, then limited according to the
+// Fritsch-Butland criterion (zero slope at local extrema, magnitude capped to
+// three times the smallest adjacent secant) which guarantees that the Hermite
+// polynomials are monotone whenever the data is. At the ends of a segment, the
+// one-sided three point formula is used with the same limiter.
+
+void FGAtmosphereProfile::ComputeSlopes(const vector<bool>& isBreak)
+{
+  const size_t nc = LogScale.size();
+  const size_t numNodes = Altitudes.size();
+  vector<double> secants, slopes;
+
+  Slopes.resize(2*(numNodes-1)*nc);
+
+  size_t start = 0;
+  while (start < numNodes-1) {
+    size_t end = start + 1;
+    while (!isBreak[end]) ++end;
+    size_t m = end - start; // Number of intervals in the segment
+
+    for (unsigned int c=0; c<nc; ++c) {
+      secants.resize(m);
+      slopes.resize(m+1);
+
+      for (size_t k=0; k<m; ++k) {
+        size_t i = start + k;
+        secants[k] = (Values[(i+1)*nc+c] - Values[i*nc+c])
+                   / (Altitudes[i+1] - Altitudes[i]);
+      }
+
+      if (m == 1)
+        slopes[0] = slopes[1] = secants[0];
+      else {
+        for (size_t k=1; k<m; ++k) {
+          double s0 = secants[k-1], s1 = secants[k];
+          if (s0*s1 <= 0.0)
+            slopes[k] = 0.0;
+          else {
+            size_t i = start + k;
+            double h0 = Altitudes[i] - Altitudes[i-1];
+            double h1 = Altitudes[i+1] - Altitudes[i];
+            double d = (h1*s0 + h0*s1) / (h0 + h1);
+            double dmax = 3.0*min(fabs(s0), fabs(s1));
+            slopes[k] = fabs(d) > dmax ? copysign(dmax, d) : d;
+          }
+        }
+
+        auto EndSlope = [](double h0, double h1, double s0, double s1) {
+          double d = ((2.0*h0 + h1)*s0 - h0*s1) / (h0 + h1);
+          if (d*s0 <= 0.0) return 0.0;
+          if (fabs(d) > 3.0*fabs(s0)) return 3.0*s0;
+          return d;
+        };
+
+        slopes[0] = EndSlope(Altitudes[start+1] - Altitudes[start],
+                             Altitudes[start+2] - Altitudes[start+1],
+                             secants[0], secants[1]);
+        slopes[m] = EndSlope(Altitudes[end] - Altitudes[end-1],
+                             Altitudes[end-1] - Altitudes[end-2],
+                             secants[m-1], secants[m-2]);
+      }
+
+      for (size_t k=0; k<m; ++k) {
+        size_t i = start + k;
+        Slopes[2*i*nc+c] = slopes[k];
+        Slopes[(2*i+1)*nc+c] = slopes[k+1];
+      }
+    }
+
+    start = end;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphereProfile::Evaluate(size_t i, double h, double* values) const
+{
+  const size_t nc = LogScale.size();
+  double dh = Altitudes[i+1] - Altitudes[i];
+  double t = (h - Altitudes[i]) / dh;
+  double u = 1.0 - t;
+  // Cubic Hermite basis functions
+  double h00 = (1.0 + 2.0*t)*u*u;
+  double h10 = t*u*u*dh;
+  double h01 = t*t*(3.0 - 2.0*t);
+  double h11 = -t*t*u*dh;
+
+  const double* y0 = &Values[i*nc];
+  const double* y1 = y0 + nc;
+  const double* d0 = &Slopes[2*i*nc];
+  const double* d1 = d0 + nc;
+
+  for (unsigned int c=0; c<nc; ++c) {
+    double y = h00*y0[c] + h01*y1[c] + h10*d0[c] + h11*d1[c];
+    values[c] = LogScale[c] ? exp(y) : y;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The altitude varies slowly from one call to the next so the interval found
+// during the previous call, or one of its neighbours, is tried first.
+
+size_t FGAtmosphereProfile::FindInterval(double h) const
+{
+  const size_t last = Altitudes.size() - 2;
+  size_t i = LastInterval;
+
+  if (h >= Altitudes[i]) {
+    if (h <= Altitudes[i+1]) return i;
+    if (i < last && h <= Altitudes[i+2]) return LastInterval = i+1;
+  }
+  else if (i > 0 && h >= Altitudes[i-1])
+    return LastInterval = i-1;
+
+  auto it = upper_bound(Altitudes.begin(), Altitudes.end(), h);
+  i = it == Altitudes.begin() ? 0 : it - Altitudes.begin() - 1;
+  LastInterval = min(i, last);
+  return LastInterval;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGAtmosphereProfile::Interpolate(double h, double* values) const
+{
+  assert(IsBuilt());
+  Evaluate(FindInterval(h), h, values);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+double FGAtmosphereProfile::GetError(double h, const double* reference) const
+{
+  vector<double> interpolated(LogScale.size());
+
+  Interpolate(h, interpolated.data());
+  return RelativeError(interpolated, reference);
+}
+
+} // namespace JSBSim
@@ -0,0 +1,174 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGAtmosphereProfile.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGATMOSPHEREPROFILE_H
+#define FGATMOSPHEREPROFILE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <functional>
+#include <vector>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Altitude profile of atmospheric quantities, tabulated from a reference
+    model.
+
+    The profile stores a number of columns (temperature, pressure, etc.) at a
+    set of altitude nodes and interpolates them with monotone piecewise cubic
+    Hermite polynomials: the node slopes are estimated with three points and
+    limited (Fritsch-Butland) so that the interpolant never overshoots the
+    tabulated data. Columns that span several orders of magnitude (pressure,
+    density) can be interpolated on their logarithm.
+
+    The nodes are placed by Build() which samples the reference model and
+    bisects the intervals until the interpolation at each interval midpoint
+    matches the reference model within a relative tolerance. The altitudes
+    where the reference model has a discontinuous derivative (the boundaries
+    of the layers of the standard atmosphere for instance) can be supplied as
+    breaks: the slopes are then computed on each side independently. The
+    reference model is sampled on both sides of each break, BreakWidth feet
+    apart, so a break can as well be used where the reference model itself
+    jumps.
+
+    @code
+    FGAtmosphereProfile profile({false, true}); // T linear, P logarithmic
+    profile.Build([this](double h, double* v) {
+                    v[0] = GetTemperature(h);
+                    v[1] = GetPressure(h);
+                  }, 0.0, 300000.0, {36151.6, 65823.5}, 1E-6);
+    double values[2];
+    profile.Interpolate(h, values);
+    @endcode
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGAtmosphereProfile {
+public:
+  /** Evaluates the reference model at an altitude.
+      The first argument is the altitude in feet, the second one is the array
+      where the value of each column must be written. */
+  using Sampler = std::function<void(double, double*)>;
+
+  /** Constructor
+      @param logScale specifies, for each column, if it must be interpolated
+                      on its logarithm. The size of the vector sets the
+                      number of columns. */
+  explicit FGAtmosphereProfile(const std::vector<bool>& logScale);
+
+  /** Builds the profile from a reference model.
+      @param reference the reference model
+      @param hmin lower altitude of the profile in feet
+      @param hmax upper altitude of the profile in feet
+      @param breaks altitudes in feet where the reference model or its
+                    derivatives are discontinuous.
+      @param tolerance relative error allowed between the interpolation and
+                       the reference model.
+      @return false if the tolerance could not be met before the maximum
+              number of nodes has been reached. The profile is usable
+              nevertheless. */
+  bool Build(const Sampler& reference, double hmin, double hmax,
+             const std::vector<double>& breaks, double tolerance);
+
+  /// Removes all the nodes of the profile.
+  void Clear(void);
+
+  /// Returns true if the profile has been built.
+  bool IsBuilt(void) const { return !Altitudes.empty(); }
+
+  /// Returns true if the altitude lies within the range of the profile.
+  bool InRange(double h) const
+  { return IsBuilt() && h >= Altitudes.front() && h <= Altitudes.back(); }
+
+  /** Interpolates the columns at an altitude.
+      The altitude must be within the range of the profile.
+      @param h altitude in feet
+      @param values array where the value of each column is written. */
+  void Interpolate(double h, double* values) const;
+
+  /** Returns the largest relative error between the interpolated columns and
+      the supplied reference values.
+      @param h altitude in feet
+      @param reference value of each column at the altitude h. */
+  double GetError(double h, const double* reference) const;
+
+  /// Returns the number of columns.
+  size_t GetNumColumns(void) const { return LogScale.size(); }
+  /// Returns the number of altitude nodes.
+  size_t GetNumNodes(void) const { return Altitudes.size(); }
+  /// Returns the largest relative error found at the interval midpoints.
+  double GetMaxError(void) const { return MaxError; }
+
+  /// Maximum number of nodes that Build() is allowed to create.
+  static constexpr size_t MaxNodes = 65536;
+  /// Intervals narrower than this (in feet) are no longer bisected.
+  static constexpr double MinInterval = 1.0;
+  /** Width in feet of the interval that bridges each break. The profile is
+      linear over this interval. */
+  static constexpr double BreakWidth = 1E-3;
+
+private:
+  std::vector<bool> LogScale;
+  std::vector<double> Altitudes;
+  // Column values at each node, stored node by node.
+  std::vector<double> Values;
+  // Slopes at the lower and upper end of each interval, stored interval by
+  // interval. The slopes are stored per interval so that they can differ on
+  // each side of a break.
+  std::vector<double> Slopes;
+  double MaxError = 0.0;
+  mutable size_t LastInterval = 0;
+
+  void ComputeSlopes(const std::vector<bool>& isBreak);
+  void Evaluate(size_t i, double h, double* values) const;
+  size_t FindInterval(double h) const;
+};
+} // namespace JSBSim
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
@@ -61,6 +61,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGMSIS.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -83,6 +84,13 @@ FGMSIS::FGMSIS(FGFDMExec* fdmex) : FGStandardAtmosphere(fdmex)
   input.ap = 4.;
   input.ap_a = nullptr;
 
+  // NRLMSISE-00 itself is not more accurate than a few percent.
+  constexpr double kmtoft = 1000. / fttom;
+  Cache = FGAtmosphereProfile({false, true, false, false, true});
+  CacheTolerance = 1E-4;
+  CacheMinAltitude = 0.0;
+  CacheMaxAltitude = 1000.0*kmtoft;
+
   Debug(0);
 }
 
@@ -115,6 +123,30 @@ bool FGMSIS::Load(Element* el)
   if (el->FindElement("utc"))
     seconds_in_day = el->FindElementValueAsNumber("utc");
 
+  Element* cache_el = el->FindElement("cache");
+  if (cache_el) {
+    if (cache_el->FindElement("tolerance"))
+      SetCacheTolerance(cache_el->FindElementValueAsNumber("tolerance"));
+
+    double hmin = CacheMinAltitude;
+    double hmax = CacheMaxAltitude;
+    if (cache_el->FindElement("min_altitude"))
+      hmin = cache_el->FindElementValueAsNumberConvertTo("min_altitude", "FT");
+    if (cache_el->FindElement("max_altitude"))
+      hmax = cache_el->FindElementValueAsNumberConvertTo("max_altitude", "FT");
+    SetCacheAltitudeRange(hmin, hmax);
+
+    double interval = CacheCheckInterval;
+    double angle = CacheCheckAngle;
+    if (cache_el->FindElement("check_interval"))
+      interval = cache_el->FindElementValueAsNumber("check_interval");
+    if (cache_el->FindElement("check_angle"))
+      angle = cache_el->FindElementValueAsNumberConvertTo("check_angle", "DEG");
+    SetCacheCheck(interval, angle);
+
+    SetCacheEnabled(true);
+  }
+
   Debug(3);
 
   return true;
@@ -124,6 +156,24 @@ bool FGMSIS::Load(Element* el)
 
 void FGMSIS::Calculate(double altitude)
 {
+  if (CacheEnabled && UpdateCache(altitude)) {
+    double values[5];
+
+    Cache.Interpolate(altitude, values);
+    Temperature = values[0];
+    Density = values[1];
+    Reng = values[2];
+    Viscosity = values[3];
+    // The pressure is interpolated rather than computed from the other
+    // columns which would add up their errors.
+    Pressure = values[4];
+    Soundspeed  = sqrt(SHRatio*Reng*Temperature);
+    PressureAltitude = CalculatePressureAltitude(Pressure, altitude);
+    DensityAltitude = CalculateDensityAltitude(Density, altitude);
+    KinematicViscosity = Viscosity / Density;
+    return;
+  }
+
   double SLRair = 0.0;
 
   Compute(0.0, SLpressure, SLtemperature, SLdensity, SLRair);
@@ -142,8 +192,117 @@ void FGMSIS::Calculate(double altitude)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGMSIS::SetCacheCheck(double interval, double angle)
+{
+  CacheCheckInterval = interval;
+  CacheCheckAngle = angle;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGMSIS::UpdateCache(double altitude)
+{
+  double simTime = FDMExec->GetSimTime();
+  double latitude = in.GeodLatitudeDeg;
+  double longitude = in.LongitudeDeg;
+
+  auto Rebuild = [&]() {
+    CacheSimTime = CheckSimTime = simTime;
+    CacheLatitude = CheckLatitude = latitude;
+    CacheLongitude = CheckLongitude = longitude;
+    BuildCache();
+
+    double SLRair = 0.0;
+    Compute(0.0, SLpressure, SLtemperature, SLdensity, SLRair);
+    SLsoundspeed  = sqrt(SHRatio*SLRair*SLtemperature);
+  };
+
+  if (CacheOutdated || day_of_year != CacheDay || seconds_in_day != CacheUTC
+      || input.f107A != CacheF107A || input.f107 != CacheF107
+      || input.ap != CacheAP)
+    Rebuild();
+  else if (fabs(simTime - CheckSimTime) >= CacheCheckInterval
+           || fabs(latitude - CheckLatitude) >= CacheCheckAngle
+           || fabs(remainder(longitude - CheckLongitude, 360.0)) >= CacheCheckAngle) {
+    // Compare the reference model for the current time and location with the
+    // reference model the profile has been built from. The interpolation error
+    // is not accounted for so that a rebuild is only triggered by the drift of
+    // the model.
+    double current[4], cached[4];
+    double error = 0.0;
+
+    CheckSimTime = simTime;
+    CheckLatitude = latitude;
+    CheckLongitude = longitude;
+
+    for (double h: {altitude, 0.0}) {
+      if (!Cache.InRange(h)) continue;
+      Compute(h, simTime, latitude, longitude, current[3], current[0],
+              current[1], current[2]);
+      Compute(h, CacheSimTime, CacheLatitude, CacheLongitude, cached[3],
+              cached[0], cached[1], cached[2]);
+      for (unsigned int c=0; c<4; ++c)
+        error = max(error, fabs(current[c] - cached[c]) / fabs(cached[c]));
+    }
+
+    if (error > 0.5*CacheTolerance) Rebuild();
+  }
+
+  return Cache.InRange(altitude);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::BuildCache(void)
+{
+  constexpr double kmtoft = 1000. / fttom;
+  // NRLMSISE-00 joins the profiles of the lower atmosphere, of the mesosphere
+  // and of the thermosphere at 32.5, 72.5 and 120 km. The exospheric
+  // temperature is only accounted for above 123.435 km and the corrections of
+  // the species densities are switched off above thresholds between 160 and
+  // 450 km: the model is discontinuous at these altitudes.
+  const vector<double> breaks {32.5*kmtoft, 62.5*kmtoft, 72.5*kmtoft,
+                               120.0*kmtoft, 123.435*kmtoft, 160.0*kmtoft,
+                               200.0*kmtoft, 240.0*kmtoft, 250.0*kmtoft,
+                               300.0*kmtoft, 320.0*kmtoft, 450.0*kmtoft};
+
+  auto reference = [this](double h, double* values) {
+    Compute(h, CacheSimTime, CacheLatitude, CacheLongitude, values[4],
+            values[0], values[1], values[2]);
+    values[3] = Beta * pow(values[0], 1.5) / (SutherlandConstant + values[0]);
+  };
+
+  // Half the tolerance is left for the drift of the reference model (see
+  // UpdateCache) and the profile is only checked at the middle of its
+  // intervals where the interpolation error can be half of its maximum.
+  bool converged = Cache.Build(reference, CacheMinAltitude, CacheMaxAltitude,
+                               breaks, 0.25*CacheTolerance);
+
+  CacheDay = day_of_year;
+  CacheUTC = seconds_in_day;
+  CacheF107A = input.f107A;
+  CacheF107 = input.f107;
+  CacheAP = input.ap;
+  CacheOutdated = false;
+  ++CacheBuilds;
+
+  CheckCacheAccuracy(converged, 0.25*CacheTolerance);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
                     double& density, double &Rair) const
+{
+  Compute(altitude, FDMExec->GetSimTime(), in.GeodLatitudeDeg, in.LongitudeDeg,
+          pressure, temperature, density, Rair);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::Compute(double altitude, double simTime, double latitude,
+                     double longitude, double& pressure, double& temperature,
+                     double& density, double &Rair) const
 {
   constexpr double fttokm = fttom / 1000.;
   constexpr double kgm3_to_slugft3 = kgtoslug / m3toft3;
@@ -155,11 +314,11 @@ void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
 
   double dn[10] {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
   double h = altitude*fttokm;
-  double lat = in.GeodLatitudeDeg;
-  double lon = in.LongitudeDeg;
+  double lat = latitude;
+  double lon = longitude;
 
   // Compute epoch
-  double utc_seconds = seconds_in_day + FDMExec->GetSimTime();
+  double utc_seconds = seconds_in_day + simTime;
   unsigned int days = utc_seconds / 86400.;
   utc_seconds -= days * 86400.;
   double today = day_of_year + days;
@@ -205,6 +364,26 @@ void FGMSIS::Compute(double altitude, double& pressure, double& temperature,
   pressure = density * Rair * temperature;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGMSIS::SerializeState(FGSnapshot& snapshot)
+{
+  FGStandardAtmosphere::SerializeState(snapshot);
+  snapshot(day_of_year, seconds_in_day);
+
+  // The cached profile is rebuilt for the same time and location to resume
+  // with the same interpolated values.
+  bool cacheBuilt = Cache.IsBuilt();
+  snapshot(cacheBuilt, CacheSimTime, CacheLatitude, CacheLongitude,
+           CheckSimTime, CheckLatitude, CheckLongitude);
+  if (snapshot.IsRestoring()) {
+    if (cacheBuilt && CacheEnabled)
+      BuildCache();
+    else
+      CacheOutdated = true;
+  }
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
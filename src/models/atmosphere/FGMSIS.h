@@ -72,6 +72,42 @@ CLASS DOCUMENTATION
     reach him at devel@brodo.de. See the file "DOCUMENTATION" for details,
     and check http://www.brodo.de/english/pub/nrlmsise/index.html for
     updated releases of this package.
+
+    Evaluating NRLMSISE-00 is expensive so the model can optionally be
+    computed from a cached altitude profile (see FGStandardAtmosphere) built
+    for the current day, time, location and solar activity. The profile is
+    rebuilt when the day, the time or the solar activity inputs are modified.
+    Since the model also varies with the time and the location of the
+    aircraft, the reference model for the current time and location is
+    periodically compared, at the current altitude and at sea level, with the
+    reference model the profile has been built from. The profile is rebuilt
+    when they differ by more than half the tolerance, the other half being
+    left to the interpolation error.
+
+    @code
+    <atmosphere model="MSIS">
+      <day> {number} </day>
+      <utc> {number} </utc>
+      <cache>
+        <tolerance> {number} </tolerance>
+        <min_altitude unit="{FT | M | KM}"> {number} </min_altitude>
+        <max_altitude unit="{FT | M | KM}"> {number} </max_altitude>
+        <check_interval> {number} </check_interval>
+        <check_angle unit="{DEG | RAD}"> {number} </check_angle>
+      </cache>
+    </atmosphere>
+    @endcode
+
+    - \b tolerance relative error allowed between the cached profile and the
+      reference model (default 1E-4).
+    - \b min_altitude, \b max_altitude altitude range of the cached profile
+      (default 0 to 1000 km). The reference model is used outside this range.
+    - \b check_interval simulation time in seconds between two checks of the
+      drift of the reference model (default 60 s).
+    - \b check_angle the drift of the reference model is also checked
+      when the latitude or the longitude have changed by more than this
+      angle since the last comparison (default 1 deg).
+
     @author David Culp
 */
 
@@ -98,6 +134,13 @@ public:
 
   bool InitModel(void) override;
   bool Load(Element* el) override;
+  void SerializeState(FGSnapshot& snapshot) override;
+
+  /** Sets how often the cached profile is compared with the reference model.
+      @param interval simulation time in seconds between two comparisons.
+      @param angle change in latitude or longitude, in degrees, that triggers
+                   a comparison. */
+  void SetCacheCheck(double interval, double angle);
 
   using FGAtmosphere::GetTemperature;  // Prevent C++ from hiding GetTemperature(void)
   double GetTemperature(double altitude) const override {
@@ -131,6 +174,12 @@ protected:
   void Calculate(double altitude) override;
   void Compute(double altitude, double& pression, double& temperature,
                 double& density, double &Rair) const;
+  void Compute(double altitude, double simTime, double latitude,
+               double longitude, double& pression, double& temperature,
+               double& density, double &Rair) const;
+
+  bool UpdateCache(double altitude) override;
+  void BuildCache(void) override;
 
   double day_of_year = 1.0;
   double seconds_in_day = 0.0;
@@ -138,7 +187,26 @@ protected:
   mutable struct nrlmsise_flags flags;
   mutable struct nrlmsise_input input;
 
+  /// Simulation time and location for which the cached profile is built.
+  double CacheSimTime = 0.0;
+  double CacheLatitude = 0.0;
+  double CacheLongitude = 0.0;
+  /// Simulation time and location of the last comparison of the cached
+  /// profile with the reference model.
+  double CheckSimTime = 0.0;
+  double CheckLatitude = 0.0;
+  double CheckLongitude = 0.0;
+  double CacheCheckInterval = 60.0;
+  double CacheCheckAngle = 1.0;
+
 private:
+  // Day, time and solar activity for which the cached profile is built.
+  double CacheDay = 0.0;
+  double CacheUTC = 0.0;
+  double CacheF107A = 0.0;
+  double CacheF107 = 0.0;
+  double CacheAP = 0.0;
+
   // Setting temperature & pressure is not allowed in this model.
   void SetTemperature(double t, double h, eTemperature unit) override {};
   void SetTemperatureSL(double t, eTemperature unit) override {};
@@ -50,6 +50,7 @@ INCLUDES
 #include "FGFDMExec.h"
 #include "FGStandardAtmosphere.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -63,7 +64,7 @@ FGStandardAtmosphere::FGStandardAtmosphere(FGFDMExec* fdmex)
   : FGAtmosphere(fdmex), StdSLpressure(StdDaySLpressure), TemperatureBias(0.0),
     TemperatureDeltaGradient(0.0), VaporMassFraction(0.0),
     SaturatedVaporPressure(StdDaySLpressure), StdAtmosTemperatureTable(9),
-    MaxVaporMassFraction(10)
+    MaxVaporMassFraction(10), Cache({false, true, false})
 {
   Name = "FGStandardAtmosphere";
 
@@ -181,11 +182,129 @@ bool FGStandardAtmosphere::InitModel(void)
 
 void FGStandardAtmosphere::Calculate(double altitude)
 {
-  FGAtmosphere::Calculate(altitude);
+  if (!override_node) override_node = atmosphere_node->getNode("override");
+
+  // The cached profile is bypassed when the atmosphere is overridden.
+  if (CacheEnabled && !override_node && UpdateCache(altitude)) {
+    double values[3];
+
+    Cache.Interpolate(altitude, values);
+    Temperature = values[0];
+    Pressure = values[1];
+    Density = Pressure/(Reng*Temperature);
+    Soundspeed = sqrt(SHRatio*Reng*Temperature);
+    PressureAltitude = CalculatePressureAltitude(Pressure, altitude);
+    DensityAltitude = CalculateDensityAltitude(Density, altitude);
+    Viscosity = values[2];
+    KinematicViscosity = Viscosity / Density;
+  }
+  else
+    FGAtmosphere::Calculate(altitude);
+
   SaturatedVaporPressure = CalculateVaporPressure(Temperature);
   ValidateVaporMassFraction(altitude);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The profile only depends on the temperature bias and gradient, and on the
+// sea level pressure. The humidity is accounted for by Calculate() since it
+// varies with the state of the atmosphere.
+
+bool FGStandardAtmosphere::UpdateCache(double altitude)
+{
+  if (CacheOutdated || TemperatureBias != CacheTemperatureBias
+      || TemperatureDeltaGradient != CacheTemperatureDeltaGradient
+      || PressureBreakpoints[0] != CacheSLpressure)
+    BuildCache();
+
+  return Cache.InRange(altitude);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::BuildCache(void)
+{
+  // The temperature is piecewise linear versus the geopotential altitude so
+  // its derivative is discontinuous at the breakpoints of the table.
+  vector<double> breaks;
+  for (unsigned int i=1; i<=StdAtmosTemperatureTable.GetNumRows(); ++i)
+    breaks.push_back(GeometricAltitude(StdAtmosTemperatureTable(i, 0)));
+
+  auto reference = [this](double h, double* values) {
+    double T = ValidateTemperature(GetTemperature(h), "", true);
+    values[0] = T;
+    values[1] = ValidatePressure(GetPressure(h), "", true);
+    values[2] = Beta * pow(T, 1.5) / (SutherlandConstant + T);
+  };
+
+  bool converged = Cache.Build(reference, CacheMinAltitude, CacheMaxAltitude,
+                               breaks, CacheTolerance);
+
+  CacheTemperatureBias = TemperatureBias;
+  CacheTemperatureDeltaGradient = TemperatureDeltaGradient;
+  CacheSLpressure = PressureBreakpoints[0];
+  CacheOutdated = false;
+  ++CacheBuilds;
+
+  CheckCacheAccuracy(converged, CacheTolerance);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::CheckCacheAccuracy(bool converged,
+                                              double tolerance) const
+{
+  if (!converged) {
+    FGLogging log(LogLevel::WARN);
+    log << "The cached atmosphere profile does not meet the tolerance "
+        << tolerance << " with " << Cache.GetNumNodes() << " nodes."
+        << endl << "The largest relative error is " << Cache.GetMaxError()
+        << endl;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SetCacheEnabled(bool enabled)
+{
+  CacheEnabled = enabled;
+  CacheOutdated = true;
+  if (!enabled) Cache.Clear();
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SetCacheTolerance(double tolerance)
+{
+  if (tolerance <= 0.0) {
+    FGLogging log(LogLevel::WARN);
+    log << "The tolerance of the cached atmosphere must be positive." << endl
+        << "The tolerance is left to " << CacheTolerance << endl;
+    return;
+  }
+
+  CacheTolerance = tolerance;
+  CacheOutdated = true;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SetCacheAltitudeRange(double hmin, double hmax)
+{
+  if (hmax <= hmin) {
+    FGLogging log(LogLevel::WARN);
+    log << "The altitude range [" << hmin << ", " << hmax << "] ft of the "
+        << "cached atmosphere is empty." << endl
+        << "The range is left to [" << CacheMinAltitude << ", "
+        << CacheMaxAltitude << "] ft" << endl;
+    return;
+  }
+
+  CacheMinAltitude = hmin;
+  CacheMaxAltitude = hmax;
+  CacheOutdated = true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 // Get the actual pressure as modeled at a specified altitude
 // These calculations are from equations 33a and 33b in the U.S. Standard
@@ -775,6 +894,26 @@ void FGStandardAtmosphere::bind(void)
   PropertyManager->Tie("atmosphere/vapor-fraction-ppm", this,
                        &FGStandardAtmosphere::GetVaporMassFractionPPM,
                        &FGStandardAtmosphere::SetVaporMassFractionPPM);
+  PropertyManager->Tie("atmosphere/cache/enabled", this,
+                       &FGStandardAtmosphere::GetCacheEnabled,
+                       &FGStandardAtmosphere::SetCacheEnabled);
+  PropertyManager->Tie("atmosphere/cache/tolerance", this,
+                       &FGStandardAtmosphere::GetCacheTolerance,
+                       &FGStandardAtmosphere::SetCacheTolerance);
+  PropertyManager->Tie("atmosphere/cache/nodes", this,
+                       &FGStandardAtmosphere::GetCacheNodes);
+  PropertyManager->Tie("atmosphere/cache/builds", this,
+                       &FGStandardAtmosphere::GetCacheBuilds);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGStandardAtmosphere::SerializeState(FGSnapshot& snapshot)
+{
+  FGAtmosphere::SerializeState(snapshot);
+  snapshot(TemperatureBias, TemperatureDeltaGradient, GradientFadeoutAltitude,
+           VaporMassFraction, SaturatedVaporPressure, LapseRates,
+           PressureBreakpoints);
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
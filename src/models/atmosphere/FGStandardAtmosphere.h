@@ -42,6 +42,7 @@ INCLUDES
 
 #include "math/FGTable.h"
 #include "models/FGAtmosphere.h"
+#include "FGAtmosphereProfile.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -83,9 +84,26 @@ these access methods allow the user to modify the sea level standard
 temperature, and/or the sea level standard pressure, so that the entire profile
 will be consistently and accurately calculated.
 
+The atmosphere can optionally be computed from a cached profile instead of
+the equations above. The temperature, pressure and viscosity are then
+tabulated versus altitude when the cache is enabled and interpolated each time
+step. The profile is rebuilt when the temperature bias, the temperature
+gradient or the sea level pressure are modified. The profile is built so that
+the relative error with respect to the equations does not exceed a given
+tolerance; it is bypassed while the atmosphere/override properties are set or
+when the altitude is outside the range of the profile.
+
   <h2> Properties </h2>
   @property atmosphere/delta-T
   @property atmosphere/T-sl-dev-F
+  @property atmosphere/cache/enabled (read/write) Computes the atmosphere from
+            a cached altitude profile when set to 1.
+  @property atmosphere/cache/tolerance (read/write) Relative error allowed
+            between the cached profile and the reference model.
+  @property atmosphere/cache/nodes (read only) Number of altitude nodes in the
+            cached profile.
+  @property atmosphere/cache/builds (read only) Number of times the cached
+            profile has been built.
 
   @author Jon Berndt
   @see "U.S. Standard Atmosphere, 1976", NASA TM-X-74335
@@ -104,6 +122,7 @@ public:
   virtual ~FGStandardAtmosphere();
 
   bool InitModel(void) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
   //  *************************************************************************
   /// @name Temperature access functions.
@@ -281,6 +300,29 @@ public:
   /// Prints the U.S. Standard Atmosphere table.
   virtual void PrintStandardAtmosphereTable();
 
+  //  *************************************************************************
+  /// @name Cached atmosphere access functions.
+  //@{
+  /** Enables or disables the cached atmosphere profile.
+      The profile is built the next time the atmosphere is calculated. */
+  void SetCacheEnabled(bool enabled);
+  /// Returns true if the atmosphere is computed from a cached profile.
+  bool GetCacheEnabled(void) const { return CacheEnabled; }
+  /** Sets the relative error allowed between the cached profile and the
+      reference model. */
+  void SetCacheTolerance(double tolerance);
+  /// Returns the relative error allowed for the cached profile.
+  double GetCacheTolerance(void) const { return CacheTolerance; }
+  /** Sets the altitude range of the cached profile.
+      @param hmin lower altitude in feet
+      @param hmax upper altitude in feet */
+  void SetCacheAltitudeRange(double hmin, double hmax);
+  /// Returns the number of altitude nodes of the cached profile.
+  int GetCacheNodes(void) const { return static_cast<int>(Cache.GetNumNodes()); }
+  /// Returns the number of times the cached profile has been built.
+  int GetCacheBuilds(void) const { return static_cast<int>(CacheBuilds); }
+  //@}
+
 protected:
   /// Standard sea level conditions
   double StdSLtemperature, StdSLdensity, StdSLpressure, StdSLsoundspeed;
@@ -299,8 +341,30 @@ protected:
   std::vector<double> StdDensityBreakpoints;
   std::vector<double> StdLapseRates;
 
+  /// Cached profile of the atmosphere versus altitude.
+  FGAtmosphereProfile Cache;
+  bool CacheEnabled = false;
+  /// Set when the cache parameters are modified to force a rebuild.
+  bool CacheOutdated = true;
+  double CacheTolerance = 1E-6;
+  double CacheMinAltitude = -10000.0;
+  double CacheMaxAltitude = 400000.0;
+  unsigned int CacheBuilds = 0;
+
   void Calculate(double altitude) override;
 
+  /** Builds the cached profile if it is missing or if the inputs it has been
+      built for have changed.
+      @param altitude The altitude at which the atmosphere is calculated.
+      @return true if the cached profile can be used at the altitude. */
+  virtual bool UpdateCache(double altitude);
+
+  /// Builds the cached profile for the current inputs of the model.
+  virtual void BuildCache(void);
+
+  /// Logs a warning when the cached profile does not meet its tolerance.
+  void CheckCacheAccuracy(bool converged, double tolerance) const;
+
   /// Recalculate the lapse rate vectors when the temperature profile is altered
   /// in a way that would change the lapse rates, such as when a gradient is
   /// applied.
@@ -369,6 +433,12 @@ protected:
   static constexpr double Mwater = 18.016 * kgtoslug / 1000.0;
   static constexpr double Rdry = Rstar / Mair;
   static constexpr double Rwater = Rstar / Mwater;
+
+private:
+  // Inputs for which the cached profile has been built.
+  double CacheTemperatureBias = 0.0;
+  double CacheTemperatureDeltaGradient = 0.0;
+  double CacheSLpressure = 0.0;
 };
 
 } // namespace JSBSim
@@ -0,0 +1,239 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Module:       FGTurbulence.cpp
+ Author:       The JSBSim team
+ Date started: 10/16/26
+ Purpose:      Batch generation of Dryden and von Karman turbulence
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+FUNCTIONAL DESCRIPTION
+--------------------------------------------------------------------------------
+Generates the turbulence of several instances at once by filtering counter-based
+white noise with the discretized transfer functions of MIL-HDBK-1797.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <cassert>
+#include <cmath>
+
+#include "FGJSBBase.h"
+#include "FGTurbulence.h"
+#include "input_output/FGSnapshot.h"
+
+using namespace std;
+
+namespace JSBSim {
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS IMPLEMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+// Bilinear transform of the transfer function num(s)/den(s) where s is
+// replaced by c*(1-z^-1)/(1+z^-1). Both polynomials are multiplied by
+// (1+z^-1)^order so the coefficients b and a are those of polynomials of z^-1.
+
+static void Bilinear(const double* num, const double* den, unsigned int order,
+                     double c, double* b, double* a)
+{
+  for (unsigned int n=0; n<=order; ++n)
+    b[n] = a[n] = 0.0;
+
+  double ck = 1.0;
+  for (unsigned int k=0; k<=order; ++k) {
+    // Coefficients of (1-z^-1)^k (1+z^-1)^(order-k)
+    double p[4] {1.0, 0.0, 0.0, 0.0};
+    for (unsigned int j=0; j<order; ++j) {
+      double sign = j < k ? -1.0 : 1.0;
+      for (unsigned int n=j+1; n>0; --n)
+        p[n] += sign*p[n-1];
+    }
+
+    for (unsigned int n=0; n<=order; ++n) {
+      b[n] += num[k]*ck*p[n];
+      a[n] += den[k]*ck*p[n];
+    }
+    ck *= c;
+  }
+
+  const double a0 = a[0];
+  for (unsigned int n=0; n<=order; ++n) {
+    b[n] /= a0;
+    a[n] /= a0;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+FGTurbulence::FGTurbulence(eSpectrum spectrum, unsigned int numInstances,
+                           unsigned int seed, unsigned int stream)
+  : Spectrum(spectrum), NumInstances(numInstances), Key{seed, stream}
+{
+  assert(NumInstances > 0);
+
+  for (auto& state: States)
+    state.assign(MaxOrder*NumInstances, 0.0);
+  Noise.resize(NumChannels*NumInstances);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbulence::Reset(void)
+{
+  for (auto& state: States)
+    state.assign(state.size(), 0.0);
+  Frame = 0;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The transfer functions are those of MIL-HDBK-1797 with the scale lengths of
+// MIL-F-8785C (i.e. the lateral and vertical scale lengths are twice those of
+// MIL-HDBK-1797). Their input is a white noise with a unit one-sided power
+// spectral density: its samples have a variance of pi/dt.
+
+void FGTurbulence::SetParameters(const Scales& scales, double V, double dt)
+{
+  assert(V > 0.0 && dt > 0.0);
+
+  const double c = 2.0/dt;
+  InputGain = sqrt(M_PI/dt);
+
+  for (unsigned int ch=0; ch<NumChannels; ++ch) {
+    Filter& f = Filters[ch];
+    const double L = scales.L[ch];
+    const double T = L/V;
+    double num[MaxOrder+1] {}, den[MaxOrder+1] {};
+    double gain;
+
+    if (ch == 0 || ch == 3) { // u and p
+      gain = scales.sigma[ch]*sqrt(2.0*L/(M_PI*V));
+      num[0] = den[0] = 1.0;
+      if (Spectrum == esVonKarman && ch == 0) {
+        f.order = 2;
+        num[1] = 0.25*T;
+        den[1] = 1.357*T;
+        den[2] = 0.1987*T*T;
+      }
+      else {
+        f.order = 1;
+        den[1] = T;
+      }
+    }
+    else { // v and w
+      gain = scales.sigma[ch]*sqrt(L/(M_PI*V));
+      num[0] = den[0] = 1.0;
+      if (Spectrum == esVonKarman) {
+        f.order = 3;
+        num[1] = 2.7478*T;
+        num[2] = 0.3398*T*T;
+        den[1] = 2.9958*T;
+        den[2] = 1.9754*T*T;
+        den[3] = 0.1539*T*T*T;
+      }
+      else {
+        f.order = 2;
+        num[1] = sqrt(3.0)*T;
+        den[1] = 2.0*T;
+        den[2] = T*T;
+      }
+    }
+
+    Bilinear(num, den, f.order, c, f.b, f.a);
+    for (unsigned int n=0; n<=f.order; ++n)
+      f.b[n] *= gain*InputGain;
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Each Philox block provides two uniform numbers that the Box-Muller transform
+// turns into two normal numbers, so two blocks per instance and per frame feed
+// the four channels.
+
+void FGTurbulence::GenerateNoise(double* noise)
+{
+  const uint32_t low = static_cast<uint32_t>(Frame);
+  const uint32_t high = static_cast<uint32_t>(Frame >> 32);
+
+  for (unsigned int pair=0; pair<2; ++pair) {
+    double* n0 = noise + 2*pair*NumInstances;
+    double* n1 = n0 + NumInstances;
+
+    for (unsigned int i=0; i<NumInstances; ++i) {
+      auto r = CounterRandomNumberGenerator::Philox({low, high, pair, 0},
+                                                    {Key[0], Key[1]+i});
+      CounterRandomNumberGenerator::BoxMuller(r, n0[i], n1[i]);
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbulence::Generate(unsigned int numFrames, double* output)
+{
+  const unsigned int n = NumInstances;
+
+  for (unsigned int k=0; k<numFrames; ++k, ++Frame) {
+    GenerateNoise(Noise.data());
+
+    for (unsigned int ch=0; ch<NumChannels; ++ch) {
+      const Filter& f = Filters[ch];
+      const double* x = &Noise[ch*n];
+      double* y = output + (k*NumChannels + ch)*n;
+      double* s = States[ch].data();
+
+      for (unsigned int i=0; i<n; ++i)
+        y[i] = f.b[0]*x[i] + s[i];
+
+      for (unsigned int j=0; j<f.order; ++j) {
+        double* sj = s + j*n;
+        const double bj = f.b[j+1], aj = f.a[j+1];
+        if (j+1 < f.order) {
+          const double* sj1 = sj + n;
+          for (unsigned int i=0; i<n; ++i)
+            sj[i] = bj*x[i] - aj*y[i] + sj1[i];
+        }
+        else {
+          for (unsigned int i=0; i<n; ++i)
+            sj[i] = bj*x[i] - aj*y[i];
+        }
+      }
+    }
+  }
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbulence::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot.Check(NumInstances, "the number of turbulence instances");
+  snapshot(Frame, InputGain);
+  for (auto& f: Filters)
+    snapshot(f.order, f.b, f.a);
+  for (auto& state: States)
+    snapshot(state);
+}
+
+} // namespace JSBSim
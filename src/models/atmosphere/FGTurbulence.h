@@ -0,0 +1,169 @@
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+ Header:       FGTurbulence.h
+ Author:       The JSBSim team
+ Date started: 10/16/26
+
+ ------------- Copyright (C) 2026 The JSBSim team -------------
+
+ This program is free software; you can redistribute it and/or modify it under
+ the terms of the GNU Lesser General Public License as published by the Free
+ Software Foundation; either version 2 of the License, or (at your option) any
+ later version.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ details.
+
+ You should have received a copy of the GNU Lesser General Public License along
+ with this program; if not, write to the Free Software Foundation, Inc.,
+ 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+ Further information about the GNU Lesser General Public License can also be
+ found on the world wide web at http://www.gnu.org.
+
+HISTORY
+--------------------------------------------------------------------------------
+10/16/26         Created
+
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+SENTRY
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#ifndef FGTURBULENCE_H
+#define FGTURBULENCE_H
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+INCLUDES
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "JSBSim_API.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+FORWARD DECLARATIONS
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+namespace JSBSim {
+
+class FGSnapshot;
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DOCUMENTATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/** Batch generator of Dryden and von Karman turbulence.
+
+    The generator computes the linear velocities (u, v, w) and the roll rate
+    (p) of the turbulence for a number of independent instances (aircraft,
+    Monte Carlo runs, etc.) at once. Each channel is obtained by filtering
+    white noise with the transfer function of the spectrum given by
+    MIL-HDBK-1797 (the rational approximations are used for the von Karman
+    spectrum). The transfer functions are discretized with the bilinear
+    (Tustin) transform.
+
+    The data is laid out by channel and by instance so that the random number
+    generation and the filter recurrences are vectorized across the
+    instances. The white noise is computed by the Philox counter-based
+    function (see CounterRandomNumberGenerator) from the seed, the instance
+    number and the frame number: the turbulence of an instance does not depend
+    on the number of instances generated together.
+
+    The generator works either in time (the step is a time step and the
+    airspeed is the true airspeed) or in distance (the step is a distance and
+    the airspeed is set to 1): the latter generates a turbulence field frozen
+    in space that is then sampled along the flight path (Taylor's
+    hypothesis).
+
+    @code
+    FGTurbulence turbulence(FGTurbulence::esVonKarman, 16, seed);
+    FGTurbulence::Scales scales {{2500., 2500., 2500., 300.}, {10., 10., 10., 0.01}};
+    turbulence.SetParameters(scales, 500.0, 1./120.);
+    std::vector<double> output(100*FGTurbulence::NumChannels*16);
+    turbulence.Generate(100, output.data());
+    @endcode
+
+    @see MIL-HDBK-1797: Flying Qualities of Piloted Aircraft, 1997
+*/
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+CLASS DECLARATION
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+class JSBSIM_API FGTurbulence {
+public:
+  enum eSpectrum {esDryden, esVonKarman};
+
+  /// Number of channels: u, v, w (ft/s) and p (rad/s), in that order.
+  static constexpr unsigned int NumChannels = 4;
+
+  /// Scale lengths and intensities of the channels.
+  struct Scales {
+    double L[NumChannels];     ///< Scale lengths in ft
+    double sigma[NumChannels]; ///< Intensities (ft/s or rad/s)
+  };
+
+  /** Constructor
+      @param spectrum the spectrum of the linear velocities
+      @param numInstances number of instances generated together
+      @param seed seed of the random numbers
+      @param stream number of the random stream of the first instance. The
+                    instance i uses the stream number stream+i. */
+  FGTurbulence(eSpectrum spectrum, unsigned int numInstances,
+               unsigned int seed, unsigned int stream=0);
+
+  /** Computes the filters coefficients.
+      @param scales scale lengths and intensities
+      @param V airspeed in ft/s (1 to generate a field along a distance)
+      @param dt step in seconds (or in ft to generate a field) */
+  void SetParameters(const Scales& scales, double V, double dt);
+
+  /** Generates the next frames of turbulence.
+      @param numFrames number of frames to generate
+      @param output array of numFrames*NumChannels*numInstances values where
+                    the value of the channel c of the instance i at the frame
+                    k is written at the index (k*NumChannels+c)*numInstances+i
+  */
+  void Generate(unsigned int numFrames, double* output);
+
+  /// Resets the filters and the frame counter.
+  void Reset(void);
+
+  /// Returns the number of frames generated since the last reset.
+  uint64_t GetFrame(void) const { return Frame; }
+  eSpectrum GetSpectrum(void) const { return Spectrum; }
+  unsigned int GetNumInstances(void) const { return NumInstances; }
+  unsigned int GetSeed(void) const { return Key[0]; }
+
+  void SerializeState(FGSnapshot& snapshot);
+
+private:
+  static constexpr unsigned int MaxOrder = 3;
+
+  struct Filter {
+    unsigned int order = 0;
+    double b[MaxOrder+1] {};
+    double a[MaxOrder+1] {};
+  };
+
+  eSpectrum Spectrum;
+  unsigned int NumInstances;
+  std::array<uint32_t, 2> Key;
+  uint64_t Frame = 0;
+  double InputGain = 0.0;
+  Filter Filters[NumChannels];
+  // States of the filters (transposed direct form II), stored by channel, by
+  // order and by instance.
+  std::vector<double> States[NumChannels];
+  std::vector<double> Noise;
+
+  void GenerateNoise(double* noise);
+};
+} // namespace JSBSim
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#endif
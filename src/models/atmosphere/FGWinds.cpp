@@ -43,10 +43,14 @@ COMMENTS, REFERENCES,  and NOTES
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <algorithm>
+
 #include "FGWinds.h"
+#include "FGTurbulence.h"
 #include "FGFDMExec.h"
 #include "math/FGTable.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -72,8 +76,11 @@ static inline double square_signed (double value)
 /// simply square a value
 constexpr double sqr(double x) { return x*x; }
 
+// Name of the random number stream used by the turbulence models.
+static const string TurbulenceStream = "atmosphere/turbulence";
+
 FGWinds::FGWinds(FGFDMExec* fdmex)
-  : FGModel(fdmex), generator(fdmex->GetRandomGenerator())
+  : FGModel(fdmex)
 {
   Name = "FGWinds";
 
@@ -93,6 +100,8 @@ FGWinds::FGWinds(FGFDMExec* fdmex)
   // Milspec turbulence model
   windspeed_at_20ft = 0.;
   probability_of_exceedence_index = 0;
+  FrozenField = false;
+  TurbDistance = FieldStart = FieldStep = 0.0;
   POE_Table = new FGTable(7,12);
   // this is Figure 7 from p. 49 of MIL-F-8785C
   // rows: probability of exceedance curve index, cols: altitude in ft
@@ -124,6 +133,9 @@ bool FGWinds::InitModel(void)
 {
   if (!FGModel::InitModel()) return false;
 
+  // Counter-based random numbers may have been enabled since the construction.
+  if (!RandomSeed) generator.reset();
+
   psiw = 0.0;
 
   vGustNED.InitMatrix();
@@ -139,6 +151,10 @@ bool FGWinds::InitModel(void)
   xi_p_km1 = nu_p_km1 = 0;
   xi_q_km1 = xi_r_km1 = 0;
 
+  TurbEngine.reset();
+  TurbField.clear();
+  TurbDistance = 0.0;
+
   return true;
 }
 
@@ -224,7 +240,7 @@ void FGWinds::Turbulence(double h)
 
     double random = 0.0;
     if (target_time == 0.0) {
-      strength = random = generator->GetUniformRandomNumber();
+      strength = random = GetGenerator().GetUniformRandomNumber();
       target_time = time + 0.71 + (random * 0.5);
     }
     if (time > target_time) {
@@ -255,7 +271,8 @@ void FGWinds::Turbulence(double h)
     break;
   }
   case ttMilspec:
-  case ttTustin: {
+  case ttTustin:
+  case ttVonKarman: {
 
     // an index of zero means turbulence is disabled
     // airspeed occurs as divisor in the code below
@@ -267,6 +284,8 @@ void FGWinds::Turbulence(double h)
 
     // Turbulence model according to MIL-F-8785C (Flying Qualities of Piloted Aircraft)
     double b_w = in.wingspan, L_u, L_w, sig_u, sig_w;
+    // MIL-F-8785c, Sec. 3.7.2.1, p. 48
+    double L_high = turbType == ttVonKarman ? 2500. : 1750.;
 
       if (b_w == 0.) b_w = 30.;
 
@@ -281,11 +300,11 @@ void FGWinds::Turbulence(double h)
       sig_u = sig_w/pow(0.177 + 0.000823*h, 0.4); // MIL-F-8785c, Fig. 11, p. 56
     } else if (h <= 2000) {
       // linear interpolation between low altitude and high altitude models
-      L_u = L_w = 1000 + (h-1000.)/1000.*750.;
+      L_u = L_w = 1000 + (h-1000.)/1000.*(L_high-1000.);
       sig_u = sig_w = 0.1*windspeed_at_20ft
                     + (h-1000.)/1000.*(POE_Table->GetValue(probability_of_exceedence_index, h) - 0.1*windspeed_at_20ft);
     } else {
-      L_u = L_w = 1750.; //  MIL-F-8785c, Sec. 3.7.2.1, p. 48
+      L_u = L_w = L_high;
       sig_u = sig_w = POE_Table->GetValue(probability_of_exceedence_index, h);
     }
 
@@ -300,12 +319,17 @@ void FGWinds::Turbulence(double h)
       tau_p = L_p/in.V, // eq. (9)
       tau_q = 4*b_w/M_PI/in.V, // eq. (13)
       tau_r =3*b_w/M_PI/in.V, // eq. (17)
-      nu_u = generator->GetNormalRandomNumber(),
-      nu_v = generator->GetNormalRandomNumber(),
-      nu_w = generator->GetNormalRandomNumber(),
-      nu_p = generator->GetNormalRandomNumber(),
+      nu_u=0, nu_v=0, nu_w=0, nu_p=0,
       xi_u=0, xi_v=0, xi_w=0, xi_p=0, xi_q=0, xi_r=0;
 
+    // the von Karman model draws its own random numbers
+    if (turbType != ttVonKarman) {
+      nu_u = GetGenerator().GetNormalRandomNumber();
+      nu_v = GetGenerator().GetNormalRandomNumber();
+      nu_w = GetGenerator().GetNormalRandomNumber();
+      nu_p = GetGenerator().GetNormalRandomNumber();
+    }
+
     // values of turbulence NED velocities
 
     if (turbType == ttTustin) {
@@ -352,6 +376,13 @@ void FGWinds::Turbulence(double h)
       xi_p = (1 - T_V/tau_p)  *xi_p_km1 + sig_p*sqrt(2*T_V/tau_p)*nu_p;  // eq. (33)
       xi_q = (1 - T_V/tau_q)  *xi_q_km1 + M_PI/4/b_w*(xi_w - xi_w_km1);  // eq. (34)
       xi_r = (1 - T_V/tau_r)  *xi_r_km1 + M_PI/3/b_w*(xi_v - xi_v_km1);  // eq. (35)
+    } else if (turbType == ttVonKarman) {
+      double L[] {L_u, L_u, L_w, L_p}, sigma[] {sig_u, sig_u, sig_w, sig_p};
+      double xi[FGTurbulence::NumChannels];
+      VonKarmanTurbulence(L, sigma, xi);
+      xi_u = xi[0]; xi_v = xi[1]; xi_w = xi[2]; xi_p = xi[3];
+      xi_q = (1 - T_V/tau_q)  *xi_q_km1 + M_PI/4/b_w*(xi_w - xi_w_km1);  // eq. (34)
+      xi_r = (1 - T_V/tau_r)  *xi_r_km1 + M_PI/3/b_w*(xi_v - xi_v_km1);  // eq. (35)
     }
 
     // rotate by wind azimuth and assign the velocities
@@ -384,6 +415,65 @@ void FGWinds::Turbulence(double h)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Computes the linear velocities and the roll rate of the von Karman
+// turbulence. In a frozen field, the turbulence is generated along a distance
+// by chunks of FieldSize samples and interpolated at the distance flown. The
+// scale lengths and intensities of a chunk are those at the time it is
+// generated.
+
+void FGWinds::VonKarmanTurbulence(const double L[4], const double sigma[4],
+                                  double xi[4])
+{
+  constexpr unsigned int n = FGTurbulence::NumChannels;
+  constexpr unsigned int FieldSize = 256;
+  const unsigned int seed = GetRandomSeed();
+
+  if (!TurbEngine || TurbEngine->GetSeed() != seed) {
+    TurbEngine = make_unique<FGTurbulence>(FGTurbulence::esVonKarman, 1, seed,
+                                           FGFDMExec::GetStreamNumber(TurbulenceStream));
+    TurbField.clear();
+  }
+
+  FGTurbulence::Scales scales;
+  for (unsigned int i=0; i<n; ++i) {
+    scales.L[i] = L[i];
+    scales.sigma[i] = sigma[i];
+  }
+
+  if (!FrozenField) {
+    TurbEngine->SetParameters(scales, in.V, in.totalDeltaT);
+    TurbEngine->Generate(1, xi);
+    return;
+  }
+
+  TurbDistance += in.V*in.totalDeltaT;
+
+  // The samples are spaced by a fraction of the smallest scale length.
+  if (TurbField.empty()) {
+    FieldStart = TurbDistance;
+    FieldStep = *min_element(L, L+n)/8.;
+    TurbField.resize((FieldSize+1)*n);
+    TurbEngine->SetParameters(scales, 1.0, FieldStep);
+    TurbEngine->Generate(FieldSize+1, TurbField.data());
+  }
+
+  // The last sample of a chunk becomes the first sample of the next one.
+  while (TurbDistance > FieldStart + FieldSize*FieldStep) {
+    FieldStart += FieldSize*FieldStep;
+    copy(TurbField.end()-n, TurbField.end(), TurbField.begin());
+    FieldStep = *min_element(L, L+n)/8.;
+    TurbEngine->SetParameters(scales, 1.0, FieldStep);
+    TurbEngine->Generate(FieldSize, &TurbField[n]);
+  }
+
+  double x = (TurbDistance - FieldStart)/FieldStep;
+  unsigned int k = min(static_cast<unsigned int>(x), FieldSize-1);
+  double f = x - k;
+  for (unsigned int i=0; i<n; ++i)
+    xi[i] = (1.0-f)*TurbField[k*n+i] + f*TurbField[(k+1)*n+i];
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGWinds::CosineGustProfile(double startDuration, double steadyDuration, double endDuration, double elapsedTime)
@@ -492,9 +582,27 @@ void FGWinds::UpDownBurst()
 void FGWinds::SetRandomSeed(int sr)
 {
   RandomSeed = sr;
-  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed);
+  generator.reset();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The generator is requested when it is first needed since the counter-based
+// random numbers can be enabled after the winds model has been built.
+
+RandomNumberGeneratorBase& FGWinds::GetGenerator(void)
+{
+  if (!generator) {
+    if (RandomSeed)
+      generator = FDMExec->GetRandomGenerator(TurbulenceStream, *RandomSeed);
+    else
+      generator = FDMExec->GetRandomGenerator(TurbulenceStream);
+  }
+
+  return *generator;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 int  FGWinds::GetRandomSeed(void) const {
   if (RandomSeed)
     return *RandomSeed;
@@ -580,6 +688,7 @@ void FGWinds::bind(void)
   PropertyManager->Tie("atmosphere/turbulence/milspec/severity",
                        this, &FGWinds::GetProbabilityOfExceedence,
                              &FGWinds::SetProbabilityOfExceedence);
+  PropertyManager->Tie("atmosphere/turbulence/frozen-field", &FrozenField);
 
   // Total, calculated winds (local navigational/geographic frame: N-E-D). Read only.
   PropertyManager->Tie("atmosphere/total-wind-north-fps", this, eNorth, &FGWinds::GetTotalWindNED);
@@ -590,6 +699,73 @@ void FGWinds::bind(void)
   PropertyManager->Tie("atmosphere/randomseed", this, &FGWinds::GetRandomSeed, &FGWinds::SetRandomSeed);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGWinds::SerializeState(FGSnapshot& snapshot)
+{
+  auto profile = [&snapshot](OneMinusCosineProfile& p) {
+    snapshot(p.Running, p.elapsedTime, p.startupDuration, p.steadyDuration,
+             p.endDuration);
+  };
+
+  FGModel::SerializeState(snapshot);
+
+  snapshot(turbType, MagnitudedAccelDt, MagnitudeAccel, Magnitude,
+           TurbDirection, TurbGain, TurbRate, Rhythmicity, wind_from_clockwise,
+           spike, target_time, strength, vTurbulenceGrad, vBodyTurbGrad,
+           vTurbPQR, windspeed_at_20ft, probability_of_exceedence_index);
+  snapshot(xi_u_km1, nu_u_km1, xi_v_km1, xi_v_km2, nu_v_km1, nu_v_km2,
+           xi_w_km1, xi_w_km2, nu_w_km1, nu_w_km2, xi_p_km1, nu_p_km1,
+           xi_q_km1, xi_r_km1);
+  snapshot(psiw, vTotalWindNED, vWindNED, vGustNED, vCosineGust, vBurstGust,
+           vTurbulenceNED);
+
+  snapshot(oneMinusCosineGust.vWind, oneMinusCosineGust.vWindTransformed,
+           oneMinusCosineGust.magnitude, oneMinusCosineGust.gustFrame);
+  profile(oneMinusCosineGust.gustProfile);
+
+  size_t numCells = UpDownBurstCells.size();
+  snapshot(numCells);
+  if (snapshot.IsRestoring() && numCells != UpDownBurstCells.size())
+    NumberOfUpDownburstCells(static_cast<int>(numCells));
+  for (auto cell: UpDownBurstCells) {
+    snapshot(cell->ringLatitude, cell->ringLongitude, cell->ringAltitude,
+             cell->ringRadius, cell->ringCoreRadius, cell->circulation);
+    profile(cell->oneMCosineProfile);
+  }
+
+  // The random number generator is only saved when it is specific to the
+  // winds. Otherwise it is shared with FGFDMExec which saves it.
+  bool hasSeed = RandomSeed.has_value();
+  unsigned int seed = RandomSeed.value_or(0);
+  snapshot(hasSeed, seed);
+  if (snapshot.IsRestoring() && (hasSeed != RandomSeed.has_value()
+                                 || seed != RandomSeed.value_or(0))) {
+    if (hasSeed)
+      SetRandomSeed(seed);
+    else {
+      RandomSeed.reset();
+      generator.reset();
+    }
+  }
+  if (&GetGenerator() != FDMExec->GetRandomGenerator().get())
+    snapshot(*generator);
+
+  bool hasEngine = TurbEngine != nullptr;
+  unsigned int engineSeed = hasEngine ? TurbEngine->GetSeed() : 0;
+  snapshot(FrozenField, TurbDistance, FieldStart, FieldStep, TurbField,
+           hasEngine, engineSeed);
+  if (snapshot.IsRestoring()) {
+    if (!hasEngine)
+      TurbEngine.reset();
+    else if (!TurbEngine || TurbEngine->GetSeed() != engineSeed)
+      TurbEngine = make_unique<FGTurbulence>(FGTurbulence::esVonKarman, 1,
+                                             engineSeed,
+                                             FGFDMExec::GetStreamNumber(TurbulenceStream));
+  }
+  if (TurbEngine) TurbEngine->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
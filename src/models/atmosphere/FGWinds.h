@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGModel.h"
 #include "math/FGMatrix33.h"
 #include <optional>
+#include <memory>
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 FORWARD DECLARATIONS
@@ -49,6 +50,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGTable;
+class FGTurbulence;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -65,6 +67,7 @@ CLASS DOCUMENTATION
     - 2: ttCulp
     - 3: ttMilspec (Dryden spectrum)
     - 4: ttTustin (Dryden spectrum)
+    - 5: ttVonKarman (von Karman spectrum)
 
     The Milspec and Tustin models are described in the Yeager report cited
     below.  They both use a Dryden spectrum model whose parameters (scale
@@ -75,6 +78,15 @@ CLASS DOCUMENTATION
     The two models differ in the implementation of the transfer functions
     described in the milspec.
 
+    The VonKarman model uses the von Karman spectrum of MIL-HDBK-1797 (with
+    the rational approximations of its transfer functions) and the same
+    parameters, except that the scale lengths above 2000ft are 2500ft. Its
+    linear velocities and roll rate are computed by FGTurbulence. When the
+    property <tt>atmosphere/turbulence/frozen-field</tt> is set to 1, the
+    turbulence is a field frozen in space that is generated ahead of the
+    aircraft and sampled along its flight path: the turbulence then depends on
+    the distance flown rather than on the time elapsed.
+
     To use one of these two models, set <tt>atmosphere/turb-type</tt> to 4
     resp. 5, and specify values for
     <tt>atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps</tt> and
@@ -179,8 +191,9 @@ public:
                      on a socket for the "Resume" command to be given.
       @return false if no error */
   bool Run(bool Holding) override;
+  void SerializeState(FGSnapshot& snapshot) override;
   bool InitModel(void) override;
-  enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin} turbType;
+  enum tType {ttNone, ttStandard, ttCulp, ttMilspec, ttTustin, ttVonKarman} turbType;
 
   // TOTAL WIND access functions (wind + gust + turbulence)
 
@@ -246,7 +259,7 @@ public:
   virtual const FGColumnVector3& GetGustNED(void) const {return vGustNED;}
 
   /** Turbulence models available: ttNone, ttStandard, ttBerndt, ttCulp,
-      ttMilspec, ttTustin */
+      ttMilspec, ttTustin, ttVonKarman */
   virtual void   SetTurbType(tType tt) {turbType = tt;}
   virtual tType  GetTurbType() const {return turbType;}
 
@@ -395,6 +408,14 @@ private:
   double xi_p_km1, nu_p_km1;
   double xi_q_km1, xi_r_km1;
 
+  // von Karman turbulence model
+  std::unique_ptr<FGTurbulence> TurbEngine;
+  bool FrozenField;
+  double TurbDistance; ///< distance flown in ft
+  double FieldStart; ///< distance of the first sample of TurbField in ft
+  double FieldStep; ///< distance between the samples of TurbField in ft
+  std::vector<double> TurbField;
+
   double psiw;
   FGColumnVector3 vTotalWindNED;
   FGColumnVector3 vWindNED;
@@ -404,12 +425,15 @@ private:
   FGColumnVector3 vTurbulenceNED;
 
   std::optional<unsigned int> RandomSeed;
-  std::shared_ptr<RandomNumberGenerator> generator;
+  std::shared_ptr<RandomNumberGeneratorBase> generator;
 
   void SetRandomSeed(int sr);
   int  GetRandomSeed(void) const;
+  RandomNumberGeneratorBase& GetGenerator(void);
 
   void Turbulence(double h);
+  void VonKarmanTurbulence(const double L[4], const double sigma[4],
+                           double xi[4]);
   void UpDownBurst();
 
   void CosineGust();
@@ -42,6 +42,7 @@ INCLUDES
 #include "math/FGParameterValue.h"
 #include "models/FGFCS.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -132,6 +133,16 @@ FGActuator::~FGActuator()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGActuator::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(bias, lagVal, ca, cb, PreviousOutput, PreviousHystOutput,
+           PreviousRateLimOutput, PreviousLagInput, PreviousLagOutput,
+           fail_zero, fail_hardover, fail_stuck, initialized, saturated);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGActuator::ResetPastStates(void)
 {
   FGFCSComponent::ResetPastStates();
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -207,6 +208,13 @@ FGFCSComponent::~FGFCSComponent()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFCSComponent::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(Input, Output, output_array, index);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFCSComponent::ResetPastStates(void)
 {
   index = 0;
@@ -48,6 +48,7 @@ namespace JSBSim {
 
 class FGFCS;
 class Element;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -96,6 +97,9 @@ public:
   std::string GetType(void) const { return Type; }
   virtual double GetOutputPct(void) const { return 0; }
   virtual void ResetPastStates(void);
+  /** Saves or restores the internal state of the component.
+      @see FGSnapshot */
+  virtual void SerializeState(FGSnapshot& snapshot);
 
 protected:
   FGFCS* fcs;
@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -83,6 +84,15 @@ FGFilter::~FGFilter()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGFilter::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(Initialize, ca, cb, cc, cd, ce, PreviousInput1, PreviousInput2,
+           PreviousOutput1, PreviousOutput2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGFilter::ResetPastStates(void)
 {
   FGFCSComponent::ResetPastStates();
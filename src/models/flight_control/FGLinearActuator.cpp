@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -160,6 +161,15 @@ FGLinearActuator::~FGLinearActuator()
 
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGLinearActuator::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(set, reset, direction, countSpin, versus, bias, inputLast, inputMem,
+           previousLagInput, previousLagOutput);
+}
+
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGLinearActuator::Run(void )
 {
   if (ptrSet && !ptrSet->IsConstant()) set = ptrSet->GetValue() >= 0.5;
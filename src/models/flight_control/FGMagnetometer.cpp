@@ -41,6 +41,7 @@ INCLUDES
 #include "simgear/magvar/coremag.hxx"
 #include "models/FGFCS.h"
 #include "models/FGMassBalance.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -102,6 +103,14 @@ FGMagnetometer::~FGMagnetometer()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGMagnetometer::SerializeState(FGSnapshot& snapshot)
+{
+  FGSensor::SerializeState(snapshot);
+  snapshot(vMag, field, usedLat, usedLon, usedAlt, date, counter);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGMagnetometer::ResetPastStates(void)
 {
   FGSensor::ResetPastStates();
@@ -39,6 +39,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "math/FGParameterValue.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -142,6 +143,14 @@ FGPID::~FGPID()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGPID::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(I_out_total, Input_prev, Input_prev2);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGPID::ResetPastStates(void)
 {
   FGFCSComponent::ResetPastStates();
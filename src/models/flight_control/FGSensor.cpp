@@ -41,6 +41,7 @@ INCLUDES
 #include "models/FGFCS.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -52,7 +53,8 @@ CLASS IMPLEMENTATION
 
 
 FGSensor::FGSensor(FGFCS* fcs, Element* element)
-  : FGFCSComponent(fcs, element), generator(fcs->GetExec()->GetRandomGenerator())
+  : FGFCSComponent(fcs, element),
+    generator(fcs->GetExec()->GetRandomGenerator("fcs/" + Name))
 {
   // inputs are read from the base class constructor
 
@@ -134,6 +136,17 @@ FGSensor::~FGSensor()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSensor::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(bias, gain, drift_rate, drift, noise_variance, PreviousOutput,
+           PreviousInput, fail_low, fail_high, fail_stuck);
+  // A generator which is not specific to the sensor is saved by FGFDMExec.
+  if (generator != fcs->GetExec()->GetRandomGenerator()) snapshot(*generator);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 void FGSensor::ResetPastStates(void)
 {
   FGFCSComponent::ResetPastStates();
@@ -289,7 +302,7 @@ void FGSensor::bind(Element* el, FGPropertyManager* PropertyManager)
 void FGSensor::SetNoiseRandomSeed(int sr)
 {
   RandomSeed = sr;
-  generator = std::make_shared<RandomNumberGenerator>(*RandomSeed);
+  generator = fcs->GetExec()->GetRandomGenerator("fcs/" + Name, *RandomSeed);
 }
 
 int FGSensor::GetNoiseRandomSeed(void) const
@@ -150,6 +150,7 @@ public:
 
   bool Run (void) override;
   void ResetPastStates(void) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
 protected:
   enum eNoiseType {ePercent=0, eAbsolute} NoiseType;
@@ -188,7 +189,7 @@ protected:
 
 private:
   std::optional<unsigned int> RandomSeed;
-  std::shared_ptr<RandomNumberGenerator> generator;
+  std::shared_ptr<RandomNumberGeneratorBase> generator;
   void Debug(int from) override;
 };
 }
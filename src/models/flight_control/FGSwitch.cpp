@@ -66,6 +66,7 @@ INCLUDES
 #include "math/FGCondition.h"
 #include "input_output/FGLog.h"
 #include "math/FGRealValue.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -135,6 +136,14 @@ FGSwitch::~FGSwitch()
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+void FGSwitch::SerializeState(FGSnapshot& snapshot)
+{
+  FGFCSComponent::SerializeState(snapshot);
+  snapshot(initialized);
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 bool FGSwitch::Run(void )
 {
   bool pass = false;
@@ -142,6 +142,7 @@ public:
   /** Executes the switch logic.
       @return true - always*/
   bool Run(void) override;
+  void SerializeState(FGSnapshot& snapshot) override;
 
 private:
 
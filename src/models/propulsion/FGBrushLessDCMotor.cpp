@@ -53,6 +53,7 @@ INCLUDES
 #include "FGBrushLessDCMotor.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -180,6 +181,14 @@ string FGBrushLessDCMotor::GetEngineValues(const string& delimiter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGBrushLessDCMotor::SerializeState(FGSnapshot& snapshot)
+{
+  FGEngine::SerializeState(snapshot);
+  snapshot(HP, Current);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 //    The bitmasked value choices are as follows:
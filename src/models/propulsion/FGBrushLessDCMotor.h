@@ -87,6 +87,7 @@ public:
   ~FGBrushLessDCMotor();
 
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void) { return 0.; }
   std::string GetEngineLabels(const std::string& delimiter);
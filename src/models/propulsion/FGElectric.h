@@ -73,6 +73,7 @@ public:
   ~FGElectric();
 
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double getRPM(void) {return RPM;}
   std::string GetEngineLabels(const std::string& delimiter);
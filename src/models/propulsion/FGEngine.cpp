@@ -38,11 +38,14 @@ HISTORY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <limits>
+
 #include "FGEngine.h"
 #include "FGPropeller.h"
 #include "FGNozzle.h"
 #include "FGRotor.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -61,6 +64,9 @@ FGEngine::FGEngine(int engine_number, struct Inputs& input)
   MaxThrottle = 1.0;
   MinThrottle = 0.0;
   FuelDensity = 6.02;
+  SolvingSteadyState = false;
+  SteadyStateIterations = 0;
+  SteadyStateSolved = false;
   Debug(0);
 }
 
@@ -100,6 +106,205 @@ double FGEngine::CalcFuelNeed(void)
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
+bool FGEngine::GetSteadyState(void)
+{
+  SteadyStateIterations = 0;
+  SteadyStateSolved = CalcSteadyState();
+
+  if (!SteadyStateSolved) {
+    // Time marching until the thrust has settled.
+    double currentThrust = 0.0, lastThrust;
+    int steady_count = 0, j = 0;
+
+    while (steady_count <= 120 && j < 6000) {
+      Calculate();
+      lastThrust = currentThrust;
+      currentThrust = GetThrust();
+      if (fabs(lastThrust-currentThrust) < 0.0001)
+        steady_count++;
+      else
+        steady_count = 0;
+      j++;
+    }
+    SteadyStateIterations += j;
+  }
+
+  return SteadyStateSolved;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+bool FGEngine::CalcPropellerSteadyState(void)
+{
+  if (Thruster->GetType() != FGThruster::ttPropeller) return false;
+
+  auto prop = static_cast<FGPropeller*>(Thruster);
+
+  // The propeller controls (advance, feathering and reverse) are updated from
+  // the engine inputs by a first calculation.
+  Calculate();
+  SteadyStateIterations++;
+
+  // Feathering and reversing a constant speed propeller changes its pitch by a
+  // fixed amount at each calculation, regardless of the time step.
+  bool governed = prop->IsVPitch() && prop->GetConstantSpeed() != 0;
+  if (governed && (prop->GetFeather() || prop->GetReverse())) return false;
+
+  FGSnapshot state;
+  SerializeState(state);
+
+  // Restores the state saved above but keeps counting the iterations.
+  auto restoreState = [&]() {
+    int iterations = SteadyStateIterations;
+    FGSnapshot restore(state.GetData());
+    SerializeState(restore);
+    SteadyStateIterations = iterations;
+  };
+
+  // Torque accelerating the propeller when it rotates at the given RPMs and
+  // pitch. Each evaluation starts from the state saved above.
+  auto excessTorque = [&](double rpm, double pitch) {
+    restoreState();
+    prop->SetRPM(rpm);
+    prop->SetPitch(pitch);
+    Calculate();
+    SteadyStateIterations++;
+    return prop->GetExcessTorque();
+  };
+
+  double rpm = prop->GetRPM();
+  double pitch = prop->GetPitch();
+
+  // Expands an interval from rpm0 until the excess torque changes sign then
+  // refines the RPMs at which it vanishes.
+  auto solveRPM = [&](double rpm0, double torque0) {
+    double a = rpm0, fa = torque0, b = a, fb = fa;
+    for (int i=0; i < 30 && fa*fb > 0.0; i++) {
+      a = b;
+      fa = fb;
+      b = fa > 0.0 ? 1.5*a : a/1.5;
+      fb = excessTorque(b, pitch);
+    }
+    if (fa*fb > 0.0) return false;
+
+    return FindRoot([&](double x) { return excessTorque(x, pitch); },
+                    a, fa, b, fb, 1E-9*max(a, b), rpm);
+  };
+
+  bool solved = false;
+
+  if (governed) {
+    double rpmReq = prop->GetGovernedRPM();
+    // The governor does not move the pitch below 200 RPMs.
+    if (rpmReq <= 200.0) return false;
+
+    double minPitch = prop->GetMinPitch();
+    double maxPitch = prop->GetMaxPitch();
+    double torqueMin = excessTorque(rpmReq, minPitch);
+    double torqueMax = excessTorque(rpmReq, maxPitch);
+
+    if (torqueMin*torqueMax <= 0.0) {
+      // The governor holds the RPMs by adjusting the pitch.
+      rpm = rpmReq;
+      solved = FindRoot([&](double x) { return excessTorque(rpmReq, x); },
+                        minPitch, torqueMin, maxPitch, torqueMax,
+                        1E-9*(maxPitch-minPitch), pitch);
+    } else if (torqueMax > 0.0) {
+      // The pitch is on its high stop and the propeller overspeeds.
+      pitch = maxPitch;
+      solved = solveRPM(rpmReq, torqueMax);
+    } else {
+      // The pitch is on its low stop and the propeller underspeeds.
+      pitch = minPitch;
+      solved = solveRPM(rpmReq, torqueMin);
+    }
+  } else {
+    double rpm0 = max(rpm, 10.0);
+    solved = solveRPM(rpm0, excessTorque(rpm0, pitch));
+  }
+
+  restoreState();
+  if (!solved) return false;
+
+  // The equilibrium is checked with the criterion of the time marching
+  // algorithm as the excess torque is discontinuous when the engine stops.
+  prop->SetRPM(rpm);
+  prop->SetPitch(pitch);
+  Calculate();
+  double thrust = GetThrust();
+  Calculate();
+  SteadyStateIterations += 2;
+
+  return fabs(GetThrust() - thrust) < 0.0001;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// Brent's method as described in Numerical Recipes: inverse quadratic
+// interpolation or secant steps are taken when they fall within the interval
+// that brackets the root, bisection steps otherwise.
+
+bool FGEngine::FindRoot(const std::function<double(double)>& f, double a,
+                        double fa, double b, double fb, double tol,
+                        double& root)
+{
+  const double eps = std::numeric_limits<double>::epsilon();
+  double c = b, fc = fb, d = b - a, e = d;
+
+  for (int i=0; i < 100; i++) {
+    if (fb*fc > 0.0) {
+      c = a;
+      fc = fa;
+      e = d = b - a;
+    }
+    if (fabs(fc) < fabs(fb)) {
+      a = b; b = c; c = a;
+      fa = fb; fb = fc; fc = fa;
+    }
+
+    double tol1 = 2.0*eps*fabs(b) + 0.5*tol;
+    double xm = 0.5*(c - b);
+
+    if (fabs(xm) <= tol1 || fb == 0.0) {
+      root = b;
+      return true;
+    }
+
+    if (fabs(e) >= tol1 && fabs(fa) > fabs(fb)) {
+      double s = fb/fa, p, q;
+      if (a == c) { // Secant
+        p = 2.0*xm*s;
+        q = 1.0 - s;
+      } else { // Inverse quadratic interpolation
+        double r = fb/fc;
+        q = fa/fc;
+        p = s*(2.0*xm*q*(q - r) - (b - a)*(r - 1.0));
+        q = (q - 1.0)*(r - 1.0)*(s - 1.0);
+      }
+      if (p > 0.0) q = -q;
+      p = fabs(p);
+      if (2.0*p < min(3.0*xm*q - fabs(tol1*q), fabs(e*q))) {
+        e = d;
+        d = p/q;
+      } else { // Bisection
+        d = xm;
+        e = d;
+      }
+    } else { // Bisection
+      d = xm;
+      e = d;
+    }
+
+    a = b;
+    fa = fb;
+    b += fabs(d) > tol1 ? d : (xm > 0.0 ? tol1 : -tol1);
+    fb = f(b);
+  }
+
+  return false;
+}
+
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
 unsigned int FGEngine::GetSourceTank(unsigned int i) const
 {
   if (i < SourceTanks.size()) {
@@ -242,6 +447,10 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetFuelFlowRateGPH);
   property_name = base_property_name + "/fuel-used-lbs";
   PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetFuelUsedLbs);
+  property_name = base_property_name + "/steady-state-iterations";
+  PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetSteadyStateIterations);
+  property_name = base_property_name + "/steady-state-solved";
+  PropertyManager->Tie( property_name.c_str(), this, &FGEngine::GetSteadyStateSolved);
 
   PostLoad(engine_element, exec, to_string((int)EngineNumber));
 
@@ -250,6 +459,17 @@ bool FGEngine::Load(FGFDMExec *exec, Element *engine_element)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGEngine::SerializeState(FGSnapshot& snapshot)
+{
+  FGModelFunctions::SerializeState(snapshot);
+  snapshot(FuelExpended, FuelFlowRate, PctPower, Starter, Starved, Running,
+           Cranking, FuelFreeze, FuelFlow_gph, FuelFlow_pph, FuelUsedLbs,
+           FuelDensity, SteadyStateIterations, SteadyStateSolved);
+  Thruster->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -43,6 +43,7 @@ SENTRY
 INCLUDES
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+#include <functional>
 #include <vector>
 #include <string>
 
@@ -170,6 +171,24 @@ public:
   /** Calculates the thrust of the engine, and other engine functions. */
   virtual void Calculate(void) = 0;
 
+  /** Brings the engine to its steady state for the current flight conditions
+      and engine controls. The engines that are able to do so solve their
+      equilibrium directly (see CalcSteadyState()), the other engines are time
+      marched until their thrust settles. The time step must have been set to
+      a non zero value beforehand (see FGPropulsion::GetSteadyState()).
+      @return true if the steady state has been solved directly. */
+  bool GetSteadyState(void);
+
+  /// Returns the number of calculations made by the last steady state search.
+  int GetSteadyStateIterations(void) const { return SteadyStateIterations; }
+  /** Returns true if the last steady state has been solved directly, false if
+      the engine has been time marched. */
+  bool GetSteadyStateSolved(void) const { return SteadyStateSolved; }
+
+  /** Saves or restores the state of the engine and of its thruster.
+      @see FGSnapshot */
+  void SerializeState(FGSnapshot& snapshot) override;
+
   virtual double GetThrust(void) const;
     
   /** The fuel need is calculated based on power levels and flow rate for that
@@ -215,6 +234,10 @@ protected:
   bool  Cranking;
   bool  FuelFreeze;
 
+  bool SolvingSteadyState;
+  int SteadyStateIterations;
+  bool SteadyStateSolved;
+
   double FuelFlow_gph;
   double FuelFlow_pph;
   double FuelUsedLbs;
@@ -225,6 +248,34 @@ protected:
   std::vector <int> SourceTanks;
 
   bool Load(FGFDMExec *exec, Element *el);
+
+  /** Solves the steady state of the engine. The flag SolvingSteadyState is
+      raised while the solution is searched for and each call to Calculate()
+      is counted in SteadyStateIterations.
+      @return false if the steady state cannot be solved in the current state
+              of the engine, which is then time marched. */
+  virtual bool CalcSteadyState(void) { return false; }
+
+  /** Solves the propeller RPM at which the power of the engine balances the
+      power absorbed by the propeller. For a constant speed propeller, the
+      pitch is solved instead at the RPM selected by the governor unless the
+      pitch reaches one of its stops.
+      @return false if the thruster is not a propeller or if no equilibrium
+              has been found. */
+  bool CalcPropellerSteadyState(void);
+
+  /** Finds a root of a function with Brent's method.
+      @param f the function
+      @param a, fa one end of an interval and the value of f at this point
+      @param b, fb the other end of the interval and the value of f there. The
+                   values fa and fb must have opposite signs.
+      @param tol the tolerance on the root
+      @param root the root that has been found
+      @return false if the method did not converge. */
+  static bool FindRoot(const std::function<double(double)>& f, double a,
+                       double fa, double b, double fb, double tol,
+                       double& root);
+
   void Debug(int from);
 };
 }
@@ -43,6 +43,7 @@ moments due to the difference between the point of application and the cg.
 #include "FGFDMExec.h"
 #include "models/FGAuxiliary.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -157,6 +158,13 @@ void FGForce::SetAnglesToBody(double broll, double bpitch, double byaw)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGForce::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(vFn, vMn, vOrient, ttype, vXYZn, vActingXYZn, mT, vFb, vM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
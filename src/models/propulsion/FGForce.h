@@ -68,6 +68,7 @@ FORWARD DECLARATIONS
 namespace JSBSim {
 
 class FGFDMExec;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -231,6 +232,10 @@ public:
 
   virtual const FGColumnVector3& GetBodyForces(void);
 
+  /** Saves or restores the forces, the moments and the orientation.
+      @see FGSnapshot */
+  virtual void SerializeState(FGSnapshot& snapshot);
+
   inline double GetBodyXForce(void) const { return vFb(eX); }
   inline double GetBodyYForce(void) const { return vFb(eY); }
   inline double GetBodyZForce(void) const { return vFb(eZ); }
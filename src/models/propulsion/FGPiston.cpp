@@ -47,6 +47,7 @@ INCLUDES
 #include "FGPiston.h"
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -531,6 +532,21 @@ void FGPiston::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The power of the engine only depends on the RPMs once the manifold pressure
+// has settled, so the steady state is the RPMs at which the engine drives the
+// propeller without accelerating it. The temperatures of the engine do not
+// affect its power and are not brought to their steady state.
+
+bool FGPiston::CalcSteadyState(void)
+{
+  SolvingSteadyState = true;
+  bool solved = CalcPropellerSteadyState();
+  SolvingSteadyState = false;
+
+  return solved;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGPiston::CalcFuelNeed(void)
@@ -663,7 +679,8 @@ void FGPiston::doMAP(void)
 
   // Add a variable lag to manifold pressure changes
   double dMAP=(TMAP - p_ram * map_coefficient);
-  if (ManifoldPressureLag > in.TotalDeltaT) dMAP *= in.TotalDeltaT/ManifoldPressureLag;
+  if (ManifoldPressureLag > in.TotalDeltaT && !SolvingSteadyState)
+    dMAP *= in.TotalDeltaT/ManifoldPressureLag;
 
   TMAP -=dMAP;
 
@@ -1001,6 +1018,21 @@ string FGPiston::GetEngineValues(const string& delimiter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPiston::SerializeState(FGSnapshot& snapshot)
+{
+  FGEngine::SerializeState(snapshot);
+  snapshot(crank_counter, IndicatedHorsePower, PMEP, FMEP, FMEPDynamic,
+           FMEPStatic, BoostSpeed, MAP, TMAP, p_amb, p_ram, T_amb, RPM, IAS,
+           Magneto_Left, Magneto_Right, Magnetos, rho_air,
+           volumetric_efficiency, volumetric_efficiency_reduced, m_dot_air,
+           v_dot_air, equivalence_ratio, m_dot_fuel, HP, BoostLossHP,
+           combustion_efficiency, ExhaustGasTemp_degK, EGT_degC,
+           ManifoldPressure_inHg, CylinderHeadTemp_degK, OilPressure_psi,
+           OilTemp_degK, MeanPistonSpeed_fps);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 //    The bitmasked value choices are as follows:
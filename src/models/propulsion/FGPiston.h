@@ -232,6 +232,7 @@ public:
   std::string GetEngineValues(const std::string& delimiter);
 
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
   double GetPowerAvailable(void) const {return (HP * hptoftlbssec);}
   double CalcFuelNeed(void);
 
@@ -252,6 +253,8 @@ public:
 protected:
 
 private:
+  bool CalcSteadyState(void) override;
+
   int crank_counter = 0;
 
   double IndicatedHorsePower = 0.0;
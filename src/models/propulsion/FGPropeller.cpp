@@ -39,6 +39,7 @@ INCLUDES
 #include "FGPropeller.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -322,8 +323,7 @@ double FGPropeller::GetPowerRequired(void)
       if (!Feathered) {
         if (!Reversed) {
 
-          double rpmReq = MinRPM + (MaxRPM - MinRPM) * Advance;
-          double dRPM = rpmReq - RPM;
+          double dRPM = GetGovernedRPM() - RPM;
           // The pitch of a variable propeller cannot be changed when the RPMs are
           // too low - the oil pump does not work.
           if (RPM > 200) Pitch -= dRPM * in.TotalDeltaT;
@@ -419,6 +419,15 @@ string FGPropeller::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGPropeller::SerializeState(FGSnapshot& snapshot)
+{
+  FGThruster::SerializeState(snapshot);
+  snapshot(J, RPM, Pitch, Advance, ExcessTorque, HelicalTipMach, Vinduced,
+           vTorque, Reverse_coef, Reversed, Feathered);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -240,6 +240,15 @@ public:
   /// Retrieves the propeller moment of inertia
   double GetIxx(void) const       { return Ixx;           }
 
+  /// Retrieves the minimum pitch of the propeller in degrees.
+  double GetMinPitch(void) const  { return MinPitch;      }
+
+  /// Retrieves the maximum pitch of the propeller in degrees.
+  double GetMaxPitch(void) const  { return MaxPitch;      }
+
+  /// Retrieves the RPMs selected by the governor of a constant speed propeller
+  double GetGovernedRPM(void) const { return MinRPM + (MaxRPM - MinRPM) * Advance; }
+
   /// Retrieves the coefficient of thrust multiplier
   double GetCtFactor(void) const  { return CtFactor;      }
 
@@ -262,6 +271,11 @@ public:
   /// Retrieves the Torque in foot-pounds (Don't you love the English system?)
   double GetTorque(void) const  { return vTorque(eX); }
 
+  /** Retrieves the torque in foot-pounds that accelerates the propeller, i.e.
+      the difference between the torque of the engine and the torque absorbed
+      by the propeller. It is null when the RPMs are steady. */
+  double GetExcessTorque(void) const { return ExcessTorque; }
+
   /** Retrieves the power required (or "absorbed") by the propeller -
       i.e. the power required to keep spinning the propeller at the current
       velocity, air density,  and rotational rate. */
@@ -277,6 +291,7 @@ public:
       would be slowed.
       @return the thrust in pounds */
   double Calculate(double EnginePower);
+  void SerializeState(FGSnapshot& snapshot) override;
   /// Retrieves the P-Factor constant
   FGColumnVector3 GetPFactor(void) const;
   /// Generate the labels for the thruster standard CSV output
@@ -42,6 +42,7 @@ INCLUDES
 #include "FGRocket.h"
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -212,6 +213,23 @@ void FGRocket::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The thrust of a rocket is given directly by the propellant flow or by the
+// thrust table so, once the thrust of a solid rocket has built up, the steady
+// state is reached in a single calculation.
+
+bool FGRocket::CalcSteadyState(void)
+{
+  if (ThrustTable != 0L && (in.ThrottlePos[EngineNumber] == 1 || BurnTime > 0.0)
+      && !Starved)
+    BurnTime = max(BurnTime, BuildupTime);
+
+  Calculate();
+  SteadyStateIterations++;
+
+  return true;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //
 // The FuelFlowRate can be affected by the TotalIspVariation value (settable
@@ -312,6 +330,17 @@ void FGRocket::bindmodel(FGPropertyManager* PropertyManager)
   }
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRocket::SerializeState(FGSnapshot& snapshot)
+{
+  FGEngine::SerializeState(snapshot);
+  snapshot(Isp, It, ItVac, ThrustVariation, TotalIspVariation, VacThrust,
+           previousFuelNeedPerTank, previousOxiNeedPerTank, OxidizerExpended,
+           TotalPropellantExpended, OxidizerFlowRate, PropellantFlowRate,
+           Flameout);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -136,6 +136,7 @@ public:
 
   /** Determines the thrust.*/
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
 
   /** The fuel need is calculated based on power levels and flow rate for that
       power level. It is also turned from a rate into an actual amount (pounds)
@@ -208,6 +209,7 @@ private:
   double GetVacThrust(void) const {return VacThrust;}
 
   void bindmodel(FGPropertyManager* pm);
+  bool CalcSteadyState(void) override;
 
   double Isp; // Vacuum Isp
   double It;    // Total actual Isp
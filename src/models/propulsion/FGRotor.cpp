@@ -49,6 +49,7 @@ INCLUDES
 #include "input_output/FGXMLElement.h"
 #include "input_output/string_utilities.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using std::string;
 using std::ostringstream;
@@ -816,6 +817,18 @@ string FGRotor::GetThrusterValues(int id, const string& delimeter)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGRotor::SerializeState(FGSnapshot& snapshot)
+{
+  FGThruster::SerializeState(snapshot);
+  snapshot(rho, damp_hagl, RPM, Omega, beta_orient, a0, a_1, b_1, a_dw, a1s,
+           b1s, H_drag, J_side, Torque, C_T, lambda, mu, nu, v_induced,
+           theta_downwash, phi_downwash, CollectiveCtrl, LateralCtrl,
+           LongitudinalCtrl, EngineRPM);
+  if (Transmission) Transmission->SerializeState(snapshot);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -252,6 +252,7 @@ public:
 
   /// Returns the scalar thrust of the rotor, and adjusts the RPM value.
   double Calculate(double EnginePower);
+  void SerializeState(FGSnapshot& snapshot) override;
 
 
   /// Retrieves the RPMs of the rotor.
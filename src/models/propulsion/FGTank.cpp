@@ -39,6 +39,7 @@ INCLUDES
 #include "FGTank.h"
 #include "FGFDMExec.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -59,6 +60,8 @@ FGTank::FGTank(FGFDMExec* exec, Element* el, int tank_number)
   Density = 6.6;
   InitialTemperature = Temperature = -9999.0;
   Ixx = Iyy = Izz = 0.0;
+  LastContents = 0.0;
+  MassRevision = 0;
   InertiaFactor = 1.0;
   Radius = Contents = Standpipe = Length = InnerRadius = 0.0;
   ExternalFlow = 0.0;
@@ -378,6 +381,7 @@ double FGTank::Calculate(double dt, double TAT_C)
 
 void FGTank::CalculateInertias(void)
 {
+  double lastIxx = Ixx, lastIyy = Iyy, lastIzz = Izz;
   double Mass = Contents*lbtoslug;
   double RadSumSqr;
   double Rad2 = Radius*Radius;
@@ -426,6 +430,12 @@ void FGTank::CalculateInertias(void)
     if (Radius > 0.0) Ixx = Iyy = Izz = Mass * InertiaFactor * 0.4 * Radius * Radius / 144.0;
 
   }
+
+  if (Contents != LastContents || Ixx != lastIxx || Iyy != lastIyy
+      || Izz != lastIzz) {
+    LastContents = Contents;
+    MassRevision++;
+  }
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -504,6 +514,16 @@ void FGTank::bind(FGPropertyManager* PropertyManager)
 
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTank::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(vXYZ, Radius, InnerRadius, Length, Volume, Density, Ixx, Iyy, Izz,
+           InertiaFactor, PctFull, Contents, Area, Temperature, Standpipe,
+           ExternalFlow, Selected, Priority, LastContents,
+           MassRevision);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
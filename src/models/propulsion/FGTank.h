@@ -57,6 +57,7 @@ class Element;
 class FGPropertyManager;
 class FGFDMExec;
 class FGFunction;
+class FGSnapshot;
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
@@ -232,6 +233,10 @@ public:
   */
   double Calculate(double dt, double TempC);
 
+  /** Saves or restores the contents of the tank.
+      @see FGSnapshot */
+  void SerializeState(FGSnapshot& snapshot);
+
   /** Retrieves the type of tank: Fuel or Oxidizer.
       @return the tank type, 0 for undefined, 1 for fuel, and 2 for oxidizer.
   */
@@ -306,9 +311,13 @@ public:
   inline double GetLocationX(void) const { return vXYZ(eX); }
   inline double GetLocationY(void) const { return vXYZ(eY); }
   inline double GetLocationZ(void) const { return vXYZ(eZ); }
-  inline void SetLocationX(double x) { vXYZ(eX) = x; }
-  inline void SetLocationY(double y) { vXYZ(eY) = y; }
-  inline void SetLocationZ(double z) { vXYZ(eZ) = z; }
+  inline void SetLocationX(double x) { vXYZ(eX) = x; MassRevision++; }
+  inline void SetLocationY(double y) { vXYZ(eY) = y; MassRevision++; }
+  inline void SetLocationZ(double z) { vXYZ(eZ) = z; MassRevision++; }
+
+  /** Returns a counter that is incremented each time the contents, the
+      location or the inertias of the tank are modified. */
+  unsigned int GetMassRevision(void) const {return MassRevision;}
 
   double GetStandpipe(void) const {return Standpipe;}
 
@@ -356,6 +365,8 @@ private:
   double Length;
   double Volume;
   double Density;
+  double LastContents;
+  unsigned int MassRevision;
   double Ixx;
   double Iyy;
   double Izz;
@@ -40,6 +40,7 @@ INCLUDES
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/FGLog.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -169,6 +170,14 @@ string FGThruster::GetThrusterValues(int id, const string& delimeter)
   return buf.str();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGThruster::SerializeState(FGSnapshot& snapshot)
+{
+  FGForce::SerializeState(snapshot);
+  snapshot(Thrust, PowerRequired, ThrustCoeff, ReverserAngle);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
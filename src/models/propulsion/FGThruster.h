@@ -105,6 +105,7 @@ public:
   virtual std::string GetThrusterValues(int id, const std::string& delimeter);
 
   virtual void ResetToIC(void);
+  void SerializeState(FGSnapshot& snapshot) override;
 
   struct Inputs {
     double TotalDeltaT;
@@ -41,6 +41,7 @@ INCLUDES
 
 
 #include "FGTransmission.h"
+#include "input_output/FGSnapshot.h"
 
 using std::string;
 
@@ -153,6 +154,14 @@ bool FGTransmission::BindModel(int num, FGPropertyManager* PropertyManager)
   return true;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTransmission::SerializeState(FGSnapshot& snapshot)
+{
+  snapshot(FreeWheelLag, FreeWheelTransmission, ClutchCtrlNorm, BrakeCtrlNorm,
+           EngineRPM, ThrusterRPM);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -53,6 +53,8 @@ FORWARD DECLARATIONS
 
 namespace JSBSim {
 
+class FGSnapshot;
+
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 CLASS DOCUMENTATION
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
@@ -119,6 +121,9 @@ public:
 
   void Calculate(double EnginePower, double ThrusterTorque, double dt);
 
+  /// Saves or restores the state of the transmission.
+  void SerializeState(FGSnapshot& snapshot);
+
   void   SetMaxBrakePower(double x) {MaxBrakePower=x;}
   double GetMaxBrakePower() const {return MaxBrakePower;}
   void   SetEngineFriction(double x) {EngineFriction=x;}
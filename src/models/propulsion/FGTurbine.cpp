@@ -49,6 +49,7 @@ INCLUDES
 #include "FGThruster.h"
 #include "input_output/FGXMLElement.h"
 #include "input_output/string_utilities.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -170,6 +171,41 @@ void FGTurbine::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// The spool speeds and the other lagged variables are driven by Seek() towards
+// targets that do not depend on them, so they reach their steady state within a
+// single calculation. The iterations settle the phase transitions (trim to run,
+// start to run) and the functions that depend on the spool speeds. When the
+// turbine drives a propeller, its RPMs are then solved. The water injection is
+// timed and is left to the time marching algorithm.
+
+bool FGTurbine::CalcSteadyState(void)
+{
+  if ((Injected == 1) && Injection) return false;
+
+  bool propeller = Thruster->GetType() == FGThruster::ttPropeller;
+  double lastThrust = -1.0;
+  bool steady = false;
+
+  SolvingSteadyState = true;
+
+  for (int i=0; i < 10 && !steady; i++) {
+    phaseType lastPhase = phase;
+    Calculate();
+    SteadyStateIterations++;
+    double thrust = GetThrust();
+    steady = (phase == lastPhase)
+             && (propeller || fabs(thrust - lastThrust) < 0.0001);
+    lastThrust = thrust;
+  }
+
+  if (steady && propeller) steady = CalcPropellerSteadyState();
+
+  SolvingSteadyState = false;
+
+  return steady;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurbine::Off(void)
@@ -401,6 +437,9 @@ double FGTurbine::GetPowerAvailable(void) const {
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurbine::Seek(double *var, double target, double accel, double decel) {
+  // The lagged variables have reached their targets in a steady state.
+  if (SolvingSteadyState) return target;
+
   double v = *var;
   if (v > target) {
     v -= in.TotalDeltaT * decel;
@@ -620,6 +659,18 @@ int FGTurbine::InitRunning(void)
   return phase=tpRun;
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurbine::SerializeState(FGSnapshot& snapshot)
+{
+  FGEngine::SerializeState(snapshot);
+  snapshot(phase, N1, N2, N2norm, ThrottlePos, AugmentCmd, Stalled, Seized,
+           Overtemp, Fire, Injection, Augmentation, Reversed, Cutoff,
+           disableWindmill, Ignition, EGT_degC, EPR, OilPressure_psi,
+           OilTemp_degK, BleedDemand, InletPosition, NozzlePosition,
+           correctedTSFC, InjectionTimer, InjWaterNorm);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
@@ -182,6 +182,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpStall, tpSeize, tpTrim };
 
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
   double CalcFuelNeed(void);
   double GetPowerAvailable(void) const;
   /** A lag filter.
@@ -189,7 +190,9 @@ public:
       @param var a pointer to a variable of type double
       @param target the desired (target) value
       @param accel the rate, per second, the value may increase
-      @param decel the rate, per second, the value may decrease    */
+      @param decel the rate, per second, the value may decrease
+      @return the new value of the variable, which is the target itself while
+              the steady state of the engine is solved. */
   double Seek(double* var, double target, double accel, double decel);
 
   phaseType GetPhase(void) { return phase; }
@@ -242,6 +245,8 @@ public:
 
 private:
 
+  bool CalcSteadyState(void) override;
+
   phaseType phase;         ///< Operating mode, or "phase"
   double MilThrust;        ///< Maximum Unaugmented Thrust, static @ S.L. (lbf)
   double MaxThrust;        ///< Maximum Augmented Thrust, static @ S.L. (lbf)
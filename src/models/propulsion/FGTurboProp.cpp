@@ -50,6 +50,7 @@ INCLUDES
 #include "FGRotor.h"
 #include "math/FGFunction.h"
 #include "input_output/FGXMLElement.h"
+#include "input_output/FGSnapshot.h"
 
 using namespace std;
 
@@ -285,6 +286,36 @@ void FGTurboProp::Calculate(void)
   RunPostFunctions();
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+// N1 and the other lagged variables reach their targets within a calculation
+// while the steady state is solved, so the first calculations only settle the
+// phase of the engine. The propeller RPMs are then solved. The starting
+// sequence and the IELU torque limiter are timed so the engine is left to the
+// time marching algorithm when it is starting or when the limiter intervenes at
+// the equilibrium.
+
+bool FGTurboProp::CalcSteadyState(void)
+{
+  bool solved = false;
+  phaseType lastPhase;
+
+  SolvingSteadyState = true;
+
+  int i = 0;
+  do {
+    lastPhase = phase;
+    Calculate();
+    SteadyStateIterations++;
+  } while (phase != lastPhase && ++i < 3);
+
+  if (phase == tpRun || phase == tpOff)
+    solved = CalcPropellerSteadyState() && !Ielu_intervent;
+
+  SolvingSteadyState = false;
+
+  return solved;
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 double FGTurboProp::Off(void)
@@ -434,6 +465,9 @@ double FGTurboProp::CalcFuelNeed(void)
 
 double FGTurboProp::Seek(double *var, double target, double accel, double decel)
 {
+  // The lagged variables have reached their targets in a steady state.
+  if (SolvingSteadyState) return target;
+
   double v = *var;
   if (v > target) {
     v -= in.TotalDeltaT * decel;
@@ -450,6 +484,8 @@ double FGTurboProp::Seek(double *var, double target, double accel, double decel)
 double FGTurboProp::ExpSeek(double *var, double target, double accel_tau, double decel_tau)
 {
 // exponential delay instead of the linear delay used in Seek
+  if (SolvingSteadyState) return target;
+
   double v = *var;
   if (v > target) {
     v = (v - target) * exp ( -in.TotalDeltaT / decel_tau) + target;
@@ -549,6 +585,17 @@ void FGTurboProp::bindmodel(FGPropertyManager* PropertyManager)
   PropertyManager->Tie( property_name.c_str(), &CombustionEfficiency);
 }
 
+//%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+void FGTurboProp::SerializeState(FGSnapshot& snapshot)
+{
+  FGEngine::SerializeState(snapshot);
+  snapshot(phase, N1, ThrottlePos, Reversed, Cutoff, OilPressure_psi,
+           OilTemp_degK, Ielu_intervent, OldThrottle, StartTime, RPM,
+           CombustionEfficiency, HP, Eng_ITT_degC, Eng_Temperature,
+           EngStarting, GeneratorPower, Condition);
+}
+
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 //    The bitmasked value choices are as follows:
 //    unset: In this case (the default) JSBSim would only print
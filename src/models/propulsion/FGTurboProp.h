@@ -101,6 +101,7 @@ public:
   enum phaseType { tpOff, tpRun, tpSpinUp, tpStart, tpTrim };
 
   void Calculate(void);
+  void SerializeState(FGSnapshot& snapshot) override;
   double CalcFuelNeed(void);
 
   double GetPowerAvailable(void) const { return (HP * hptoftlbssec); }
@@ -138,6 +139,8 @@ public:
 
 private:
 
+  bool CalcSteadyState(void) override;
+
   phaseType phase;         ///< Operating mode, or "phase"
   double IdleN1;           ///< Idle N1
   double N1;               ///< N1
@@ -763,6 +763,7 @@ SGPropertyNode::clearValue ()
     }
     _tied = false;
     _type = props::NONE;
+    ++_binding_version;
 }
 
 
@@ -858,6 +859,7 @@ SGPropertyNode::SGPropertyNode ()
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _binding_version(0),
     _listeners(nullptr)
 {
   _local_val.string_val = 0;
@@ -876,6 +878,7 @@ SGPropertyNode::SGPropertyNode (const SGPropertyNode &node)
     _type(node._type),
     _tied(node._tied),
     _attr(node._attr),
+    _binding_version(0),
     _listeners(nullptr)	// CHECK!!
 {
   _local_val.string_val = 0;
@@ -931,6 +934,7 @@ SGPropertyNode::SGPropertyNode (Itr begin, Itr end,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _binding_version(0),
     _listeners(nullptr)
 {
   _local_val.string_val = 0;
@@ -948,6 +952,7 @@ SGPropertyNode::SGPropertyNode( const std::string& name,
     _type(props::NONE),
     _tied(false),
     _attr(READ|WRITE),
+    _binding_version(0),
     _listeners(nullptr)
 {
   _local_val.string_val = 0;
@@ -1970,6 +1975,7 @@ bool SGPropertyNode::tie (const SGRawValue<const char *> &rawValue,
     _type = props::STRING;
     _tied = true;
     _value.val = rawValue.clone();
+    ++_binding_version;
 
     if (useDefault) {
         int save_attributes = getAttributes();
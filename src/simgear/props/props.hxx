@@ -447,6 +447,11 @@ public:
     return new SGRawValuePointer(_ptr);
   }
 
+  /**
+   * Get the pointer to the variable to which this raw value is bound.
+   */
+  T * getPointer () const { return _ptr; }
+
 private:
   T * _ptr;
 };
@@ -1130,6 +1135,7 @@ public:
    */
   void setAttribute (Attribute attr, bool state) {
     (state ? _attr |= attr : _attr &= ~attr);
+    ++_binding_version;
   }
 
 
@@ -1142,7 +1148,7 @@ public:
   /**
    * Set all of the mode attributes for the property node.
    */
-  void setAttributes (int attr) { _attr = attr; }
+  void setAttributes (int attr) { _attr = attr; ++_binding_version; }
 
 
   //
@@ -1348,6 +1354,19 @@ public:
    */
   bool isTied () const { return _tied; }
 
+  /**
+   * Get the raw value this node is bound to, or nullptr if the node is not
+   * tied.
+   */
+  const SGRaw* getRawValue () const { return _tied ? _value.val : nullptr; }
+
+  /**
+   * Get a counter that is incremented each time the node is tied or untied
+   * or its attributes are modified. A raw value obtained from getRawValue()
+   * remains valid as long as this counter is unchanged.
+   */
+  unsigned int getBindingVersion () const { return _binding_version; }
+
     /**
      * Bind this node to an external source.
      */
@@ -1795,6 +1814,7 @@ private:
   simgear::props::Type _type;
   bool _tied;
   int _attr;
+  unsigned int _binding_version;
 
   // The right kind of pointer...
   union {
@@ -1922,6 +1942,7 @@ bool SGPropertyNode::tie(const SGRawValue<T> &rawValue, bool useDefault)
         _type = EXTENDED;
     _tied = true;
     _value.val = rawValue.clone();
+    ++_binding_version;
     if (useDefault) {
         int save_attributes = getAttributes();
         setAttribute( WRITE, true );
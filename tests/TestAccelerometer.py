@@ -80,8 +80,14 @@ class TestAccelerometer(JSBSimTestCase):
         fdm['ic/psi-true-rad'] = 0.0
         fdm.run_ic()
 
-        for _ in range(1000):
+        # The landing gears keep the lateral acceleration oscillating at the
+        # round-off level (a few 1E-7 ft/s^2) so it is averaged over the last
+        # 100 time steps.
+        accelY = 0.0
+        for i in range(1000):
             fdm.run()
+            if i >= 900:
+                accelY += fdm['fcs/accelerometer/Y']
 
         r = fdm['position/radius-to-vehicle-ft']
         g = fdm['accelerations/gravity-ft_sec2']
@@ -96,7 +102,7 @@ class TestAccelerometer(JSBSimTestCase):
         faz = fc * math.cos(geodLat - pitch) - g * math.cos(pitch - deviation)
 
         self.assertAlmostEqual(fdm['fcs/accelerometer/X'], fax, delta=1E-7)
-        self.assertAlmostEqual(fdm['fcs/accelerometer/Y'], 0.0, delta=1E-7)
+        self.assertAlmostEqual(accelY/100, 0.0, delta=1E-7)
         self.assertAlmostEqual(fdm['fcs/accelerometer/Z']/faz, 1.0, delta=1E-7)
 
     def testSteadyFlight(self):
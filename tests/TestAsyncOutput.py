@@ -0,0 +1,120 @@
+# TestAsyncOutput.py
+#
+# Check the asynchronous outputs: the files generated by the writer threads
+# must be identical to the files generated by the simulation thread, and the
+# records dropped when the queue is full must be counted.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import filecmp
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+OUTPUT = """<?xml version="1.0"?>
+<output name="{name}" type="{type}" rate="100" {attributes}>
+  <property> position/h-sl-ft </property>
+  <property> velocities/vt-fps </property>
+  <property> attitude/psi-rad </property>
+</output>
+"""
+
+
+class TestAsyncOutput(JSBSimTestCase):
+    def write_output(self, name, type, attributes=''):
+        filename = name+'.xml'
+        with open(filename, 'w') as f:
+            f.write(OUTPUT.format(name=name, type=type, attributes=attributes))
+        return filename
+
+    def get_output_index(self, fdm, name):
+        n = 0
+        while True:
+            filename = fdm.get_output_filename(n)
+            if not filename:
+                self.fail(f'Output {name} not found')
+            if filename.endswith(name):
+                return n
+            n += 1
+
+    def count_records(self, filename):
+        with open(filename) as f:
+            return len(f.readlines()) - 1
+
+    def test_async_files(self):
+        outputs = [self.write_output('sync.csv', 'CSV'),
+                   self.write_output('block.csv', 'CSV',
+                                     'async="ON" queue="4"'),
+                   self.write_output('grow.csv', 'CSV',
+                                     'async="ON" queue="1" overflow="GROW"'),
+                   self.write_output('drop.csv', 'CSV',
+                                     'async="ON" queue="1" overflow="DROP"'),
+                   self.write_output('sync.bin', 'BINARY'),
+                   self.write_output('async.bin', 'BINARY', 'async="ON"')]
+
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ball.xml'))
+        for output in outputs:
+            fdm.set_output_directive(output)
+        fdm.run_ic()
+
+        while fdm.get_sim_time() < 20.0:
+            fdm.run()
+
+        idx = self.get_output_index(fdm, 'drop.csv')
+        dropped = fdm[f'simulation/output[{idx}]/dropped-records']
+        idx = self.get_output_index(fdm, 'block.csv')
+        self.assertEqual(fdm[f'simulation/output[{idx}]/dropped-records'], 0)
+
+        # The files are complete once the writer threads are stopped, i.e. when
+        # the FDM is destroyed.
+        del fdm
+        self.delete_fdm()
+
+        for filename in ('block.csv', 'grow.csv'):
+            self.assertTrue(filecmp.cmp('sync.csv', filename, shallow=False))
+        self.assertTrue(filecmp.cmp('sync.bin', 'async.bin', shallow=False))
+
+        self.assertEqual(self.count_records('drop.csv') + dropped,
+                         self.count_records('sync.csv'))
+
+    def test_start_new_output(self):
+        outputs = [self.write_output('sync.csv', 'CSV'),
+                   self.write_output('async.csv', 'CSV', 'async="ON"')]
+
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ball.xml'))
+        for output in outputs:
+            fdm.set_output_directive(output)
+        fdm.run_ic()
+
+        for _ in range(2):
+            while fdm.get_sim_time() < 5.0:
+                fdm.run()
+            # The pending records are written before the files are reopened.
+            fdm.reset_to_initial_conditions(1)
+
+        del fdm
+        self.delete_fdm()
+
+        for name in ('', '_0', '_1'):
+            self.assertTrue(filecmp.cmp(f'sync{name}.csv', f'async{name}.csv',
+                                        shallow=False))
+
+
+RunTest(TestAsyncOutput)
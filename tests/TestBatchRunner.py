@@ -0,0 +1,121 @@
+# TestBatchRunner.py
+#
+# Check that the cases run by FGBatchRunner on several threads give the same
+# results than the same cases run sequentially by FGFDMExec.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import os
+
+from JSBSim_utils import JSBSimTestCase, RunTest, jsbsim
+
+
+class TestBatchRunner(JSBSimTestCase):
+    outputs = ['position/h-sl-ft', 'velocities/u-fps', 'attitude/theta-rad']
+
+    def create_runner(self, nthreads):
+        runner = jsbsim.FGBatchRunner(os.path.join(self.sandbox(), ''),
+                                      nthreads)
+        path = self.sandbox.path_to_jsbsim_file()
+        runner.set_aircraft_path(os.path.join(path, 'aircraft'))
+        runner.set_engine_path(os.path.join(path, 'engine'))
+        runner.set_systems_path(os.path.join(path, 'systems'))
+        runner.set_output_properties(self.outputs)
+        return runner
+
+    def run_sequential(self, altitude, end_time):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.load_ic('reset01', True)
+        fdm['ic/h-sl-ft'] = altitude
+        fdm.run_ic()
+        while fdm.run():
+            if fdm.get_sim_time() >= end_time:
+                break
+        values = [fdm[name] for name in self.outputs]
+        self.delete_fdm()
+        return values
+
+    def test_batch_vs_sequential(self):
+        altitudes = [1000.0, 2000.0, 3000.0, 4000.0, 5000.0]
+        end_time = 5.0
+        runner = self.create_runner(3)
+
+        for h in altitudes:
+            runner.add_case(model='c172x', initfile='reset01', end_time=end_time,
+                            properties={'ic/h-sl-ft': h})
+
+        self.assertEqual(runner.get_num_cases(), len(altitudes))
+        results = runner.run()
+        self.assertEqual(len(results), len(altitudes))
+
+        for h, result in zip(altitudes, results):
+            self.assertTrue(result['success'], msg=result['error'])
+            self.assertAlmostEqual(result['sim_time'], end_time, delta=0.01)
+            ref = self.run_sequential(h, end_time)
+            for value, ref_value in zip(result['values'], ref):
+                self.assertEqual(value, ref_value)
+
+    def test_failing_case(self):
+        runner = self.create_runner(2)
+        runner.add_case(model='does_not_exist', end_time=1.0)
+        runner.add_case(model='c172x', initfile='reset01')  # No end time
+        runner.add_case(model='c172x', initfile='reset01', end_time=1.0)
+        results = runner.run()
+
+        self.assertFalse(results[0]['success'])
+        self.assertFalse(results[1]['success'])
+        self.assertTrue(results[2]['success'], msg=results[2]['error'])
+
+    def test_script(self):
+        runner = self.create_runner(2)
+        script = self.sandbox.path_to_jsbsim_file('scripts', 'ball.xml')
+        for _ in range(4):
+            runner.add_case(script=script, end_time=10.0)
+        results = runner.run()
+
+        for result in results:
+            self.assertTrue(result['success'], msg=result['error'])
+            self.assertAlmostEqual(result['sim_time'], 10.0, delta=0.02)
+            for value, ref in zip(result['values'], results[0]['values']):
+                self.assertEqual(value, ref)
+
+    def test_seeds(self):
+        # The turbulence draws random numbers so the results depend on the seed
+        # of each case: a repeated seed must reproduce its results whatever the
+        # thread that runs it and different seeds must give different results.
+        seeds = [1, 2, 1, 3, 2]
+        turbulence = {'atmosphere/turb-type': 3,
+                      'atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps': 75.0,
+                      'atmosphere/turbulence/milspec/severity': 6}
+        runner = self.create_runner(3)
+        for seed in seeds:
+            runner.add_case(model='c172x', initfile='reset01', end_time=5.0,
+                            properties=turbulence, seed=seed)
+        results = runner.run()
+
+        for result in results:
+            self.assertTrue(result['success'], msg=result['error'])
+
+        values = [list(result['values']) for result in results]
+        self.assertEqual(values[0], values[2])
+        self.assertEqual(values[1], values[4])
+        self.assertNotEqual(values[0], values[1])
+        self.assertNotEqual(values[0], values[3])
+        self.assertNotEqual(values[1], values[3])
+
+RunTest(TestBatchRunner)
@@ -0,0 +1,106 @@
+# TestBinaryInput.py
+#
+# Check that the binary UDP input decodes the packets according to the layout
+# declared in the <input> element and rejects the stale and malformed packets.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import struct
+import time
+import xml.etree.ElementTree as et
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+PROPERTIES = (("fcs/aileron-cmd-norm", "FLOAT32"),
+              ("fcs/elevator-cmd-norm", "INT16"),
+              ("fcs/rudder-cmd-norm", "FLOAT64"))
+
+
+class TestBinaryInput(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.udp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+    def tearDown(self):
+        self.udp.close()
+        super().tearDown()
+
+    def load_script(self, port, attributes):
+        script_path = self.sandbox.path_to_jsbsim_file("scripts", "c1722.xml")
+        tree = et.parse(script_path)
+        input_tag = et.SubElement(tree.getroot(), "input")
+        input_tag.attrib.update({"type": "BINARY", "port": str(port)})
+        input_tag.attrib.update(attributes)
+        et.SubElement(input_tag, "sequence", {"type": "UINT8"})
+        et.SubElement(input_tag, "timestamp", {"type": "FLOAT32"})
+        for name, type in PROPERTIES:
+            et.SubElement(input_tag, "property", {"type": type}).text = name
+        tree.write("c1722_binary.xml")
+
+        fdm = self.create_fdm()
+        fdm.load_script("c1722_binary.xml")
+        fdm.run_ic()
+        return fdm
+
+    def send(self, port, fmt, *values):
+        self.udp.sendto(struct.pack(fmt, *values), ("localhost", port))
+
+    def check_values(self, fdm, values, stale, malformed):
+        # Give some time for the packets to be received.
+        time.sleep(0.1)
+        fdm.run()
+        for (name, _), value in zip(PROPERTIES, values):
+            self.assertAlmostEqual(fdm[name], value)
+        self.assertEqual(fdm["simulation/input/stale-packets"], stale)
+        self.assertEqual(fdm["simulation/input/malformed-packets"], malformed)
+
+    def check_input(self, port, attributes, fmt):
+        fdm = self.load_script(port, attributes)
+
+        # All the packets received are applied in order.
+        self.send(port, fmt, 250, 1.0, 0.25, 1, 0.125)
+        self.send(port, fmt, 251, 1.1, 0.5, -1, 0.3)
+        self.check_values(fdm, (0.5, -1.0, 0.3), 0, 0)
+
+        # Out of sequence packet
+        self.send(port, fmt, 250, 1.2, 0.9, 5, 0.9)
+        self.check_values(fdm, (0.5, -1.0, 0.3), 1, 0)
+
+        # The sequence number wraps around
+        self.send(port, fmt, 3, 1.3, 0.1, 2, 0.2)
+        self.check_values(fdm, (0.1, 2.0, 0.2), 1, 0)
+
+        # Packet older than the last one accepted
+        self.send(port, fmt, 4, 1.0, 0.9, 5, 0.9)
+        self.check_values(fdm, (0.1, 2.0, 0.2), 2, 0)
+
+        # Packet with a wrong size
+        self.udp.sendto(b"abc", ("localhost", port))
+        self.check_values(fdm, (0.1, 2.0, 0.2), 2, 1)
+
+    def test_little_endian(self):
+        self.check_input(1150, {}, "<Bffhd")
+
+    def test_big_endian(self):
+        self.check_input(1151, {"byteorder": "BIG"}, ">Bffhd")
+
+    def test_async(self):
+        self.check_input(1152, {"async": "ON"}, "<Bffhd")
+
+
+RunTest(TestBinaryInput)
@@ -0,0 +1,159 @@
+# TestBinaryOutput.py
+#
+# Check the binary output to a file and to a UDP socket: the header must
+# describe the channels and the records must match the CSV output.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import socket
+import struct
+
+import numpy as np
+import pandas as pd
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+CHANNELS = """
+  <property> position/h-sl-ft </property>
+  <property caption="Speed"> velocities/vt-fps </property>
+  <property> attitude/phi-rad </property>
+  <function name="test/{tag}_altitude_x2">
+    <product>
+      <property> position/h-sl-ft </property>
+      <value> 2.0 </value>
+    </product>
+  </function>
+"""
+
+OUTPUT = """<?xml version="1.0"?>
+<output name="{name}" type="{type}" rate="10" {attributes}>
+{channels}
+</output>
+"""
+
+
+def parse_header(data):
+    magic, version, size, nchannels = struct.unpack_from('<4sHHI', data)
+    offset = struct.calcsize('<4sHHI')
+    names = []
+    units = []
+    for _ in range(nchannels):
+        for field in (names, units):
+            length, = struct.unpack_from('<H', data, offset)
+            offset += 2
+            field.append(data[offset:offset+length].decode())
+            offset += length
+    return magic, version, size, names, units, offset
+
+
+class TestBinaryOutput(JSBSimTestCase):
+    def write_output(self, tag, name, type, attributes=''):
+        # The functions of the outputs are bound to properties which names
+        # must be unique.
+        filename = tag+'_output.xml'
+        with open(filename, 'w') as f:
+            f.write(OUTPUT.format(name=name, type=type, attributes=attributes,
+                                  channels=CHANNELS.format(tag=tag)))
+        return filename
+
+    def run_ball(self, outputs, end_time=5.0):
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ball.xml'))
+        for output in outputs:
+            fdm.set_output_directive(output)
+        fdm.run_ic()
+
+        while fdm.get_sim_time() < end_time:
+            fdm.run()
+
+        return fdm
+
+    def read_binary(self, filename, tag):
+        with open(filename, 'rb') as f:
+            data = f.read()
+
+        magic, version, size, names, units, offset = parse_header(data)
+        self.assertEqual(magic, b'JSBB')
+        self.assertEqual(version, 1)
+        self.assertEqual(names, ['Time', '/fdm/jsbsim/position/h-sl-ft',
+                                 'Speed', '/fdm/jsbsim/attitude/phi-rad',
+                                 f'test/{tag}_altitude_x2'])
+        self.assertEqual(units, ['sec', 'ft', 'fps', 'rad', ''])
+
+        dtype = '<f8' if size == 8 else '<f4'
+        records = np.frombuffer(data[offset:], dtype=dtype)
+        self.assertEqual(len(records) % len(names), 0)
+        return size, records.reshape(-1, len(names))
+
+    def test_binary_file(self):
+        csv = self.write_output('csv', 'output.csv', 'CSV')
+        f64 = self.write_output('f64', 'output64.bin', 'BINARY')
+        f32 = self.write_output('f32', 'output32.bin', 'BINARY',
+                                'format="FLOAT32"')
+        self.run_ball([csv, f64, f32])
+        self.delete_fdm()
+
+        ref = pd.read_csv('output.csv').to_numpy()
+
+        size, records = self.read_binary('output64.bin', 'f64')
+        self.assertEqual(size, 8)
+        self.assertEqual(records.shape, ref.shape)
+        np.testing.assert_allclose(records, ref, rtol=1E-9)
+        np.testing.assert_allclose(records[:, 4], 2.0*records[:, 1])
+
+        size, records32 = self.read_binary('output32.bin', 'f32')
+        self.assertEqual(size, 4)
+        np.testing.assert_array_equal(records32,
+                                      records.astype(np.float32))
+
+    def test_binary_socket(self):
+        receiver = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        receiver.bind(('127.0.0.1', 0))
+        receiver.settimeout(5.0)
+        port = receiver.getsockname()[1]
+
+        udp = self.write_output('udp', '127.0.0.1',
+                                'BINARY_SOCKET',
+                                f'protocol="UDP" port="{port}"')
+        fdm = self.run_ball([udp], 1.0)
+
+        # The header is sent in its own datagram, followed by one datagram
+        # per record.
+        magic, version, size, names, units, offset = parse_header(
+            receiver.recv(4096))
+        self.assertEqual(magic, b'JSBB')
+        self.assertEqual(size, 8)
+        self.assertEqual(len(names), 5)
+
+        record = np.frombuffer(receiver.recv(4096), dtype='<f8')
+        self.assertEqual(len(record), 5)
+        self.assertEqual(record[0], 0.0)
+
+        last = record
+        receiver.settimeout(0.5)
+        try:
+            while True:
+                last = np.frombuffer(receiver.recv(4096), dtype='<f8')
+        except socket.timeout:
+            pass
+
+        self.assertAlmostEqual(last[0], fdm.get_sim_time(), delta=0.1)
+        self.assertEqual(last[4], 2.0*last[1])
+        receiver.close()
+
+
+RunTest(TestBinaryOutput)
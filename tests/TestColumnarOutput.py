@@ -0,0 +1,146 @@
+# TestColumnarOutput.py
+#
+# Check the columnar output: the columns mapped in memory with numpy must
+# match the CSV output, with and without the XOR encoding.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import mmap
+import struct
+
+import numpy as np
+import pandas as pd
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+OUTPUT = """<?xml version="1.0"?>
+<output name="{name}" type="{type}" rate="50" {attributes}>
+  <property> position/h-sl-ft </property>
+  <property> velocities/vt-fps </property>
+  <property> attitude/psi-rad </property>
+</output>
+"""
+
+HEADER = '<4sHHIIQQQQQI'
+
+
+class ColumnarFile:
+    def __init__(self, filename):
+        self.data = np.memmap(filename, dtype='u1', mode='r')
+        (self.magic, self.version, self.encoding, self.nchannels,
+         self.records_per_chunk, self.chunk_size, self.data_offset,
+         self.nrecords, self.nchunks, self.index_offset,
+         channels_size) = struct.unpack_from(HEADER, self.data)
+
+        offset = struct.calcsize(HEADER) + 12
+        self.names = []
+        for _ in range(self.nchannels):
+            length, = struct.unpack_from('<H', self.data, offset)
+            self.names.append(bytes(self.data[offset+2:offset+2+length]).decode())
+            offset += 2 + length
+            length, = struct.unpack_from('<H', self.data, offset)
+            offset += 2 + length
+
+        self.chunks = np.ndarray((self.nchunks, self.nchannels,
+                                  self.records_per_chunk), dtype='<u8',
+                                 buffer=self.data, offset=self.data_offset,
+                                 strides=(self.chunk_size,
+                                          8*self.records_per_chunk, 8))
+        self.index = np.ndarray((self.nchunks, 2), dtype='<f8',
+                                buffer=self.data, offset=self.index_offset)
+
+    def column(self, channel):
+        bits = self.chunks[:, channel, :]
+        if self.encoding == 1:
+            bits = np.bitwise_xor.accumulate(bits, axis=1)
+        return bits.ravel()[:self.nrecords].view('<f8')
+
+
+class TestColumnarOutput(JSBSimTestCase):
+    def write_output(self, tag, name, type, attributes=''):
+        filename = tag+'_output.xml'
+        with open(filename, 'w') as f:
+            f.write(OUTPUT.format(name=name, type=type, attributes=attributes))
+        return filename
+
+    def test_columns(self):
+        csv = self.write_output('csv', 'output.csv', 'CSV')
+        raw = self.write_output('raw', 'raw.jsbc', 'COLUMNAR',
+                                'chunk="64" ring="2"')
+        xor = self.write_output('xor', 'xor.jsbc', 'COLUMNAR',
+                                'chunk="100" encoding="XOR"')
+
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file('scripts',
+                                                         'ball.xml'))
+        for output in (csv, raw, xor):
+            fdm.set_output_directive(output)
+        fdm.run_ic()
+
+        while fdm.get_sim_time() < 10.0:
+            fdm.run()
+
+        # The number of records is updated while the simulation is running.
+        f = ColumnarFile('raw.jsbc')
+        self.assertEqual(f.magic, b'JSBC')
+        self.assertEqual(f.index_offset, 0)
+        nrecords = f.nrecords
+        self.assertGreater(nrecords, 400)
+        self.assertAlmostEqual(f.column(0)[-1], fdm.get_sim_time(), delta=0.02)
+        del f
+
+        # The files are closed, and their index written, when the FDM is
+        # destroyed.
+        del fdm
+        self.delete_fdm()
+
+        ref = pd.read_csv('output.csv').to_numpy()
+        self.assertEqual(ref.shape[0], nrecords)
+
+        for filename, encoding, nrecords_per_chunk in (('raw.jsbc', 0, 64),
+                                                       ('xor.jsbc', 1, 100)):
+            f = ColumnarFile(filename)
+            self.assertEqual(f.version, 1)
+            self.assertEqual(f.encoding, encoding)
+            self.assertEqual(f.records_per_chunk, nrecords_per_chunk)
+            self.assertEqual(f.names, ['Time', '/fdm/jsbsim/position/h-sl-ft',
+                                       '/fdm/jsbsim/velocities/vt-fps',
+                                       '/fdm/jsbsim/attitude/psi-rad'])
+            self.assertEqual(f.nrecords, nrecords)
+            self.assertEqual(f.nchunks,
+                             (nrecords+nrecords_per_chunk-1)//nrecords_per_chunk)
+            self.assertEqual(f.data_offset % mmap.ALLOCATIONGRANULARITY, 0)
+            self.assertEqual(f.chunk_size % mmap.ALLOCATIONGRANULARITY, 0)
+
+            columns = np.column_stack([f.column(i) for i in range(4)])
+            np.testing.assert_allclose(columns, ref, rtol=1E-9)
+
+            time = columns[:, 0]
+            starts = time[::nrecords_per_chunk]
+            ends = time[nrecords_per_chunk-1::nrecords_per_chunk]
+            np.testing.assert_array_equal(f.index[:, 0], starts)
+            np.testing.assert_array_equal(f.index[:len(ends), 1], ends)
+            self.assertEqual(f.index[-1, 1], time[-1])
+
+            # A chunk column is mapped without copying the data.
+            if encoding == 0:
+                column = f.chunks[1, 1].view('<f8')
+                self.assertFalse(column.flags['OWNDATA'])
+                np.testing.assert_allclose(column, ref[64:128, 1], rtol=1E-9)
+            del f
+
+
+RunTest(TestColumnarOutput)
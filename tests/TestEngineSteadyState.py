@@ -0,0 +1,81 @@
+# TestEngineSteadyState.py
+#
+# Check that the steady state of the engines is solved directly rather than by
+# time marching the engine model.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestEngineSteadyState(JSBSimTestCase):
+    def init_engines(self, aircraft, vc, h, throttle):
+        fdm = self.create_fdm()
+        fdm.load_model(aircraft)
+        fdm['ic/h-sl-ft'] = h
+        fdm['ic/vc-kts'] = vc
+        fdm.run_ic()
+        fdm['propulsion/set-running'] = -1
+        fdm['fcs/throttle-cmd-norm'] = throttle
+        fdm.run()
+        fdm.get_propulsion().get_steady_state()
+        return fdm
+
+    def test_solved(self):
+        # Fixed pitch and constant speed pistons, turbine, turboprop and a
+        # turbine driving a propeller.
+        for aircraft, vc, h, throttle in (('c172x', 100, 3000, 0.7),
+                                          ('c310', 150, 5000, 0.8),
+                                          ('f16', 400, 20000, 0.6),
+                                          ('DHC6', 140, 5000, 0.8),
+                                          ('C130', 250, 20000, 0.8)):
+            fdm = self.init_engines(aircraft, vc, h, throttle)
+            self.assertTrue(fdm['propulsion/engine/steady-state-solved'],
+                            msg=aircraft)
+            self.assertLess(fdm['propulsion/engine/steady-state-iterations'],
+                            30, msg=aircraft)
+
+            # The steady state is a fixed point: solving it again must not
+            # change the engine.
+            thrust = fdm['propulsion/engine/thrust-lbs']
+            # The F16 is the only aircraft which has no propeller.
+            has_propeller = fdm.get_property_manager().hasNode(
+                'propulsion/engine/propeller-rpm')
+            self.assertEqual(has_propeller, aircraft != 'f16', msg=aircraft)
+            if has_propeller:
+                rpm = fdm['propulsion/engine/propeller-rpm']
+            fdm.get_propulsion().get_steady_state()
+            self.assertTrue(fdm['propulsion/engine/steady-state-solved'],
+                            msg=aircraft)
+            self.assertAlmostEqual(fdm['propulsion/engine/thrust-lbs']/thrust,
+                                   1.0, delta=1E-4, msg=aircraft)
+            if has_propeller:
+                self.assertAlmostEqual(fdm['propulsion/engine/propeller-rpm'],
+                                       rpm, delta=1E-3, msg=aircraft)
+
+            self.delete_fdm()
+
+    def test_time_marching_fallback(self):
+        # The IELU torque limiter of the L410 turboprop intervenes so the engine
+        # falls back to time marching.
+        fdm = self.init_engines('L410', 150, 5000, 0.8)
+        self.assertFalse(fdm['propulsion/engine/steady-state-solved'])
+        self.assertGreater(fdm['propulsion/engine/steady-state-iterations'],
+                           120)
+
+
+RunTest(TestEngineSteadyState)
@@ -0,0 +1,64 @@
+# TestFunctionCompilation.py
+#
+# Check that the functions compiled into stack programs give exactly the same
+# results than the functions evaluated by walking their tree.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestFunctionCompilation(JSBSimTestCase):
+    def run_script(self, script_name, compile_functions, steps):
+        fdm = self.create_fdm()
+        self.assertTrue(fdm.get_compile_functions())
+        fdm.set_compile_functions(compile_functions)
+        self.assertEqual(fdm.get_compile_functions(), compile_functions)
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', script_name)
+        fdm.load_script(script_path)
+        fdm.run_ic()
+
+        for _ in range(steps):
+            fdm.run()
+
+        names = [p.split(' ')[0] for p in fdm.get_property_catalog()]
+        values = {name: fdm[name] for name in names
+                  if name.startswith(('aero/', 'fcs/', 'propulsion/',
+                                      'forces/', 'moments/'))}
+        self.delete_fdm()
+        return values
+
+    def check_script(self, script_name, steps=1000):
+        ref = self.run_script(script_name, False, steps)
+        values = self.run_script(script_name, True, steps)
+
+        self.assertGreater(len(ref), 0)
+        self.assertEqual(values.keys(), ref.keys())
+        for name in ref:
+            self.assertEqual(values[name], ref[name], msg=name)
+
+    def test_c172x(self):
+        self.check_script('c1722.xml')
+
+    def test_f16(self):
+        self.check_script('f16_test.xml')
+
+    def test_737(self):
+        self.check_script('737_cruise.xml')
+
+
+RunTest(TestFunctionCompilation)
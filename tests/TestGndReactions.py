@@ -154,5 +154,37 @@ class TestGndReactions(JSBSimTestCase):
         self.assertAlmostEqual(My_total/My, 0.0, delta=1E-6)
         self.assertAlmostEqual(Mz_total/Mz, 0.0, delta=1E-6)
 
+    def test_friction_solver(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.load_ic('reset00', True)
+        fdm['ic/h-agl-ft'] = 5.0
+
+        fdm.run_ic()
+
+        max_its = fdm['forces/friction/max-iterations']
+        self.assertEqual(max_its, 50)
+
+        # Let the aircraft settle on its landing gears.
+        while fdm.get_sim_time() < 10.0:
+            fdm.run()
+            its = fdm['forces/friction/iterations']
+            self.assertLessEqual(its, max_its)
+            if fdm['forces/friction/constraints'] == 0:
+                self.assertEqual(its, 0)
+
+        # Once the aircraft is at rest, the solver is warm started from the
+        # solution of the previous time step and converges in a few iterations.
+        for _ in range(10):
+            fdm.run()
+            # Rolling and side friction for each of the 3 landing gears.
+            self.assertEqual(fdm['forces/friction/constraints'], 6)
+            self.assertLess(fdm['forces/friction/iterations'], 10)
+            self.assertLess(fdm['forces/friction/residual'], 1E-5)
+
+        fdm['forces/friction/max-iterations'] = 1
+        fdm.run()
+        self.assertEqual(fdm['forces/friction/iterations'], 1)
+
 
 RunTest(TestGndReactions)
@@ -20,6 +20,8 @@
 #
 
 import asyncio
+import socket
+import time
 import xml.etree.ElementTree as et
 
 import telnetlib3
@@ -101,6 +103,12 @@ class TestInputSocket(JSBSimTestCase):
             asyncio.run(self.run_test(2222, self.sanity_check))
 
     def test_input_socket(self):
+        self.check_input_socket(1137)
+
+    def test_async_input_socket(self):
+        self.check_input_socket(1139, {"async": "ON"})
+
+    def check_input_socket(self, port, attributes={}):
         # First, extract the time step from the script file
         tree = et.parse(self.script_path)
         dt = float(tree.getroot().find("run").attrib["dt"])
@@ -110,7 +118,8 @@ class TestInputSocket(JSBSimTestCase):
         tree, aircraft_name, _ = CopyAircraftDef(self.script_path, self.sandbox)
         root = tree.getroot()
         input_tag = et.SubElement(root, "input")
-        input_tag.attrib["port"] = "1137"
+        input_tag.attrib["port"] = str(port)
+        input_tag.attrib.update(attributes)
         tree.write(self.sandbox("aircraft", aircraft_name, aircraft_name + ".xml"))
 
         self._fdm.set_aircraft_path("aircraft")
@@ -118,7 +127,7 @@ class TestInputSocket(JSBSimTestCase):
         self._fdm.run_ic()
         self._fdm.hold()
 
-        asyncio.run(self.run_test(1137, lambda r, w: self.shell(root, dt, r, w)))
+        asyncio.run(self.run_test(port, lambda r, w: self.shell(root, dt, r, w)))
 
     async def shell(self, root, dt, reader, writer):
         await self.sanity_check(reader, writer)
@@ -245,5 +254,51 @@ class TestInputSocket(JSBSimTestCase):
 
         asyncio.run(self.run_test(1138, self.sanity_check))
 
+    def test_async_udp_input(self):
+        # Two FDM instances share the event loop of the process.
+        fdms = [self._fdm, self.create_fdm()]
+        ports = [1140, 1141]
+
+        # The async attribute is not case sensitive.
+        for i, (fdm, port) in enumerate(zip(fdms, ports)):
+            tree = et.parse(self.script_path)
+            input_tag = et.SubElement(tree.getroot(), "input")
+            input_tag.attrib.update(
+                {"type": "QTJSBSIM", "port": str(port), "rate": "60",
+                 "async": ("ON", "on")[i]}
+            )
+            for name in ("fcs/aileron-cmd-norm", "fcs/elevator-cmd-norm"):
+                et.SubElement(input_tag, "property").text = name
+            tree.write(f"c1722_{port}.xml")
+
+            fdm.load_script(f"c1722_{port}.xml")
+            fdm.run_ic()
+
+        udp = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        for i, port in enumerate(ports):
+            # The datagrams received between two frames are all applied in
+            # order and the stale ones are discarded.
+            for stamp in range(1, 11):
+                udp.sendto(
+                    f"{stamp},{0.05*stamp+0.2*i},-0.5".encode(), ("localhost", port)
+                )
+            udp.sendto(b"0,0.0,0.0", ("localhost", port))
+        udp.close()
+
+        for i, fdm in enumerate(fdms):
+            # The event loop receives the datagrams in the background so the
+            # FDM is run until the last datagram has been applied. The input
+            # is read every other frame at 60 Hz.
+            deadline = time.monotonic() + 5.0
+            while abs(fdm["fcs/aileron-cmd-norm"] - 0.5-0.2*i) > 1E-9:
+                self.assertLess(time.monotonic(), deadline)
+                fdm.run()
+            self.assertAlmostEqual(fdm["fcs/elevator-cmd-norm"], -0.5)
+
+            # The stale datagram is discarded.
+            for _ in range(2):
+                fdm.run()
+            self.assertAlmostEqual(fdm["fcs/aileron-cmd-norm"], 0.5+0.2*i)
+
 
 RunTest(TestInputSocket)
@@ -1,11 +1,13 @@
 import xml.etree.ElementTree as et
 
+import numpy as np
+
 from JSBSim_utils import JSBSimTestCase, RunTest, CopyAircraftDef
 import jsbsim
 
 
 class TestLinearization(JSBSimTestCase):
-    def test_do_linearization(self):
+    def trim_737(self):
         script_path = self.sandbox.path_to_jsbsim_file('scripts',
                                                        '737_cruise.xml')
 
@@ -22,7 +24,10 @@ class TestLinearization(JSBSimTestCase):
         fdm.debug_lvl = 1 # Enable debug messages to log trimmed values
         fdm['simulation/do_simple_trim'] = 1
         fdm.debug_lvl = 0 # Disable debug messages
+        return fdm
 
+    def test_do_linearization(self):
+        fdm = self.trim_737()
         linearization = jsbsim.FGLinearization(fdm)
 
         self.assertEqual(linearization.x0.shape, (12,))
@@ -48,5 +53,14 @@ class TestLinearization(JSBSimTestCase):
         self.assertEqual(linearization.y_units, ('ft/s', 'rad', 'rad', 'rad/s', 'rad', 'rad', 'rad/s',
                                                  'rad', 'rad/s', 'rad', 'rad', 'ft'))
 
+    def test_parallel_linearization(self):
+        fdm = self.trim_737()
+        serial = jsbsim.FGLinearization(fdm)
+        # The columns are computed by the FDM and 2 clones of it.
+        parallel = jsbsim.FGLinearization(fdm, 3)
+
+        for M, M_parallel in zip(serial.state_space, parallel.state_space):
+            np.testing.assert_allclose(M_parallel, M, rtol=1E-6, atol=1E-4)
+
 
 RunTest(TestLinearization)
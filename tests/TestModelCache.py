@@ -0,0 +1,80 @@
+# TestModelCache.py
+#
+# Check that the XML documents cached by FGXMLFileRead give the same models
+# than the documents read from disk and that a modified file is read again.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest, CopyAircraftDef
+
+
+class TestModelCache(JSBSimTestCase):
+    outputs = ['position/h-sl-ft', 'velocities/u-fps', 'attitude/theta-rad',
+               'aero/coefficient/CLwbh', 'aero/coefficient/CDwbh',
+               'propulsion/engine/thrust-lbs']
+
+    def run_c172x(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.load_ic('reset01', True)
+        fdm.run_ic()
+        fdm['fcs/throttle-cmd-norm'] = 1.0
+        fdm['fcs/mixture-cmd-norm'] = 0.87
+        fdm['propulsion/magneto_cmd'] = 3
+        fdm['propulsion/starter_cmd'] = 1
+
+        for _ in range(500):
+            fdm.run()
+
+        values = [fdm[name] for name in self.outputs]
+        self.delete_fdm()
+        return values
+
+    def test_cached_model(self):
+        # The first run fills the cache, the second one uses it.
+        ref = self.run_c172x()
+        values = self.run_c172x()
+
+        for name, value, ref_value in zip(self.outputs, values, ref):
+            self.assertEqual(value, ref_value, msg=name)
+
+    def test_modified_file(self):
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        tree, aircraft_name, _ = CopyAircraftDef(script_path, self.sandbox)
+        aircraft_file = self.sandbox('aircraft', aircraft_name,
+                                     aircraft_name+'.xml')
+        emptywt = tree.getroot().find('mass_balance/emptywt')
+        weight = float(emptywt.text)
+        tree.write(aircraft_file)
+
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_model(aircraft_name)
+        self.assertAlmostEqual(fdm['inertia/empty-weight-lbs'], weight)
+        self.delete_fdm()
+
+        # Modify the aircraft file: the cached document must not be used.
+        emptywt.text = str(weight + 100.0)
+        tree.write(aircraft_file)
+
+        fdm = self.create_fdm()
+        fdm.set_aircraft_path('aircraft')
+        fdm.load_model(aircraft_name)
+        self.assertAlmostEqual(fdm['inertia/empty-weight-lbs'], weight + 100.0)
+
+
+RunTest(TestModelCache)
@@ -0,0 +1,81 @@
+# TestOutputSharedMemory.py
+#
+# Check that the FlightGear output over shared memory publishes the FGNetFDM
+# structure in the native byte order.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import mmap
+import os
+import struct
+import sys
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+OUTPUT = """<?xml version="1.0"?>
+<output type="FLIGHTGEAR" protocol="SHM" name="{name}" rate="60"/>
+"""
+
+# Magic number, size of FGNetFDM and sequence number followed by the fields
+# version, padding, longitude, latitude and altitude of FGNetFDM.
+HEADER = "=4sIQIIddd"
+
+
+class TestOutputSharedMemory(JSBSimTestCase):
+    def test_shared_memory(self):
+        name = f"jsbsim-test-{os.getpid()}"
+        with open("shm.xml", "w") as f:
+            f.write(OUTPUT.format(name=name))
+
+        fdm = self.create_fdm()
+        fdm.load_script(self.sandbox.path_to_jsbsim_file("scripts", "c1722.xml"))
+        fdm.set_output_directive("shm.xml")
+        fdm.run_ic()
+
+        n = 0
+        while not fdm.get_output_filename(n).endswith(name):
+            self.assertTrue(fdm.get_output_filename(n), f"Output {name} not found")
+            n += 1
+        path = fdm.get_output_filename(n)
+        if sys.platform.startswith("linux"):
+            self.assertEqual(path, f"/dev/shm/{name}")
+
+        for _ in range(100):
+            fdm.run()
+
+        with open(path, "rb") as f:
+            region = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            magic, size, sequence, version, _, lon, lat, alt = struct.unpack_from(
+                HEADER, region
+            )
+            region.close()
+
+        self.assertEqual(magic, b"JSBF")
+        self.assertEqual(sequence % 2, 0)
+        self.assertEqual(sequence // 2, 51)  # 1 by RunIC() + 50 at 60 Hz
+        self.assertEqual(version, 24)
+        self.assertAlmostEqual(lon, fdm["position/long-gc-rad"])
+        self.assertAlmostEqual(lat, fdm["position/lat-geod-rad"])
+        self.assertAlmostEqual(alt, fdm["position/h-sl-meters"], delta=1e-6)
+
+        # The region is created in the output directory on the other platforms.
+        self.delete_fdm()
+        if sys.platform.startswith("linux"):
+            os.remove(path)
+
+
+RunTest(TestOutputSharedMemory)
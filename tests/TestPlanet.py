@@ -75,6 +75,44 @@ class TestPlanet(JSBSimTestCase):
         self.assertAlmostEqual(self.fdm['atmosphere/rho-slugs_ft3']/0.001940318, 1.263428, delta=1E-6)
         self.assertAlmostEqual(self.fdm['atmosphere/P-psf'], 2132.294, delta=1E-3)
 
+    def test_MSIS_cached_profile(self):
+        # The MSIS atmosphere computed from its cached profile must match the
+        # reference model within the tolerance of the cache.
+        MSIS_file = self.sandbox.path_to_jsbsim_file('tests/MSIS.xml')
+        tree = et.parse(MSIS_file)
+        cache_tag = et.SubElement(tree.getroot().find('atmosphere'), 'cache')
+        et.SubElement(cache_tag, 'tolerance').text = '1E-6'
+        cached_file = self.sandbox('MSIS_cached.xml')
+        tree.write(cached_file)
+
+        fdms = []
+        for planet_file in (MSIS_file, cached_file):
+            tripod = FlightModel(self, 'tripod')
+            fdm = tripod.start()
+            fdm.load_planet(planet_file, False)
+            fdm['ic/long-gc-deg'] = -70.0
+            fdm['ic/lat-geod-deg'] = 60.0
+            fdms.append(fdm)
+
+        ref, cached = fdms
+        self.assertEqual(ref['atmosphere/cache/enabled'], 0.0)
+        self.assertEqual(cached['atmosphere/cache/enabled'], 1.0)
+
+        builds = None
+        for h in range(0, 3000000, 10000):
+            for fdm in fdms:
+                fdm['ic/h-sl-ft'] = h
+                fdm.run_ic()
+            if builds is None:
+                builds = cached['atmosphere/cache/builds']
+            for name in ('atmosphere/T-R', 'atmosphere/P-psf',
+                         'atmosphere/rho-slugs_ft3'):
+                self.assertAlmostEqual(cached[name]/ref[name], 1.0,
+                                       delta=1E-6, msg=f'{name} at {h} ft')
+
+        # The altitude changes alone do not rebuild the profile.
+        self.assertEqual(cached['atmosphere/cache/builds'], builds)
+
     def test_mars_atmosphere(self):
         # Mars atmosphere via <planet><atmosphere model="Mars"/></planet>.
         # Reference values are the closed-form output of FGMars::Calculate at
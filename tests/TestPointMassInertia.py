@@ -124,5 +124,43 @@ class TestPointMassInertia(JSBSimTestCase):
         self.assertAlmostEqual(fdm['inertia/ixz-slugs_ft2'],
                                float(ixz_element.text))
 
+    def test_incremental_update(self):
+        fdm = self.create_fdm()
+        fdm.load_model('c172x')
+        fdm.run_ic()
+
+        updates = fdm['inertia/mass-properties-updates']
+        weight = fdm['inertia/weight-lbs']
+        cgx = fdm['inertia/cg-x-in']
+        ixx = fdm['inertia/ixx-slugs_ft2']
+        ixz = fdm['inertia/ixz-slugs_ft2']
+
+        # The engine is not running so the mass properties are not updated.
+        for _ in range(10):
+            fdm.run()
+        self.assertEqual(fdm['inertia/mass-properties-updates'], updates)
+
+        pm_weight = fdm['inertia/pointmass-weight-lbs']
+        fdm['inertia/pointmass-weight-lbs'] = pm_weight + 100.0
+        fdm.run()
+        self.assertEqual(fdm['inertia/mass-properties-updates'], updates+1)
+        self.assertAlmostEqual(fdm['inertia/weight-lbs'], weight+100.0)
+        self.assertNotAlmostEqual(fdm['inertia/ixx-slugs_ft2'], ixx)
+
+        # The contribution of the point mass is removed by delta.
+        fdm['inertia/pointmass-weight-lbs'] = pm_weight
+        fdm.run()
+        self.assertEqual(fdm['inertia/mass-properties-updates'], updates+2)
+        self.assertAlmostEqual(fdm['inertia/weight-lbs'], weight)
+        self.assertAlmostEqual(fdm['inertia/cg-x-in'], cgx)
+        self.assertAlmostEqual(fdm['inertia/ixx-slugs_ft2'], ixx)
+        self.assertAlmostEqual(fdm['inertia/ixz-slugs_ft2'], ixz)
+
+        contents = fdm['propulsion/tank/contents-lbs']
+        fdm['propulsion/tank/contents-lbs'] = 0.0
+        fdm.run()
+        self.assertEqual(fdm['inertia/mass-properties-updates'], updates+3)
+        self.assertAlmostEqual(fdm['inertia/weight-lbs'], weight-contents)
+
 
 RunTest(TestPointMassInertia)
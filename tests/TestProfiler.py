@@ -0,0 +1,104 @@
+# TestProfiler.py
+#
+# Check the statistics collected by the profiler of FGFDMExec.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import json
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+
+class TestProfiler(JSBSimTestCase):
+    def load_c1722(self):
+        fdm = self.create_fdm()
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', 'c1722.xml')
+        fdm.load_script(script_path)
+        fdm.run_ic()
+        return fdm
+
+    def test_disabled(self):
+        fdm = self.load_c1722()
+        self.assertEqual(fdm['simulation/profile/enabled'], 0.0)
+
+        for _ in range(10):
+            fdm.run()
+
+        self.assertFalse(fdm.get_property_manager().hasNode(
+            'simulation/profile/models/propagate/calls'))
+
+    def test_statistics(self):
+        fdm = self.load_c1722()
+        fdm['simulation/profile/enabled'] = 1.0
+
+        for _ in range(100):
+            fdm.run()
+
+        # The trim executed by the script runs the models several times per
+        # time step.
+        calls = fdm['simulation/profile/models/propagate/calls']
+        self.assertGreaterEqual(calls, 100.0)
+
+        for section in ('models/propagate', 'models/systems',
+                        'models/aerodynamics', 'aero/coefficient/CLwbh',
+                        'fcs/Flaps', 'fcs/Flaps/fcs/flaps-control'):
+            prefix = 'simulation/profile/' + section + '/'
+            self.assertEqual(fdm[prefix+'calls'], calls, msg=section)
+            self.assertGreater(fdm[prefix+'total-sec'], 0.0, msg=section)
+            mean = fdm[prefix+'mean-us']
+            self.assertAlmostEqual(mean, fdm[prefix+'total-sec']*1E6/calls)
+            self.assertLessEqual(fdm[prefix+'min-us'], mean)
+            self.assertLessEqual(mean, fdm[prefix+'max-us'])
+            p50 = fdm[prefix+'p50-us']
+            p95 = fdm[prefix+'p95-us']
+            p99 = fdm[prefix+'p99-us']
+            self.assertLessEqual(fdm[prefix+'min-us'], p50)
+            self.assertLessEqual(p50, p95)
+            self.assertLessEqual(p95, p99)
+            self.assertLessEqual(p99, fdm[prefix+'max-us'])
+
+        # The statistics are no longer updated when the profiler is disabled.
+        fdm['simulation/profile/enabled'] = 0.0
+        fdm.run()
+        self.assertEqual(fdm['simulation/profile/models/propagate/calls'],
+                         calls)
+
+    def test_json_output(self):
+        fdm = self.load_c1722()
+        fdm['simulation/profile/enabled'] = 1.0
+        fdm.set_profile_output('profile.json')
+
+        for _ in range(50):
+            fdm.run()
+
+        calls = fdm['simulation/profile/models/propulsion/calls']
+        self.assertGreaterEqual(calls, 50.0)
+
+        # The profile is written when the FDM is destroyed.
+        del fdm
+        self.delete_fdm()
+
+        with open('profile.json') as f:
+            profile = json.load(f)
+
+        for name in ('models/propulsion', 'models/ground-reactions',
+                     'aero/coefficient/CDo'):
+            self.assertEqual(profile[name]['calls'], calls, msg=name)
+            self.assertGreater(profile[name]['total-sec'], 0.0, msg=name)
+
+
+RunTest(TestProfiler)
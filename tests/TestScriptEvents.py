@@ -0,0 +1,134 @@
+# TestScriptEvents.py
+#
+# Check the scheduling of the script events: events waiting for their time,
+# conditions that are only evaluated when their inputs change and events
+# replayed after a reset.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+
+SCRIPT = """<?xml version="1.0"?>
+<runscript name="events">
+  <use aircraft="ball" initialize="reset00"/>
+  <run start="0.0" end="10.0" dt="0.01">
+    <property value="0"> test/input </property>
+    <property value="0"> test/count </property>
+    <property value="0"> test/timed </property>
+    <property value="0"> test/chained </property>
+    <property value="0"> test/strict </property>
+
+    <event name="timed">
+      <condition> simulation/sim-time-sec ge 1.0 </condition>
+      <set name="test/timed" value="1"/>
+    </event>
+
+    <event name="chained">
+      <condition> test/timed eq 1 </condition>
+      <set name="test/chained" value="1"/>
+    </event>
+
+    <event name="counter" persistent="true">
+      <condition> test/input ge 1 </condition>
+      <set name="test/count" type="FG_DELTA" value="1"/>
+    </event>
+
+    <event name="strict">
+      <condition>
+        simulation/sim-time-sec gt 2.0
+        test/input ge 1
+      </condition>
+      <set name="test/strict" value="1"/>
+    </event>
+  </run>
+</runscript>
+"""
+
+
+class TestScriptEvents(JSBSimTestCase):
+    def load_script(self):
+        with open('events.xml', 'w') as f:
+            f.write(SCRIPT)
+
+        fdm = self.create_fdm()
+        fdm.load_script('events.xml')
+        fdm.run_ic()
+        return fdm
+
+    def run_until(self, fdm, t):
+        while fdm.get_sim_time() < t - 1E-8:
+            self.assertTrue(fdm.run())
+
+    def test_timed_events(self):
+        fdm = self.load_script()
+
+        self.run_until(fdm, 0.99)
+        self.assertEqual(fdm['test/timed'], 0.0)
+        self.assertEqual(fdm['test/chained'], 0.0)
+
+        # The events which conditions depend on the properties set by the
+        # event that has been woken up are executed in the same time step.
+        self.run_until(fdm, 1.0)
+        self.assertEqual(fdm['test/timed'], 1.0)
+        self.assertEqual(fdm['test/chained'], 1.0)
+
+    def test_property_events(self):
+        fdm = self.load_script()
+
+        self.run_until(fdm, 0.5)
+        self.assertEqual(fdm['test/count'], 0.0)
+
+        # The persistent event is executed each time its condition toggles from
+        # false to true.
+        for count in range(1, 4):
+            fdm['test/input'] = 1.0
+            fdm.run()
+            self.assertEqual(fdm['test/count'], count)
+            self.run_until(fdm, fdm.get_sim_time() + 0.1)
+            self.assertEqual(fdm['test/count'], count)
+            fdm['test/input'] = 0.0
+            fdm.run()
+
+        # The time test of the condition is combined with a property test.
+        self.run_until(fdm, 1.9)
+        fdm['test/input'] = 1.0
+        while fdm.run():
+            if fdm.get_sim_time() > 2.0:
+                self.assertEqual(fdm['test/strict'], 1.0)
+                break
+            self.assertEqual(fdm['test/strict'], 0.0)
+
+    def test_reset(self):
+        fdm = self.load_script()
+
+        self.run_until(fdm, 1.5)
+        self.assertEqual(fdm['test/timed'], 1.0)
+
+        # After a reset, the events are executed again.
+        fdm.reset_to_initial_conditions(0)
+        self.assertEqual(fdm.get_sim_time(), 0.0)
+        self.assertEqual(fdm['test/timed'], 0.0)
+        self.assertEqual(fdm['test/chained'], 0.0)
+
+        self.run_until(fdm, 0.99)
+        self.assertEqual(fdm['test/timed'], 0.0)
+        self.run_until(fdm, 1.0)
+        self.assertEqual(fdm['test/timed'], 1.0)
+        self.assertEqual(fdm['test/chained'], 1.0)
+
+
+RunTest(TestScriptEvents)
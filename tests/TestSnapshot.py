@@ -0,0 +1,174 @@
+# TestSnapshot.py
+#
+# Check that a simulation restored from a snapshot, or cloned, reproduces
+# exactly the trajectory of the simulation from which it was taken.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import math
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+from jsbsim import BaseError
+
+
+class TestSnapshot(JSBSimTestCase):
+    def load_script(self, script_name):
+        fdm = self.create_fdm()
+        script_path = self.sandbox.path_to_jsbsim_file('scripts', script_name)
+        fdm.load_script(script_path)
+        fdm.run_ic()
+        return fdm
+
+    def get_state(self, fdm):
+        properties = [p.split(' ')[0] for p in fdm.get_property_catalog()]
+        return {p: fdm[p] for p in properties
+                if not p.startswith('simulation/profile')}
+
+    def run_steps(self, fdm, nsteps):
+        states = []
+        for _ in range(nsteps):
+            if not fdm.run():
+                break
+            states.append(self.get_state(fdm))
+        return states
+
+    def assertSameStates(self, ref_states, states):
+        self.assertEqual(len(ref_states), len(states))
+        for ref, state in zip(ref_states, states):
+            self.assertEqual(ref.keys(), state.keys())
+            for name, value in ref.items():
+                if math.isnan(value):
+                    self.assertTrue(math.isnan(state[name]), msg=name)
+                else:
+                    self.assertEqual(value, state[name], msg=name)
+
+    def check_branching(self, script_name, nsteps_before, nsteps_after):
+        fdm = self.load_script(script_name)
+        for _ in range(nsteps_before):
+            fdm.run()
+
+        snapshot = fdm.save_snapshot()
+        ref_states = self.run_steps(fdm, nsteps_after)
+
+        # Branch twice from the same snapshot.
+        for _ in range(2):
+            fdm.restore_snapshot(snapshot)
+            self.assertSameStates(ref_states, self.run_steps(fdm, nsteps_after))
+
+        del fdm
+
+    def test_piston_on_ground(self):
+        self.check_branching('c1722.xml', 200, 500)
+
+    def test_turbine_fcs(self):
+        self.check_branching('f16_test.xml', 500, 500)
+
+    def test_script_events(self):
+        self.check_branching('c172_cruise_8K.xml', 1000, 2000)
+
+    def test_rocket(self):
+        self.check_branching('J2460.xml', 100, 500)
+
+    def test_turbulence(self):
+        fdm = self.load_script('c1722.xml')
+        # The turbulence is enabled after the trim of the script which may
+        # otherwise fail, depending on the gust at the time of the trim.
+        while fdm.get_sim_time() < 0.6:
+            fdm.run()
+        fdm['atmosphere/turb-type'] = 3
+        fdm['atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps'] = 25.0
+        fdm['atmosphere/turbulence/milspec/severity'] = 4
+        for _ in range(100):
+            fdm.run()
+
+        snapshot = fdm.save_snapshot()
+        ref_states = self.run_steps(fdm, 300)
+        fdm.restore_snapshot(snapshot)
+        self.assertSameStates(ref_states, self.run_steps(fdm, 300))
+
+        del fdm
+
+    def check_clone(self, script_name, nsteps_before, nsteps_after):
+        fdm = self.load_script(script_name)
+        for _ in range(nsteps_before):
+            fdm.run()
+
+        clones = [fdm.clone() for _ in range(2)]
+        # The outputs of the clones are disabled so the values computed by the
+        # output functions are compared with the outputs disabled as well.
+        fdm.disable_output()
+        ref_states = self.run_steps(fdm, nsteps_after)
+        for clone in clones:
+            self.assertSameStates(ref_states, self.run_steps(clone, nsteps_after))
+
+        del fdm
+        del clones
+
+    def test_clone_model(self):
+        self.check_clone('c1722.xml', 200, 500)
+
+    def test_clone_fcs(self):
+        self.check_clone('f16_test.xml', 500, 500)
+
+    def test_clone_script_events(self):
+        self.check_clone('c172_cruise_8K.xml', 1000, 2000)
+
+    def test_clone_is_independent(self):
+        fdm = self.load_script('c1722.xml')
+        for _ in range(200):
+            fdm.run()
+
+        throttle = fdm['fcs/throttle-cmd-norm']
+        self.assertGreater(throttle, 0.0)
+        clone = fdm.clone()
+        clone['fcs/throttle-cmd-norm'] = 0.0
+        self.assertEqual(fdm['fcs/throttle-cmd-norm'], throttle)
+        self.assertEqual(clone['fcs/throttle-cmd-norm'], 0.0)
+
+        del fdm
+        # The clone must survive the destruction of the original FDM.
+        for _ in range(100):
+            clone.run()
+        self.assertEqual(clone['fcs/throttle-cmd-norm'], 0.0)
+
+        del clone
+
+    def test_clone_without_model(self):
+        fdm = self.create_fdm()
+        with self.assertRaises(BaseError):
+            fdm.clone()
+
+        del fdm
+
+    def test_invalid_snapshot(self):
+        fdm = self.load_script('c1722.xml')
+        snapshot = fdm.save_snapshot()
+
+        with self.assertRaises(BaseError):
+            fdm.restore_snapshot(b'garbage')
+        with self.assertRaises(BaseError):
+            fdm.restore_snapshot(snapshot[:len(snapshot)//2])
+
+        fdm2 = self.load_script('f16_test.xml')
+        with self.assertRaises(BaseError):
+            fdm2.restore_snapshot(snapshot)
+
+        del fdm
+        del fdm2
+
+
+RunTest(TestSnapshot)
@@ -177,6 +177,26 @@ class TestStdAtmosphere(JSBSimTestCase):
         self.check_temperature(fdm, T_sl, 0.0)
         self.check_pressure(fdm, self.P0, T_sl, 0.0)
 
+    def test_cached_profile(self):
+        fdm = self.create_fdm()
+        fdm.load_model('ball')
+        fdm['atmosphere/cache/tolerance'] = 1E-8
+        fdm['atmosphere/cache/enabled'] = 1.0
+
+        self.check_temperature(fdm, self.T0, 0.0)
+        self.check_pressure(fdm, self.P0, self.T0, 0.0)
+        self.assertEqual(fdm['atmosphere/cache/builds'], 1)
+        self.assertGreater(fdm['atmosphere/cache/nodes'], 0)
+
+        # Modifying the temperature bias must rebuild the profile.
+        delta_T_K = 15.0
+        T_sl = self.T0 + delta_T_K
+        fdm['atmosphere/delta-T'] = delta_T_K*self.K_to_R
+
+        self.check_temperature(fdm, T_sl, 0.0)
+        self.check_pressure(fdm, self.P0, T_sl, 0.0)
+        self.assertEqual(fdm['atmosphere/cache/builds'], 2)
+
     def test_sl_pressure_bias(self):
         fdm = self.create_fdm()
         fdm.load_model('ball')
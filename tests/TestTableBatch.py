@@ -0,0 +1,124 @@
+# TestTableBatch.py
+#
+# Check that the batch evaluation of a table returns the same values as its
+# evaluation one point at a time.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import numpy as np
+
+from JSBSim_utils import JSBSimTestCase, RunTest
+from jsbsim import BaseError, FGTable
+
+table_1D = """
+<table>
+  <independentVar>aero/alpha-rad</independentVar>
+  <tableData>
+    -0.20  -0.68
+     0.00   0.20
+     0.23   1.20
+     0.60   0.60
+  </tableData>
+</table>"""
+
+table_2D = """
+<table name="aero/coefficient/CLdf">
+  <independentVar lookup="row">aero/alpha-rad</independentVar>
+  <independentVar lookup="column">fcs/flap-pos-deg</independentVar>
+  <tableData>
+             0.0    10.0   20.0   30.0
+    -0.20   -0.68  -0.50  -0.30  -0.10
+     0.00    0.20   0.40   0.55   0.70
+     0.23    1.20   1.35   1.50   1.60
+     0.60    0.60   0.70   0.85   0.90
+  </tableData>
+</table>"""
+
+table_3D = """
+<function name="test">
+  <table>
+    <independentVar lookup="row">aero/alpha-rad</independentVar>
+    <independentVar lookup="column">fcs/flap-pos-deg</independentVar>
+    <independentVar lookup="table">velocities/mach</independentVar>
+    <tableData breakPoint="0.2">
+              0.0   30.0
+      -0.20  -0.68 -0.10
+       0.60   0.60  0.90
+    </tableData>
+    <tableData breakPoint="0.5">
+              0.0   20.0
+      -0.20  -0.50 -0.20
+       0.00   0.10  0.30
+       0.60   0.70  1.00
+    </tableData>
+    <tableData breakPoint="0.9">
+              0.0   30.0
+      -0.20  -0.40  0.00
+       0.60   0.50  0.80
+    </tableData>
+  </table>
+</function>"""
+
+
+class TestTableBatch(JSBSimTestCase):
+    def setUp(self, *args):
+        super().setUp(*args)
+        self.rng = np.random.default_rng(0)
+
+    def check_batch(self, table, *keys):
+        values = table.get_values(*keys)
+        self.assertEqual(values.shape, np.broadcast_shapes(*[np.shape(k) for k in keys]))
+        for idx in np.ndindex(values.shape):
+            point = [float(np.broadcast_to(k, values.shape)[idx]) for k in keys]
+            self.assertEqual(values[idx], table.get_value(*point))
+
+    def test_1D(self):
+        table = FGTable(table_1D)
+        self.assertEqual(table.get_num_rows(), 4)
+        self.check_batch(table, self.rng.uniform(-0.5, 1.0, 100))
+        self.check_batch(table, [-0.2, 0.0, 0.23, 0.6])
+        self.check_batch(table, self.rng.uniform(-0.5, 1.0, (5, 7)))
+        self.assertEqual(table.get_values([]).shape, (0,))
+        self.assertEqual(table.get_values().shape, (0,))
+
+    def test_2D(self):
+        table = FGTable(table_2D)
+        self.assertEqual(table.get_name(), 'aero/coefficient/CLdf')
+        self.check_batch(table, self.rng.uniform(-0.5, 1.0, 100),
+                         self.rng.uniform(-5.0, 40.0, 100))
+        # The keys are broadcast against each other.
+        self.check_batch(table, self.rng.uniform(-0.5, 1.0, (10, 1)),
+                         [0.0, 5.0, 30.0, 45.0])
+
+    def test_3D(self):
+        table = FGTable(table_3D)
+        self.check_batch(table, self.rng.uniform(-0.5, 1.0, 200),
+                         self.rng.uniform(-5.0, 40.0, 200),
+                         self.rng.uniform(0.0, 1.2, 200))
+        self.check_batch(table, 0.1, 15.0, [0.1, 0.2, 0.3, 0.5, 0.7, 0.9, 1.0])
+
+        with self.assertRaises(BaseError):
+            table.get_values([0.1], [15.0])
+
+    def test_invalid_xml(self):
+        with self.assertRaises(BaseError):
+            FGTable("<function/>")
+        with self.assertRaises(BaseError):
+            FGTable("<table>")
+
+
+RunTest(TestTableBatch)
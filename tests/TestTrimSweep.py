@@ -0,0 +1,147 @@
+# TestTrimSweep.py
+#
+# Check the trim and linearization of a grid of flight conditions by
+# FGTrimSweep.
+#
+# Copyright (c) 2026 The JSBSim team
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>
+#
+
+import csv
+import os
+
+import numpy as np
+from JSBSim_utils import JSBSimTestCase, RunTest, jsbsim
+
+INIT_FILE = """<?xml version="1.0"?>
+<initialize name="sweep">
+  <altitude unit="FT"> 30000.0 </altitude>
+  <vt unit="FT/SEC"> 750.0 </vt>
+  <gamma unit="DEG"> 0.0 </gamma>
+  <latitude unit="DEG"> 47.0 </latitude>
+  <longitude unit="DEG"> 122.0 </longitude>
+  <psi unit="DEG"> 225.0 </psi>
+  <running> -1 </running>
+</initialize>
+"""
+
+
+class TestTrimSweep(JSBSimTestCase):
+    altitudes = [20000.0, 25000.0, 30000.0]
+    speeds = [650.0, 700.0, 750.0, 800.0]
+
+    def create_sweep(self, nthreads):
+        sweep = jsbsim.FGTrimSweep(os.path.join(self.sandbox(), ''), nthreads)
+        path = self.sandbox.path_to_jsbsim_file()
+        sweep.set_aircraft_path(os.path.join(path, 'aircraft'))
+        sweep.set_engine_path(os.path.join(path, 'engine'))
+        sweep.set_systems_path(os.path.join(path, 'systems'))
+
+        initfile = os.path.abspath(self.sandbox('sweep_init.xml'))
+        with open(initfile, 'w') as f:
+            f.write(INIT_FILE)
+
+        sweep.set_model('737')
+        sweep.set_init_file(initfile)
+        sweep.add_axis('ic/h-sl-ft', self.altitudes)
+        sweep.add_axis('ic/vt-fps', self.speeds)
+        return sweep
+
+    def test_warm_start(self):
+        sweep = self.create_sweep(2)
+        self.assertEqual(sweep.get_num_points(), 12)
+        np.testing.assert_array_equal(sweep.get_point(5), [25000.0, 700.0])
+
+        sweep.set_warm_start(False)
+        cold = sweep.run()
+        sweep.set_warm_start(True)
+        warm = sweep.run()
+
+        self.assertEqual(sweep.get_control_names(),
+                         ['Angle of Attack', 'Throttle', 'Pitch Trim'])
+        for r_cold, r_warm in zip(cold, warm):
+            self.assertTrue(r_cold['success'], msg=r_cold['error'])
+            self.assertTrue(r_warm['success'], msg=r_warm['error'])
+            self.assertFalse(r_cold['warm_start'])
+            np.testing.assert_allclose(r_warm['controls'], r_cold['controls'],
+                                       atol=1E-3)
+
+        # The first point of each thread can not be warm started.
+        self.assertGreaterEqual(sum(r['warm_start'] for r in warm), 10)
+        self.assertLess(sum(r['sub_iterations'] for r in warm),
+                        0.8*sum(r['sub_iterations'] for r in cold))
+
+    def test_csv_output(self):
+        sweep = self.create_sweep(2)
+        sweep.set_linearization(True)
+        sweep.set_output_properties(['aero/alpha-rad'])
+        sweep.set_output_file(self.sandbox('sweep.csv'))
+        results = sweep.run()
+
+        nx = len(sweep.get_state_names())
+        nu = len(sweep.get_input_names())
+        self.assertEqual(nx, 12)
+        self.assertEqual(nu, 4)
+
+        with open(self.sandbox('sweep.csv')) as f:
+            rows = list(csv.DictReader(f))
+
+        self.assertEqual(len(rows), sweep.get_num_points())
+        self.assertEqual(len(rows[0]), 7 + 1 + 3 + 2*(nx*nx+nx*nu))
+        self.assertEqual(sorted(int(row['point']) for row in rows),
+                         list(range(sweep.get_num_points())))
+
+        for row in rows:
+            i = int(row['point'])
+            r = results[i]
+            self.assertTrue(r['success'], msg=r['error'])
+            A, B, C, D = r['state_space']
+            self.assertEqual(A.shape, (nx, nx))
+            self.assertEqual(D.shape, (nx, nu))
+            h, vt = sweep.get_point(i)
+            self.assertEqual(float(row['ic/h-sl-ft']), h)
+            self.assertEqual(float(row['ic/vt-fps']), vt)
+            self.assertEqual(int(row['iterations']), r['iterations'])
+            # The trimmed angle of attack is the value of the first control.
+            self.assertAlmostEqual(float(row['aero/alpha-rad']),
+                                   r['controls'][0], delta=1E-6)
+            self.assertAlmostEqual(float(row['Throttle']), r['controls'][1],
+                                   delta=1E-9)
+            self.assertAlmostEqual(float(row['A[Alpha][Q]']), A[1, 3],
+                                   delta=1E-9*max(1.0, abs(A[1, 3])))
+
+    def test_failed_point(self):
+        sweep = self.create_sweep(1)
+        sweep.clear_axes()
+        # The aircraft can not fly at 100 ft/s.
+        sweep.add_axis('ic/vt-fps', [100.0, 750.0])
+        sweep.set_output_file(self.sandbox('failed.csv'))
+        results = sweep.run()
+
+        self.assertFalse(results[0]['success'])
+        self.assertTrue(results[1]['success'], msg=results[1]['error'])
+        # The failed point is not used to warm start its neighbour.
+        self.assertFalse(results[1]['warm_start'])
+
+        with open(self.sandbox('failed.csv')) as f:
+            rows = list(csv.DictReader(f))
+
+        self.assertEqual(len(rows), 2)
+        self.assertEqual(rows[0]['success'], '0')
+        self.assertEqual(rows[0]['Throttle'], '')
+        self.assertNotEqual(rows[1]['Throttle'], '')
+
+
+RunTest(TestTrimSweep)
@@ -19,6 +19,9 @@
 # this program; if not, see <http://www.gnu.org/licenses/>
 #
 
+import os
+import xml.etree.ElementTree as et
+
 from JSBSim_utils import JSBSimTestCase, CreateFDM, RunTest
 
 
@@ -35,12 +38,73 @@ class TestTurbulenceRandomSeed(JSBSimTestCase):
             self.assertAlmostEqual(we1[i], we2[i], delta=1E-8)
             self.assertAlmostEqual(wd1[i], wd2[i], delta=1E-8)
 
-    def captureTurbulence(self, wind_seed, exec_seed):
+    def testCounterBasedTurbulence(self):
+        # Test that the counter-based turbulence is reproducible and that it
+        # follows the FGFDMExec seed when no seed is assigned to the winds.
+        wn1, we1, wd1 = self.captureTurbulence(None, 4, True)
+        wn2, we2, wd2 = self.captureTurbulence(None, 4, True)
+        wn3, we3, wd3 = self.captureTurbulence(None, 5, True)
+        self.assertEqual(wn1, wn2)
+        self.assertEqual(we1, we2)
+        self.assertEqual(wd1, wd2)
+        self.assertNotEqual(wn1, wn3)
+
+    def testExtraDraws(self):
+        # Test that the counter-based turbulence does not change when another
+        # component draws random numbers, while the turbulence drawn from the
+        # generator of the simulation does.
+        for counter_based in (False, True):
+            wn1, we1, wd1 = self.captureTurbulence(None, 4, counter_based)
+            wn2, we2, wd2 = self.captureTurbulence(None, 4, counter_based,
+                                                   extra_draws=True)
+            if counter_based:
+                self.assertEqual(wn1, wn2)
+                self.assertEqual(we1, we2)
+                self.assertEqual(wd1, wd2)
+            else:
+                self.assertNotEqual(wn1, wn2)
+
+    def testVonKarmanTurbulence(self):
+        # Test that the von Karman turbulence is reproducible, both in time
+        # and in a frozen field.
+        wind_random_seed = 2
+        for frozen in (False, True):
+            wn1, we1, wd1 = self.captureTurbulence(wind_random_seed, 4,
+                                                   turb_type=5, frozen=frozen)
+            wn2, we2, wd2 = self.captureTurbulence(wind_random_seed, 5,
+                                                   turb_type=5, frozen=frozen)
+            self.assertEqual(wn1, wn2)
+            self.assertEqual(we1, we2)
+            self.assertEqual(wd1, wd2)
+            self.assertNotEqual(max(abs(w) for w in wd1), 0.0)
+
+        wn3, we3, wd3 = self.captureTurbulence(wind_random_seed + 1, 4,
+                                               turb_type=5, frozen=True)
+        self.assertNotEqual(wd1, wd3)
+
+    def captureTurbulence(self, wind_seed, exec_seed, counter_based=False,
+                          turb_type=3, frozen=False, extra_draws=False):
         fdm = self.create_fdm()
 
+        if extra_draws:
+            # Add a system which draws random numbers at each frame.
+            tree = et.parse(self.sandbox.path_to_jsbsim_file('aircraft', 'A4',
+                                                             'A4.xml'))
+            system = et.SubElement(tree.getroot(), 'system', name='noise')
+            function = et.SubElement(system, 'function', name='noise/value')
+            total = et.SubElement(function, 'sum')
+            for _ in range(3):
+                et.SubElement(total, 'random')
+            aircraft_path = self.sandbox('aircraft', 'A4')
+            os.makedirs(aircraft_path, exist_ok=True)
+            tree.write(os.path.join(aircraft_path, 'A4.xml'))
+            fdm.set_aircraft_path(self.sandbox('aircraft'))
+
         # Set random seeds for FGFDMExec and FGWinds
+        fdm["simulation/counter-based-random"] = counter_based
         fdm["simulation/randomseed"] = exec_seed
-        fdm["atmosphere/randomseed"] = wind_seed
+        if wind_seed is not None:
+            fdm["atmosphere/randomseed"] = wind_seed
 
         fdm.load_model('A4') 
 
@@ -56,7 +120,8 @@ class TestTurbulenceRandomSeed(JSBSimTestCase):
         fdm['simulation/do_simple_trim'] = 1
 
         # Setup turbulence
-        fdm["atmosphere/turb-type"] = 3
+        fdm["atmosphere/turb-type"] = turb_type
+        fdm["atmosphere/turbulence/frozen-field"] = frozen
         fdm["atmosphere/turbulence/milspec/windspeed_at_20ft_AGL-fps"] = 75
         fdm["atmosphere/turbulence/milspec/severity"] = 6
 
@@ -70,6 +135,9 @@ class TestTurbulenceRandomSeed(JSBSimTestCase):
             we.append(fdm['atmosphere/total-wind-east-fps'])
             wd.append(fdm['atmosphere/total-wind-down-fps'])
 
+        if extra_draws:
+            self.assertNotEqual(fdm['noise/value'], 0.0)
+
         return (wn, we, wd)
 
     def testUnassignedSeed(self):
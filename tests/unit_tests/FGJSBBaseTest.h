@@ -81,4 +81,41 @@ public:
     TS_ASSERT_EQUALS(x1, y1);
     TS_ASSERT_EQUALS(x2, y2);
   }
+
+  void testPhilox() {
+    // Known answers from the Random123 library
+    using Block = JSBSim::CounterRandomNumberGenerator::Block;
+    Block r = JSBSim::CounterRandomNumberGenerator::Philox({0, 0, 0, 0}, {0, 0});
+    TS_ASSERT_EQUALS(r, Block({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    r = JSBSim::CounterRandomNumberGenerator::Philox({0x243f6a88, 0x85a308d3,
+                                                      0x13198a2e, 0x03707344},
+                                                     {0xa4093822, 0x299f31d0});
+    TS_ASSERT_EQUALS(r, Block({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+  }
+
+  void testCounterRandomNumberGenerator() {
+    unsigned int frame = 3;
+    JSBSim::CounterRandomNumberGenerator generator(17, 1, frame);
+    JSBSim::CounterRandomNumberGenerator other(17, 2, frame);
+
+    double u0 = generator.GetUniformRandomNumber();
+    double x1 = generator.GetNormalRandomNumber();
+    // The draws are numbered from the start of each frame.
+    TS_ASSERT_EQUALS(u0, generator.GetUniformRandomNumber(3, 0));
+    TS_ASSERT_EQUALS(x1, generator.GetNormalRandomNumber(3, 1));
+    TS_ASSERT(u0 >= -1.0 && u0 < 1.0);
+    // The streams are independent.
+    TS_ASSERT_DIFFERS(u0, other.GetUniformRandomNumber());
+
+    std::string state = generator.GetState();
+    frame = 4;
+    double u2 = generator.GetUniformRandomNumber();
+    TS_ASSERT_EQUALS(u2, generator.GetUniformRandomNumber(4, 0));
+
+    generator.SetState(state);
+    TS_ASSERT_EQUALS(u2, generator.GetUniformRandomNumber());
+
+    generator.seed(18);
+    TS_ASSERT_DIFFERS(u2, generator.GetUniformRandomNumber(4, 0));
+  }
 };
@@ -16,4 +16,65 @@ public:
     TS_ASSERT_EQUALS(root->getNameString(), "");
     TS_ASSERT_EQUALS(GetFullyQualifiedName(root), "/");
   }
+
+  void testGetNode() {
+    auto pm = std::make_shared<FGPropertyManager>();
+
+    TS_ASSERT(!pm->GetNode("x/y"));
+    TS_ASSERT(!pm->HasNode("x/y"));
+
+    auto node = pm->GetNode("x/y", true);
+    TS_ASSERT(node);
+    TS_ASSERT(pm->HasNode("x/y"));
+    TS_ASSERT(pm->HasNode("-x/y"));
+    TS_ASSERT_EQUALS(pm->GetNode("x/y"), node);
+    TS_ASSERT_EQUALS(pm->GetNode("/x/y"), node);
+    TS_ASSERT_EQUALS(pm->GetNode()->getNode("x/y"), node);
+  }
+
+  void testGetRemovedNode() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto root = pm->GetNode();
+    SGPropertyNode_ptr y = pm->GetNode("x/y", true);
+    SGPropertyNode_ptr x = pm->GetNode("x");
+
+    // Remove the parent of an indexed node.
+    root->removeChild(x);
+    TS_ASSERT(!pm->GetNode("x/y"));
+    TS_ASSERT(!pm->HasNode("x/y"));
+
+    auto node = pm->GetNode("x/y", true);
+    TS_ASSERT(node);
+    TS_ASSERT_DIFFERS(node, y);
+    TS_ASSERT_EQUALS(pm->GetNode("x/y"), node);
+  }
+
+  void testHandles() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    auto root = pm->GetNode();
+
+    TS_ASSERT_THROWS(pm->GetHandle("x/y"), BaseException&);
+
+    size_t h = pm->GetHandle("x/y", true);
+    TS_ASSERT_EQUALS(pm->GetHandle("x/y"), h);
+    TS_ASSERT_DIFFERS(pm->GetHandle("x/z", true), h);
+
+    SGPropertyNode_ptr node = pm->GetNode(h);
+    TS_ASSERT_EQUALS(pm->GetNode("x/y"), node);
+
+    pm->SetDoubleValue(h, 1.5);
+    TS_ASSERT_EQUALS(node->getDoubleValue(), 1.5);
+    TS_ASSERT_EQUALS(pm->GetDoubleValue(h), 1.5);
+    node->setDoubleValue(-2.0);
+    TS_ASSERT_EQUALS(pm->GetDoubleValue(h), -2.0);
+
+    // The handle survives the removal of its node.
+    root->getNode("x")->removeChild(node);
+    TS_ASSERT(!pm->GetNode(h));
+    TS_ASSERT_EQUALS(pm->GetDoubleValue(h), 0.0);
+    pm->SetDoubleValue(h, 3.0);
+    TS_ASSERT(pm->GetNode(h));
+    TS_ASSERT_DIFFERS(pm->GetNode(h), node);
+    TS_ASSERT_EQUALS(root->getDoubleValue("x/y"), 3.0);
+  }
 };
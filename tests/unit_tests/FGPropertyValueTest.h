@@ -85,6 +85,99 @@ public:
     TS_ASSERT(property.IsConstant());
   }
 
+  void testTiedToPointer() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    double value = 1.0, other = -2.0;
+    FGPropertyValue property("-x", pm, nullptr);
+
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(property.GetValue(), -1.0);
+    value = 3.5;
+    TS_ASSERT_EQUALS(property.GetValue(), -3.5);
+
+    // The cached binding must follow the node when it is tied again.
+    pm->Untie("x");
+    TS_ASSERT_EQUALS(property.GetValue(), -3.5);
+    value = 4.0;
+    TS_ASSERT_EQUALS(property.GetValue(), -3.5);
+    pm->Tie("x", &other);
+    TS_ASSERT_EQUALS(property.GetValue(), 2.0);
+    other = 1.25;
+    TS_ASSERT_EQUALS(property.GetValue(), -1.25);
+  }
+
+  void testRetiedWithoutRead() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    double value = 1.0, other = -2.0;
+    SGPropertyNode_ptr node = pm->GetNode("x", true);
+    FGPropertyValue property(node);
+
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(property.GetValue(), 1.0);
+
+    // The new raw value may be allocated at the address of the previous one
+    // so the cache must not be validated by comparing the addresses.
+    for (int i=0; i<10; ++i) {
+      pm->Untie("x");
+      pm->Tie("x", &other);
+      TS_ASSERT_EQUALS(property.GetValue(), other);
+      pm->Untie("x");
+      pm->Tie("x", &value);
+      TS_ASSERT_EQUALS(property.GetValue(), value);
+      other -= 1.0;
+      value += 1.0;
+    }
+  }
+
+  void testAttributesModified() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    double value = 5.0;
+    SGPropertyNode_ptr node = pm->GetNode("x", true);
+    FGPropertyValue property(node);
+
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(property.GetValue(), 5.0);
+
+    // Unreadable properties return the default value.
+    node->setAttribute(SGPropertyNode::READ, false);
+    TS_ASSERT_EQUALS(property.GetValue(), 0.0);
+    node->setAttribute(SGPropertyNode::READ, true);
+    TS_ASSERT_EQUALS(property.GetValue(), 5.0);
+  }
+
+  void testTiedToGetter() {
+    struct Source {
+      double x = 0.0;
+      double GetX(void) const { return x; }
+    } source;
+    auto pm = std::make_shared<FGPropertyManager>();
+    SGPropertyNode_ptr node = pm->GetNode("x", true);
+    FGPropertyValue property(node);
+
+    pm->Tie("x", &source, &Source::GetX);
+    source.x = -0.75;
+    TS_ASSERT_EQUALS(property.GetValue(), -0.75);
+    source.x = 12.0;
+    TS_ASSERT_EQUALS(property.GetValue(), 12.0);
+
+    pm->Untie("x");
+    source.x = 1.0;
+    TS_ASSERT_EQUALS(property.GetValue(), 12.0);
+  }
+
+  void testTiedToInteger() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    int value = 3;
+    SGPropertyNode_ptr node = pm->GetNode("x", true);
+    FGPropertyValue property(node);
+
+    // Properties which are not of type double are converted by SGPropertyNode
+    pm->Tie("x", &value);
+    TS_ASSERT_EQUALS(property.GetValue(), 3.0);
+    value = -7;
+    TS_ASSERT_EQUALS(property.GetValue(), -7.0);
+  }
+
   void testConstructorLateBound() {
     auto pm = std::make_shared<FGPropertyManager>();
     FGPropertyValue property("x", pm, nullptr);
@@ -101,6 +101,91 @@ public:
     TS_ASSERT_EQUALS(t2.GetValue(2.47), 1.5);  // Saturated value
   }
 
+  void testGetValueLookupOrder() {
+    // The lookup must not depend on the interval found by the previous call.
+    const unsigned int n = 50;
+    FGTable t(n);
+    for (unsigned int i=0; i<n; ++i)
+      t << double(i) << double(i*i);
+
+    auto expected = [](double key) {
+      double i = floor(key);
+      return i*i + (key-i)*(2.0*i+1.0);
+    };
+
+    // Increasing keys
+    for (double key=0.05; key<n-1.0; key+=0.3)
+      TS_ASSERT_DELTA(t.GetValue(key), expected(key), epsilon*n*n);
+    // Decreasing keys
+    for (double key=n-1.05; key>0.0; key-=0.7)
+      TS_ASSERT_DELTA(t.GetValue(key), expected(key), epsilon*n*n);
+    // Keys jumping across the table
+    for (unsigned int i=0; i<200; ++i) {
+      double key = fmod(i*17.31, n-1.0);
+      TS_ASSERT_DELTA(t.GetValue(key), expected(key), epsilon*n*n);
+    }
+    // Breakpoints and saturated values
+    for (unsigned int i=0; i<n; ++i)
+      TS_ASSERT_EQUALS(t.GetValue(double(n-1-i)), double((n-1-i)*(n-1-i)));
+    TS_ASSERT_EQUALS(t.GetValue(-1.0), 0.0);
+    TS_ASSERT_EQUALS(t.GetValue(double(n)), double((n-1)*(n-1)));
+  }
+
+  void testGetValues() {
+    const unsigned int n = 50;
+    FGTable t(n);
+    for (unsigned int i=0; i<n; ++i)
+      t << double(i) << double(i*i);
+
+    // Unsorted keys, breakpoints and keys off the ends of the table.
+    std::vector<double> keys;
+    for (unsigned int i=0; i<200; ++i)
+      keys.push_back(fmod(i*17.31, n+3.0) - 1.5);
+    for (unsigned int i=0; i<n; ++i)
+      keys.push_back(double(i));
+
+    std::vector<double> values(keys.size());
+    t.GetValues(keys.size(), keys.data(), values.data());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(keys[i]));
+
+    FGTable::SetReciprocalSpans(true);
+    t.GetValues(keys.size(), {keys.data()}, values.data());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(keys[i]));
+    FGTable::SetReciprocalSpans(false);
+
+    FGTable t1(1);
+    t1 << 1.0 << 2.0;
+    t1.GetValues(keys.size(), keys.data(), values.data());
+    for (size_t i=0; i<keys.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], 2.0);
+  }
+
+  void testReciprocalSpans() {
+    FGTable t(3);
+    t << 1.0 << -1.0
+      << 2.0 << 1.5
+      << 4.0 << 0.5;
+
+    FGTable::SetReciprocalSpans(true);
+    TS_ASSERT(FGTable::GetReciprocalSpans());
+    TS_ASSERT_DELTA(t.GetValue(1.5), 0.25, epsilon);
+    TS_ASSERT_DELTA(t.GetValue(3.0), 1.0, epsilon);
+    TS_ASSERT_EQUALS(t.GetValue(0.3), -1.0);
+    TS_ASSERT_EQUALS(t.GetValue(4.2), 0.5);
+
+    // The spans must be updated when the table is modified.
+    FGTable t2(2);
+    t2 << 0.0 << 0.0;
+    t2 << 1.0 << 1.0;
+    TS_ASSERT_DELTA(t2.GetValue(0.5), 0.5, epsilon);
+
+    FGTable::SetReciprocalSpans(false);
+    TS_ASSERT(!FGTable::GetReciprocalSpans());
+    TS_ASSERT_EQUALS(t.GetValue(1.5), 0.25);
+  }
+
   void testLookupProperty() {
     auto pm = std::make_shared<FGPropertyManager>();
     auto node = pm->GetNode("x", true);
@@ -614,6 +699,73 @@ public:
     TS_ASSERT_EQUALS(t_2x2.GetValue(5.0, 2.0), 0.5);
   }
 
+  void testGetValueLookupOrder() {
+    // The lookup must not depend on the intervals found by the previous call.
+    const unsigned int n = 20;
+    FGTable t(n, n);
+    for (unsigned int j=0; j<n; ++j)
+      t << double(j);
+    for (unsigned int i=0; i<n; ++i) {
+      t << double(i);
+      for (unsigned int j=0; j<n; ++j)
+        t << double(i) + 2.0*j;
+    }
+
+    for (unsigned int k=0; k<300; ++k) {
+      double row = fmod(k*7.13, n-1.0);
+      double col = fmod(k*3.71, n-1.0);
+      TS_ASSERT_DELTA(t.GetValue(row, col), row + 2.0*col, epsilon*n);
+    }
+    for (double row=n-1.05, col=0.05; row>0.0; row-=0.45, col+=0.45)
+      TS_ASSERT_DELTA(t.GetValue(row, col), row + 2.0*col, epsilon*n);
+  }
+
+  void testGetValues() {
+    const unsigned int n = 20;
+    FGTable t(n, n-5);
+    for (unsigned int j=0; j<n-5; ++j)
+      t << double(j);
+    for (unsigned int i=0; i<n; ++i) {
+      t << 0.5*i;
+      for (unsigned int j=0; j<n-5; ++j)
+        t << sin(double(i)) + 2.0*j*j;
+    }
+
+    std::vector<double> rows, cols;
+    for (unsigned int k=0; k<300; ++k) {
+      rows.push_back(fmod(k*7.13, 0.5*n+2.0) - 1.0);
+      cols.push_back(fmod(k*3.71, n-2.0) - 1.0);
+    }
+
+    std::vector<double> values(rows.size());
+    t.GetValues(rows.size(), rows.data(), cols.data(), values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(rows[i], cols[i]));
+
+    FGTable::SetReciprocalSpans(true);
+    t.GetValues(rows.size(), {rows.data(), cols.data()}, values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(rows[i], cols[i]));
+    FGTable::SetReciprocalSpans(false);
+
+    // Single row and single column tables
+    FGTable t1(1, 3);
+    t1 << 0.0 << 1.0 << 2.0
+       << 1.0 << 5.0 << -1.0 << 3.0;
+    t1.GetValues(rows.size(), rows.data(), cols.data(), values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t1.GetValue(rows[i], cols[i]));
+
+    FGTable t2(3, 1);
+    t2 << 0.0
+       << 1.0 << 5.0
+       << 2.0 << -1.0
+       << 3.0 << 3.0;
+    t2.GetValues(rows.size(), rows.data(), cols.data(), values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t2.GetValue(rows[i], cols[i]));
+  }
+
   void testLookupProperty() {
     auto pm = std::make_shared<FGPropertyManager>();
     auto row = pm->GetNode("x", true);
@@ -1336,6 +1488,66 @@ public:
     TS_ASSERT_EQUALS(output->getDoubleValue(), -1.5);
   }
 
+  void testGetValues() {
+    auto pm = std::make_shared<FGPropertyManager>();
+    Element_ptr elm = readFromXML("<dummy>"
+                                  "  <table>"
+                                  "    <independentVar lookup=\"row\">x</independentVar>"
+                                  "    <independentVar lookup=\"column\">y</independentVar>"
+                                  "    <independentVar lookup=\"table\">z</independentVar>"
+                                  "    <tableData breakPoint=\"-1.0\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   3.0 -2.0\n"
+                                  "      4.0  -1.0  0.5\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"0.5\">"
+                                  "            0.5  1.5  3.0\n"
+                                  "      2.5   3.5 -2.5  1.0\n"
+                                  "      4.5  -1.5  1.0  2.0\n"
+                                  "      5.0   0.5  0.0  4.0\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"0.7\">"
+                                  "            0.0  1.0\n"
+                                  "      2.0   1.0  2.0\n"
+                                  "      4.0   3.0  4.0\n"
+                                  "    </tableData>"
+                                  "    <tableData breakPoint=\"2.0\">"
+                                  "            0.0\n"
+                                  "      1.0   1.0\n"
+                                  "      2.0   4.0\n"
+                                  "    </tableData>"
+                                  "  </table>"
+                                  "</dummy>");
+    FGTable t(pm, elm->FindElement("table"));
+
+    std::vector<double> rows, cols, tables;
+    for (unsigned int k=0; k<500; ++k) {
+      rows.push_back(fmod(k*0.73, 4.0) + 1.5);
+      cols.push_back(fmod(k*0.37, 4.0) - 0.5);
+      tables.push_back(fmod(k*0.29, 4.0) - 1.5);
+    }
+    // Breakpoints
+    rows.insert(rows.end(), {2.0, 4.0, 2.5, 2.0});
+    cols.insert(cols.end(), {0.0, 1.0, 1.5, 0.0});
+    tables.insert(tables.end(), {-1.0, 0.5, 0.7, 2.0});
+
+    std::vector<double> values(rows.size());
+    t.GetValues(rows.size(), rows.data(), cols.data(), tables.data(),
+                values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(rows[i], cols[i], tables[i]));
+
+    FGTable::SetReciprocalSpans(true);
+    t.GetValues(rows.size(), {rows.data(), cols.data(), tables.data()},
+                values.data());
+    for (size_t i=0; i<rows.size(); ++i)
+      TS_ASSERT_EQUALS(values[i], t.GetValue(rows[i], cols[i], tables[i]));
+    FGTable::SetReciprocalSpans(false);
+
+    TS_ASSERT_THROWS(t.GetValues(rows.size(), {rows.data(), cols.data()},
+                                 values.data()), BaseException&);
+  }
+
   void testCopyConstructor() {
     auto pm = std::make_shared<FGPropertyManager>();
     auto row = pm->GetNode("x", true);
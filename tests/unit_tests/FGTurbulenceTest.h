@@ -0,0 +1,94 @@
+#include <cmath>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+#include <models/atmosphere/FGTurbulence.h>
+
+using namespace JSBSim;
+
+constexpr unsigned int NumChannels = FGTurbulence::NumChannels;
+
+class FGTurbulenceTest : public CxxTest::TestSuite
+{
+public:
+  // The standard deviations of the channels must match the intensities (the
+  // rational approximations of the von Karman spectrum have a variance that is
+  // about 2% lower).
+  void testIntensities() {
+    const unsigned int numInstances = 64, numFrames = 500, numChunks = 40;
+    FGTurbulence::Scales scales {{100., 100., 100., 50.}, {1., 2., 3., 0.1}};
+
+    for (auto spectrum: {FGTurbulence::esDryden, FGTurbulence::esVonKarman}) {
+      FGTurbulence turbulence(spectrum, numInstances, 17);
+      std::vector<double> output(numFrames*NumChannels*numInstances);
+      double sum[NumChannels] {}, sum2[NumChannels] {};
+
+      turbulence.SetParameters(scales, 100., 0.01);
+      for (unsigned int chunk=0; chunk<numChunks; ++chunk) {
+        turbulence.Generate(numFrames, output.data());
+        for (unsigned int k=0; k<numFrames; ++k) {
+          for (unsigned int c=0; c<NumChannels; ++c) {
+            for (unsigned int i=0; i<numInstances; ++i) {
+              double x = output[(k*NumChannels+c)*numInstances+i];
+              sum[c] += x;
+              sum2[c] += x*x;
+            }
+          }
+        }
+      }
+      TS_ASSERT_EQUALS(turbulence.GetFrame(), numFrames*numChunks);
+
+      for (unsigned int c=0; c<NumChannels; ++c) {
+        double n = numFrames*numChunks*numInstances;
+        double sigma = sqrt(sum2[c]/n - sum[c]*sum[c]/(n*n));
+        TS_ASSERT_DELTA(sigma/scales.sigma[c], 1.0, 0.05);
+        TS_ASSERT_DELTA(sum[c]/n/scales.sigma[c], 0.0, 0.05);
+      }
+    }
+  }
+
+  // An instance must not depend on the number of instances generated together.
+  void testInstances() {
+    FGTurbulence::Scales scales {{1750., 1750., 1750., 90.}, {5., 5., 5., 0.02}};
+    FGTurbulence batch(FGTurbulence::esVonKarman, 8, 123);
+    FGTurbulence single(FGTurbulence::esVonKarman, 1, 123, 5);
+    std::vector<double> x(10*NumChannels*8), y(10*NumChannels);
+
+    batch.SetParameters(scales, 300., 1./120.);
+    single.SetParameters(scales, 300., 1./120.);
+    batch.Generate(10, x.data());
+    single.Generate(10, y.data());
+
+    for (unsigned int k=0; k<10; ++k)
+      for (unsigned int c=0; c<NumChannels; ++c)
+        TS_ASSERT_DELTA(y[k*NumChannels+c], x[(k*NumChannels+c)*8+5], 1E-12);
+
+    // The instances are different from each other.
+    TS_ASSERT_DIFFERS(x[0], x[1]);
+  }
+
+  void testReset() {
+    FGTurbulence::Scales scales {{1000., 1000., 1000., 70.}, {3., 3., 3., 0.01}};
+    FGTurbulence turbulence(FGTurbulence::esDryden, 4, 7);
+    std::vector<double> x(20*NumChannels*4), y(20*NumChannels*4);
+
+    turbulence.SetParameters(scales, 200., 0.01);
+    turbulence.Generate(20, x.data());
+    turbulence.Reset();
+    TS_ASSERT_EQUALS(turbulence.GetFrame(), 0);
+    turbulence.Generate(20, y.data());
+    TS_ASSERT_EQUALS(x, y);
+
+    // Generating by chunks gives the same result.
+    turbulence.Reset();
+    turbulence.Generate(5, y.data());
+    turbulence.Generate(15, &y[5*NumChannels*4]);
+    TS_ASSERT_EQUALS(x, y);
+
+    // Another seed gives another turbulence.
+    FGTurbulence other(FGTurbulence::esDryden, 4, 8);
+    other.SetParameters(scales, 200., 0.01);
+    other.Generate(20, y.data());
+    TS_ASSERT_DIFFERS(x, y);
+  }
+};